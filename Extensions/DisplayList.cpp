@@ -0,0 +1,635 @@
+/***************************************************************************************
+// The display list class member functions, this file is included by TFT_eSPI.cpp. See
+// DisplayList.h for details.
+***************************************************************************************/
+
+// Recorded call types
+#define DL_FILL_SCREEN     0
+#define DL_PIXEL           1
+#define DL_LINE            2
+#define DL_VLINE           3
+#define DL_HLINE           4
+#define DL_RECT            5
+#define DL_FILL_RECT       6
+#define DL_GRADIENT        7
+#define DL_ROUND_RECT      8
+#define DL_FILL_ROUND_RECT 9
+#define DL_CIRCLE         10
+#define DL_FILL_CIRCLE    11
+#define DL_ELLIPSE        12
+#define DL_FILL_ELLIPSE   13
+#define DL_TRIANGLE       14
+#define DL_FILL_TRIANGLE  15
+#define DL_BITMAP         16
+#define DL_IMAGE          17
+#define DL_TEXT           18
+
+/***************************************************************************************
+** Function name:           TFT_eDisplayList
+** Description:             Class constructor, tft is the display the scene is rendered to
+***************************************************************************************/
+TFT_eDisplayList::TFT_eDisplayList(TFT_eSPI *tft) : _strip(tft)
+{
+  _tft  = tft;
+  _ops  = NULL;
+  _text = NULL;
+
+  _maxOps = _opCount = _textBytes = _textUsed = 0;
+  _stripHeight = 0;
+  _overflow = false;
+
+  _textColor   = _textBg = 0xFFFF; // Transparent white, as TFT_eSPI
+  _textPadding = 0;
+  _textSize    = 1;
+  _textDatum   = TL_DATUM;
+  _textFont    = 1;
+  _gfxFont     = NULL;
+  _gfxAbove    = _gfxBelow = 0;
+}
+
+
+/***************************************************************************************
+** Function name:           ~TFT_eDisplayList
+** Description:             Class destructor, frees the RAM
+***************************************************************************************/
+TFT_eDisplayList::~TFT_eDisplayList(void)
+{
+  end();
+}
+
+
+/***************************************************************************************
+** Function name:           begin
+** Description:             Allocate the strip, the list and the text store
+***************************************************************************************/
+bool TFT_eDisplayList::begin(int16_t stripHeight, uint16_t maxOps, uint16_t textBytes)
+{
+  end();
+
+  if ((stripHeight < 1) || (maxOps < 1)) return false;
+  if (stripHeight > _tft->height()) stripHeight = _tft->height();
+
+  _ops  = (TFT_DisplayOp*) malloc(maxOps * sizeof(TFT_DisplayOp));
+  _text = (char*) malloc(textBytes ? textBytes : 1);
+
+  if (!_ops || !_text || !_strip.createSprite(_tft->width(), stripHeight)) {
+    end();
+    return false;
+  }
+
+  _stripHeight = stripHeight;
+  _maxOps      = maxOps;
+  _textBytes   = textBytes;
+
+  clear();
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           end
+** Description:             Free the RAM
+***************************************************************************************/
+void TFT_eDisplayList::end(void)
+{
+  _strip.deleteSprite();
+
+  if (_ops)  free(_ops);
+  if (_text) free(_text);
+  _ops  = NULL;
+  _text = NULL;
+
+  _maxOps = _opCount = _textBytes = _textUsed = 0;
+}
+
+
+/***************************************************************************************
+** Function name:           clear, opCount, overflow
+** Description:             Empty the list, and the list status
+***************************************************************************************/
+void TFT_eDisplayList::clear(void)
+{
+  _opCount  = 0;
+  _textUsed = 0;
+  _overflow = false;
+}
+
+uint16_t TFT_eDisplayList::opCount(void)
+{
+  return _opCount;
+}
+
+bool TFT_eDisplayList::overflow(void)
+{
+  return _overflow;
+}
+
+
+/***************************************************************************************
+** Function name:           addOp
+** Description:             Add a call covering rows ymin to ymax to the list
+***************************************************************************************/
+// Returns NULL if the list is full, or if the call is off the top or bottom of the TFT
+
+TFT_DisplayOp* TFT_eDisplayList::addOp(uint8_t type, int32_t ymin, int32_t ymax)
+{
+  if ((ymax < 0) || (ymin >= _tft->height())) return NULL;
+
+  if (_opCount >= _maxOps) {
+    _overflow = true;
+    return NULL;
+  }
+
+  TFT_DisplayOp *op = &_ops[_opCount++];
+
+  op->type = type;
+  op->ymin = (ymin < 0) ? 0 : ymin;
+  op->ymax = (ymax >= _tft->height()) ? _tft->height() - 1 : ymax;
+  op->data    = NULL;
+  op->gfxFont = NULL;
+
+  return op;
+}
+
+
+/***************************************************************************************
+** Function name:           render
+** Description:             Draw the scene in each strip in turn and push it to the TFT
+***************************************************************************************/
+// Every TFT pixel is sent once, all in one transaction
+
+void TFT_eDisplayList::render(void)
+{
+  if (!_ops) return;
+
+  int32_t height = _tft->height();
+
+  _tft->startWrite();
+
+  for (int32_t sy = 0; sy < height; sy += _stripHeight) {
+    int32_t sh = (height - sy < _stripHeight) ? height - sy : _stripHeight;
+
+    // The strip is a window onto the whole screen, so the calls are replayed with
+    // screen coordinates and text is positioned as it would be on the TFT
+    _strip.setCanvas(0, sy, _tft->width(), height);
+    _strip.fillSprite(TFT_BLACK);
+
+    for (uint16_t i = 0; i < _opCount; i++) {
+      TFT_DisplayOp *op = &_ops[i];
+      if ((op->ymax < sy) || (op->ymin >= sy + sh)) continue;
+      replay(op, sy, sh);
+    }
+
+    _strip.pushSprite(0, sy, 0, 0, _strip.width(), sh);
+  }
+
+  _tft->endWrite();
+}
+
+
+/***************************************************************************************
+** Function name:           replay
+** Description:             Draw a recorded call in the strip, sy is the strip top row
+***************************************************************************************/
+// The strip Sprite clips the graphics, images, bitmaps and gradients are only drawn
+// for the rows in the strip
+
+void TFT_eDisplayList::replay(TFT_DisplayOp *op, int32_t sy, int32_t sh)
+{
+  int16_t *p = op->p;
+
+  // Rows of the call inside the strip
+  int32_t r0 = (op->ymin > sy) ? op->ymin : sy;
+  int32_t r1 = (op->ymax < sy + sh - 1) ? op->ymax : sy + sh - 1;
+
+  switch (op->type) {
+
+    case DL_FILL_SCREEN:     _strip.fillSprite(op->color); break;
+    case DL_PIXEL:           _strip.drawPixel(p[0], p[1], op->color); break;
+    case DL_LINE:            _strip.drawLine(p[0], p[1], p[2], p[3], op->color); break;
+    case DL_VLINE:           _strip.drawFastVLine(p[0], p[1], p[2], op->color); break;
+    case DL_HLINE:           _strip.drawFastHLine(p[0], p[1], p[2], op->color); break;
+    case DL_RECT:            _strip.drawRect(p[0], p[1], p[2], p[3], op->color); break;
+    case DL_FILL_RECT:       _strip.fillRect(p[0], p[1], p[2], p[3], op->color); break;
+    case DL_ROUND_RECT:      _strip.drawRoundRect(p[0], p[1], p[2], p[3], p[4], op->color); break;
+    case DL_FILL_ROUND_RECT: _strip.fillRoundRect(p[0], p[1], p[2], p[3], p[4], op->color); break;
+    case DL_CIRCLE:          _strip.drawCircle(p[0], p[1], p[2], op->color); break;
+    case DL_FILL_CIRCLE:     _strip.fillCircle(p[0], p[1], p[2], op->color); break;
+    case DL_ELLIPSE:         _strip.drawEllipse(p[0], p[1], p[2], p[3], op->color); break;
+    case DL_FILL_ELLIPSE:    _strip.fillEllipse(p[0], p[1], p[2], p[3], op->color); break;
+    case DL_TRIANGLE:        _strip.drawTriangle(p[0], p[1], p[2], p[3], p[4], p[5], op->color); break;
+    case DL_FILL_TRIANGLE:   _strip.fillTriangle(p[0], p[1], p[2], p[3], p[4], p[5], op->color); break;
+
+    case DL_GRADIENT:
+    {
+      // Interpolate the colour of each row in the strip from the 565 components
+      uint16_t c1 = op->color, c2 = op->bg;
+      int32_t  r1c = c1 >> 11, g1 = (c1 >> 5) & 0x3F, b1 = c1 & 0x1F;
+      int32_t  dr = (c2 >> 11) - r1c, dg = ((c2 >> 5) & 0x3F) - g1, db = (c2 & 0x1F) - b1;
+      int32_t  n = (p[3] > 1) ? p[3] - 1 : 1;
+
+      for (int32_t row = r0; row <= r1; row++) {
+        int32_t  i = row - p[1];
+        uint16_t color = ((r1c + dr * i / n) << 11) | ((g1 + dg * i / n) << 5) | (b1 + db * i / n);
+        _strip.drawFastHLine(p[0], row, p[2], color);
+      }
+    }
+    break;
+
+    case DL_BITMAP:
+    {
+      // Only the bitmap rows in the strip
+      int32_t byteWidth = (p[2] + 7) / 8;
+      const uint8_t *bitmap = (const uint8_t*)op->data + (r0 - p[1]) * byteWidth;
+      if (p[4]) _strip.drawBitmap(p[0], r0, bitmap, p[2], r1 - r0 + 1, op->color, op->bg);
+      else _strip.drawBitmap(p[0], r0, bitmap, p[2], r1 - r0 + 1, op->color);
+    }
+    break;
+
+    case DL_IMAGE:
+    {
+      // Only the image rows in the strip
+      const uint16_t *data = (const uint16_t*)op->data + (r0 - p[1]) * p[2];
+      _strip.pushRect(p[0], r0, p[2], r1 - r0 + 1, (uint16_t*)data);
+    }
+    break;
+
+    case DL_TEXT:
+      _strip.setTextColor(op->color, op->bg);
+      _strip.setTextSize(op->size);
+      _strip.setTextDatum(op->datum);
+      _strip.setTextPadding(p[2]);
+#ifdef LOAD_GFXFF
+      if (op->gfxFont) _strip.setFreeFont((const GFXfont*)op->gfxFont);
+      else
+#endif
+        _strip.setTextFont(op->font);
+      _strip.drawString((const char*)op->data, p[0], p[1], op->gfxFont ? 1 : op->font);
+    break;
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           fillScreen, drawPixel, drawLine
+** Description:             Record a graphics call
+***************************************************************************************/
+void TFT_eDisplayList::fillScreen(uint32_t color)
+{
+  // Earlier calls are hidden, start the list again but keep the text store
+  _opCount = 0;
+
+  TFT_DisplayOp *op = addOp(DL_FILL_SCREEN, 0, _tft->height() - 1);
+  if (op) op->color = color;
+}
+
+void TFT_eDisplayList::drawPixel(int32_t x, int32_t y, uint32_t color)
+{
+  TFT_DisplayOp *op = addOp(DL_PIXEL, y, y);
+  if (!op) return;
+
+  op->p[0] = x; op->p[1] = y;
+  op->color = color;
+}
+
+void TFT_eDisplayList::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color)
+{
+  TFT_DisplayOp *op = addOp(DL_LINE, (y0 < y1) ? y0 : y1, (y0 < y1) ? y1 : y0);
+  if (!op) return;
+
+  op->p[0] = x0; op->p[1] = y0; op->p[2] = x1; op->p[3] = y1;
+  op->color = color;
+}
+
+
+/***************************************************************************************
+** Function name:           drawFastVLine, drawFastHLine
+** Description:             Record a graphics call
+***************************************************************************************/
+void TFT_eDisplayList::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color)
+{
+  TFT_DisplayOp *op = addOp(DL_VLINE, y, y + h - 1);
+  if (!op) return;
+
+  op->p[0] = x; op->p[1] = y; op->p[2] = h;
+  op->color = color;
+}
+
+void TFT_eDisplayList::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color)
+{
+  TFT_DisplayOp *op = addOp(DL_HLINE, y, y);
+  if (!op) return;
+
+  op->p[0] = x; op->p[1] = y; op->p[2] = w;
+  op->color = color;
+}
+
+
+/***************************************************************************************
+** Function name:           drawRect, fillRect, fillRectVGradient
+** Description:             Record a graphics call
+***************************************************************************************/
+void TFT_eDisplayList::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+  TFT_DisplayOp *op = addOp(DL_RECT, y, y + h - 1);
+  if (!op) return;
+
+  op->p[0] = x; op->p[1] = y; op->p[2] = w; op->p[3] = h;
+  op->color = color;
+}
+
+void TFT_eDisplayList::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+  TFT_DisplayOp *op = addOp(DL_FILL_RECT, y, y + h - 1);
+  if (!op) return;
+
+  op->p[0] = x; op->p[1] = y; op->p[2] = w; op->p[3] = h;
+  op->color = color;
+}
+
+void TFT_eDisplayList::fillRectVGradient(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color1, uint32_t color2)
+{
+  TFT_DisplayOp *op = addOp(DL_GRADIENT, y, y + h - 1);
+  if (!op) return;
+
+  op->p[0] = x; op->p[1] = y; op->p[2] = w; op->p[3] = h;
+  op->color = color1;
+  op->bg    = color2;
+}
+
+
+/***************************************************************************************
+** Function name:           drawRoundRect, fillRoundRect
+** Description:             Record a graphics call
+***************************************************************************************/
+void TFT_eDisplayList::drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t radius, uint32_t color)
+{
+  TFT_DisplayOp *op = addOp(DL_ROUND_RECT, y, y + h - 1);
+  if (!op) return;
+
+  op->p[0] = x; op->p[1] = y; op->p[2] = w; op->p[3] = h; op->p[4] = radius;
+  op->color = color;
+}
+
+void TFT_eDisplayList::fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t radius, uint32_t color)
+{
+  TFT_DisplayOp *op = addOp(DL_FILL_ROUND_RECT, y, y + h - 1);
+  if (!op) return;
+
+  op->p[0] = x; op->p[1] = y; op->p[2] = w; op->p[3] = h; op->p[4] = radius;
+  op->color = color;
+}
+
+
+/***************************************************************************************
+** Function name:           drawCircle, fillCircle, drawEllipse, fillEllipse
+** Description:             Record a graphics call
+***************************************************************************************/
+void TFT_eDisplayList::drawCircle(int32_t x, int32_t y, int32_t r, uint32_t color)
+{
+  TFT_DisplayOp *op = addOp(DL_CIRCLE, y - r, y + r);
+  if (!op) return;
+
+  op->p[0] = x; op->p[1] = y; op->p[2] = r;
+  op->color = color;
+}
+
+void TFT_eDisplayList::fillCircle(int32_t x, int32_t y, int32_t r, uint32_t color)
+{
+  TFT_DisplayOp *op = addOp(DL_FILL_CIRCLE, y - r, y + r);
+  if (!op) return;
+
+  op->p[0] = x; op->p[1] = y; op->p[2] = r;
+  op->color = color;
+}
+
+void TFT_eDisplayList::drawEllipse(int16_t x, int16_t y, int16_t rx, int16_t ry, uint16_t color)
+{
+  TFT_DisplayOp *op = addOp(DL_ELLIPSE, y - ry, y + ry);
+  if (!op) return;
+
+  op->p[0] = x; op->p[1] = y; op->p[2] = rx; op->p[3] = ry;
+  op->color = color;
+}
+
+void TFT_eDisplayList::fillEllipse(int16_t x, int16_t y, int16_t rx, int16_t ry, uint16_t color)
+{
+  TFT_DisplayOp *op = addOp(DL_FILL_ELLIPSE, y - ry, y + ry);
+  if (!op) return;
+
+  op->p[0] = x; op->p[1] = y; op->p[2] = rx; op->p[3] = ry;
+  op->color = color;
+}
+
+
+/***************************************************************************************
+** Function name:           drawTriangle, fillTriangle
+** Description:             Record a graphics call
+***************************************************************************************/
+void TFT_eDisplayList::drawTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color)
+{
+  int32_t ymin = y0, ymax = y0;
+  if (y1 < ymin) ymin = y1;
+  if (y2 < ymin) ymin = y2;
+  if (y1 > ymax) ymax = y1;
+  if (y2 > ymax) ymax = y2;
+
+  TFT_DisplayOp *op = addOp(DL_TRIANGLE, ymin, ymax);
+  if (!op) return;
+
+  op->p[0] = x0; op->p[1] = y0; op->p[2] = x1; op->p[3] = y1; op->p[4] = x2; op->p[5] = y2;
+  op->color = color;
+}
+
+void TFT_eDisplayList::fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color)
+{
+  int32_t ymin = y0, ymax = y0;
+  if (y1 < ymin) ymin = y1;
+  if (y2 < ymin) ymin = y2;
+  if (y1 > ymax) ymax = y1;
+  if (y2 > ymax) ymax = y2;
+
+  TFT_DisplayOp *op = addOp(DL_FILL_TRIANGLE, ymin, ymax);
+  if (!op) return;
+
+  op->p[0] = x0; op->p[1] = y0; op->p[2] = x1; op->p[3] = y1; op->p[4] = x2; op->p[5] = y2;
+  op->color = color;
+}
+
+
+/***************************************************************************************
+** Function name:           drawBitmap, pushRect
+** Description:             Record a graphics call, the data is not copied
+***************************************************************************************/
+void TFT_eDisplayList::drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color)
+{
+  TFT_DisplayOp *op = addOp(DL_BITMAP, y, y + h - 1);
+  if (!op) return;
+
+  op->p[0] = x; op->p[1] = y; op->p[2] = w; op->p[3] = h;
+  op->p[4]  = 0; // Transparent
+  op->color = color;
+  op->data  = bitmap;
+}
+
+void TFT_eDisplayList::drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t fgcolor, uint16_t bgcolor)
+{
+  TFT_DisplayOp *op = addOp(DL_BITMAP, y, y + h - 1);
+  if (!op) return;
+
+  op->p[0] = x; op->p[1] = y; op->p[2] = w; op->p[3] = h;
+  op->p[4]  = 1; // Opaque
+  op->color = fgcolor;
+  op->bg    = bgcolor;
+  op->data  = bitmap;
+}
+
+void TFT_eDisplayList::pushRect(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data)
+{
+  TFT_DisplayOp *op = addOp(DL_IMAGE, y, y + h - 1);
+  if (!op) return;
+
+  op->p[0] = x; op->p[1] = y; op->p[2] = w; op->p[3] = h;
+  op->data = data;
+}
+
+
+/***************************************************************************************
+** Function name:           setTextColor, setTextSize, setTextDatum, setTextPadding
+** Description:             Text settings for the text recorded after them
+***************************************************************************************/
+void TFT_eDisplayList::setTextColor(uint16_t color)
+{
+  // Background same as foreground so the background is not drawn
+  _textColor = _textBg = color;
+}
+
+void TFT_eDisplayList::setTextColor(uint16_t fgcolor, uint16_t bgcolor)
+{
+  _textColor = fgcolor;
+  _textBg    = bgcolor;
+}
+
+void TFT_eDisplayList::setTextSize(uint8_t size)
+{
+  _textSize = (size > 0) ? size : 1;
+}
+
+void TFT_eDisplayList::setTextDatum(uint8_t datum)
+{
+  _textDatum = datum;
+}
+
+void TFT_eDisplayList::setTextPadding(uint16_t x_width)
+{
+  _textPadding = x_width;
+}
+
+
+/***************************************************************************************
+** Function name:           setTextFont, setFreeFont
+** Description:             Select the font for the text recorded after them
+***************************************************************************************/
+void TFT_eDisplayList::setTextFont(uint8_t font)
+{
+  _textFont = (font > 0) ? font : 1;
+  _gfxFont  = NULL;
+}
+
+#ifdef LOAD_GFXFF
+void TFT_eDisplayList::setFreeFont(const GFXfont *f)
+{
+  _textFont = 1;
+  _gfxFont  = f;
+
+  // Find how far the glyphs reach above and below the baseline, used for the rows text covers
+  uint16_t count = pgm_read_byte(&f->last) - pgm_read_byte(&f->first) + 1;
+#ifdef LOAD_UNICODE
+  GFXrange *range = (GFXrange *)pgm_read_dword(&f->range);
+  if (range) {
+    count = 0;
+    for (uint16_t i = 0; i < pgm_read_word(&f->ranges); i++) {
+      uint16_t end = pgm_read_word(&range[i].glyph) + pgm_read_word(&range[i].last) - pgm_read_word(&range[i].first) + 1;
+      if (end > count) count = end;
+    }
+  }
+#endif
+  GFXglyph *glyph = (GFXglyph *)pgm_read_dword(&f->glyph);
+  _gfxAbove = _gfxBelow = 0;
+  for (uint16_t i = 0; i < count; i++) {
+    int16_t top    = -(int8_t)pgm_read_byte(&glyph[i].yOffset);
+    int16_t bottom = pgm_read_byte(&glyph[i].height) - top;
+    if (top > _gfxAbove)    _gfxAbove = top;
+    if (bottom > _gfxBelow) _gfxBelow = bottom;
+  }
+}
+#endif
+
+
+/***************************************************************************************
+** Function name:           drawString, drawNumber
+** Description:             Record text, the string is copied into the text store
+***************************************************************************************/
+void TFT_eDisplayList::drawString(const char *string, int32_t x, int32_t y)
+{
+  drawString(string, x, y, _textFont);
+}
+
+void TFT_eDisplayList::drawString(const char *string, int32_t x, int32_t y, uint8_t font)
+{
+  const void *gfx = (font == 1) ? _gfxFont : NULL;
+
+  // The rows covered depend on the datum, allow the font height above and below y.
+  // TFT_eSPI::drawString() moves text that is partly off the top or bottom of the
+  // screen back on, so text near an edge may cover the rows next to it. A free font
+  // string moved up from the bottom has its baseline up to the font height above the
+  // edge, and the glyphs reach up to _gfxAbove above that.
+  int32_t height, above = 0;
+#ifdef LOAD_GFXFF
+  if (gfx) {
+    height = _gfxAbove + _gfxBelow;
+    above  = _gfxAbove * _textSize;
+  }
+  else
+#endif
+    height = pgm_read_byte(&fontdata[font].height);
+  height *= _textSize;
+
+  uint16_t len = strlen(string) + 1;
+  if (_textUsed + len > _textBytes) {
+    _overflow = true;
+    return;
+  }
+
+  int32_t ymin = y - height, ymax = y + height;
+  if (ymin > _tft->height() - height - above) ymin = _tft->height() - height - above;
+  if (ymax < height) ymax = height;
+
+  TFT_DisplayOp *op = addOp(DL_TEXT, ymin, ymax);
+  if (!op) return;
+
+  char *text = _text + _textUsed;
+  memcpy(text, string, len);
+  _textUsed += len;
+
+  op->p[0] = x; op->p[1] = y; op->p[2] = _textPadding;
+  op->font    = font;
+  op->size    = _textSize;
+  op->datum   = _textDatum;
+  op->color   = _textColor;
+  op->bg      = _textBg;
+  op->data    = text;
+  op->gfxFont = gfx;
+}
+
+void TFT_eDisplayList::drawNumber(long number, int32_t x, int32_t y)
+{
+  drawNumber(number, x, y, _textFont);
+}
+
+void TFT_eDisplayList::drawNumber(long number, int32_t x, int32_t y, uint8_t font)
+{
+  char str[12];
+  ltoa(number, str, 10);
+  drawString(str, x, y, font);
+}
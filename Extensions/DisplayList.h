@@ -0,0 +1,121 @@
+/***************************************************************************************
+// The following class records a scene as a list of graphics calls (a display list)
+// and then renders it one horizontal strip at a time. Each strip is drawn in a small
+// Sprite, e.g. 240 x 16 pixels, by replaying the calls that reach into it, and is then
+// pushed to the TFT in one go.
+//
+// Later calls draw over earlier ones (text over a gradient over an image) as they would
+// on the TFT, but every TFT pixel is written exactly once per frame so there is no
+// flicker. Only the strip needs RAM, not a full screen buffer.
+//
+// The recorded calls are clipped to each strip, calls that do not reach a strip are
+// skipped using the rows they cover, worked out when they are recorded. Text is copied
+// into the list so a temporary string can be used. Image data passed to pushRect() and
+// drawBitmap() is not copied and must not change until render() returns.
+//
+// The strip is as wide as the TFT when begin() is called, call begin() again after
+// changing the rotation. Each strip starts black, a scene normally starts with
+// fillScreen() or an image that covers the screen.
+***************************************************************************************/
+
+#ifndef _TFT_eSPI_DisplayListH_
+#define _TFT_eSPI_DisplayListH_
+
+// A recorded graphics call
+typedef struct {
+  uint8_t  type;        // Type of call, see DisplayList.cpp
+  uint8_t  font, size, datum; // Text settings
+  int16_t  ymin, ymax;  // Rows covered, used to skip strips
+  int16_t  p[6];        // Coordinates and sizes
+  uint32_t color, bg;   // Colours
+  const void *data;     // Image, bitmap or text
+  const void *gfxFont;  // Free font of text, NULL for the numbered fonts
+} TFT_DisplayOp;
+
+class TFT_eDisplayList {
+
+ public:
+
+  TFT_eDisplayList(TFT_eSPI *tft);
+  ~TFT_eDisplayList(void);
+
+           // Allocate the strip Sprite, the list and the text store. Returns false if
+           // there is not enough free RAM.
+  bool     begin(int16_t stripHeight = 16, uint16_t maxOps = 64, uint16_t textBytes = 256);
+  void     end(void); // Free the RAM
+
+           // Empty the list to record a new scene
+  void     clear(void),
+
+           // Render the scene to the TFT strip by strip, the list is kept
+           render(void);
+
+  uint16_t opCount(void);  // Calls recorded since clear()
+  bool     overflow(void); // A call or text did not fit and was dropped since clear()
+
+           // Graphics calls that are recorded, the same as the TFT_eSPI functions
+  void     fillScreen(uint32_t color),
+           drawPixel(int32_t x, int32_t y, uint32_t color),
+           drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color),
+           drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color),
+           drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color),
+           drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color),
+           fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color),
+
+           // Fill with colours shaded from color1 on the top row to color2 on the bottom
+           fillRectVGradient(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color1, uint32_t color2),
+
+           drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t radius, uint32_t color),
+           fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t radius, uint32_t color),
+           drawCircle(int32_t x, int32_t y, int32_t r, uint32_t color),
+           fillCircle(int32_t x, int32_t y, int32_t r, uint32_t color),
+           drawEllipse(int16_t x, int16_t y, int16_t rx, int16_t ry, uint16_t color),
+           fillEllipse(int16_t x, int16_t y, int16_t rx, int16_t ry, uint16_t color),
+           drawTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color),
+           fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color),
+           drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color),
+           drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t fgcolor, uint16_t bgcolor),
+
+           // An image with the pixel bytes in the same order as TFT_eSPI::pushRect()
+           pushRect(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data),
+
+           // Text settings used by the text recorded after them
+           setTextColor(uint16_t color),
+           setTextColor(uint16_t fgcolor, uint16_t bgcolor),
+           setTextSize(uint8_t size),
+           setTextDatum(uint8_t datum),
+           setTextPadding(uint16_t x_width),
+           setTextFont(uint8_t font),
+#ifdef LOAD_GFXFF
+           setFreeFont(const GFXfont *f),
+#endif
+
+           drawString(const char *string, int32_t x, int32_t y),
+           drawString(const char *string, int32_t x, int32_t y, uint8_t font),
+           drawNumber(long number, int32_t x, int32_t y),
+           drawNumber(long number, int32_t x, int32_t y, uint8_t font);
+
+ private:
+
+  TFT_DisplayOp* addOp(uint8_t type, int32_t ymin, int32_t ymax); // NULL if the list is full
+  void     replay(TFT_DisplayOp *op, int32_t sy, int32_t sh);      // Draw op in the strip at row sy
+
+  TFT_eSPI    *_tft;
+  TFT_eSprite  _strip;      // The strip buffer
+
+  TFT_DisplayOp *_ops;      // The list
+  char     *_text;          // Text store
+
+  uint16_t _maxOps, _opCount,
+           _textBytes, _textUsed;
+  int16_t  _stripHeight;
+  boolean  _overflow;
+
+  uint32_t _textColor, _textBg;        // Text settings for new text
+  uint16_t _textPadding;
+  uint8_t  _textSize, _textDatum, _textFont;
+  const void *_gfxFont;
+  int16_t  _gfxAbove, _gfxBelow;       // Free font glyph extents above and below the baseline
+};
+
+#endif
@@ -0,0 +1,353 @@
+/***************************************************************************************
+// Host transport backend and panel model, this file is included by TFT_eSPI.cpp when
+// TFT_HOST_BACKEND is defined. See Host.h for details.
+***************************************************************************************/
+
+TFT_HostStats TFT_Host::stats;
+
+uint16_t TFT_Host::gram[TFT_HOST_GRAM_WIDTH * TFT_HOST_GRAM_HEIGHT];
+
+bool     TFT_Host::dc = true, TFT_Host::cs = false, TFT_Host::msbHeld = false;
+uint8_t  TFT_Host::cmd = TFT_NOP, TFT_Host::argc = 0, TFT_Host::madctl = 0;
+uint8_t  TFT_Host::readStep = 0;
+uint8_t  TFT_Host::args[4];
+uint16_t TFT_Host::xs = 0, TFT_Host::xe = TFT_HOST_GRAM_WIDTH - 1;
+uint16_t TFT_Host::ys = 0, TFT_Host::ye = TFT_HOST_GRAM_HEIGHT - 1;
+uint16_t TFT_Host::cx = 0, TFT_Host::cy = 0;
+
+const uint8_t *TFT_Host::dmaData[TFT_HOST_DMA_QUEUE];
+uint32_t TFT_Host::dmaLen[TFT_HOST_DMA_QUEUE], TFT_Host::dmaEnd[TFT_HOST_DMA_QUEUE];
+uint32_t TFT_Host::dmaLast = 0, TFT_Host::dmaStall = 0;
+uint8_t  TFT_Host::dmaHead = 0, TFT_Host::dmaCount = 0;
+
+
+/***************************************************************************************
+** Function name:           reset
+** Description:             Clear GRAM, panel state and counters (like a power cycle)
+***************************************************************************************/
+void TFT_Host::reset(void)
+{
+  memset(gram, 0, sizeof(gram));
+  dc = true; cs = false; msbHeld = false;
+  cmd = TFT_NOP; argc = 0; madctl = 0; readStep = 0;
+  xs = 0; xe = TFT_HOST_GRAM_WIDTH - 1;
+  ys = 0; ye = TFT_HOST_GRAM_HEIGHT - 1;
+  cx = 0; cy = 0;
+  dmaHead = 0; dmaCount = 0; dmaLast = 0; dmaStall = 0;
+  clearStats();
+}
+
+
+/***************************************************************************************
+** Function name:           clearStats
+** Description:             Zero the bus activity counters
+***************************************************************************************/
+void TFT_Host::clearStats(void)
+{
+  memset(&stats, 0, sizeof(stats));
+}
+
+
+/***************************************************************************************
+** Function name:           dcLow, dcHigh, csLow, csHigh, beginTransaction
+** Description:             Control line and bus lock models
+***************************************************************************************/
+void TFT_Host::dcLow(void)  { dc = false; }
+
+void TFT_Host::dcHigh(void) { dc = true; }
+
+void TFT_Host::csLow(void)
+{
+  if (!cs) stats.csToggles++;
+  cs = true;
+}
+
+void TFT_Host::csHigh(void)
+{
+  cs = false;
+  msbHeld = false; // A partially sent pixel is discarded by the panel
+  if (cmd == TFT_RAMRD) cmd = TFT_NOP; // CS high terminates a memory read
+}
+
+void TFT_Host::beginTransaction(void) { stats.transactions++; }
+
+
+/***************************************************************************************
+** Function name:           write8, write16, writePattern, writeBytes, read8
+** Description:             Bus transfers, 16 bit values are sent MSB first
+***************************************************************************************/
+void TFT_Host::write8(uint8_t c) { transfer(c); }
+
+void TFT_Host::write16(uint16_t c)
+{
+  transfer(c >> 8);
+  transfer(c);
+}
+
+void TFT_Host::writePattern(const uint8_t *data, uint8_t size, uint32_t repeat)
+{
+  while (repeat--) {
+    for (uint8_t i = 0; i < size; i++) transfer(data[i]);
+  }
+}
+
+void TFT_Host::writeBytes(const uint8_t *data, uint32_t len)
+{
+  while (len--) transfer(*data++);
+}
+
+uint8_t TFT_Host::read8(void) { return transfer(0); }
+
+
+/***************************************************************************************
+** Function name:           dmaClock
+** Description:             Modelled time in microseconds, the real time plus the time
+**                          the processor would have been stalled waiting for DMA
+***************************************************************************************/
+uint32_t TFT_Host::dmaClock(void)
+{
+  return micros() + dmaStall;
+}
+
+
+/***************************************************************************************
+** Function name:           dmaQueue
+** Description:             Queue a DMA transfer, it starts when the previous one ends
+***************************************************************************************/
+void TFT_Host::dmaQueue(const uint8_t *data, uint32_t len)
+{
+  if (dmaCount == TFT_HOST_DMA_QUEUE) dmaComplete(); // Queue full so block
+
+  uint32_t now = dmaClock();
+  uint32_t busUs = (uint32_t)(((uint64_t)len * 8 * 1000000) / SPI_FREQUENCY);
+
+  if ((int32_t)(dmaLast - now) < 0) dmaLast = now; // Bus was idle
+  dmaLast += busUs;
+
+  uint8_t i = (dmaHead + dmaCount) % TFT_HOST_DMA_QUEUE;
+  dmaData[i] = data;
+  dmaLen[i]  = len;
+  dmaEnd[i]  = dmaLast;
+  dmaCount++;
+
+  stats.dmaTransfers++;
+  stats.dmaBytes += len;
+  stats.dmaBusUs += busUs;
+}
+
+
+/***************************************************************************************
+** Function name:           dmaDone
+** Description:             Return true if the oldest queued transfer has finished
+***************************************************************************************/
+bool TFT_Host::dmaDone(void)
+{
+  if (!dmaCount) return true;
+  return (int32_t)(dmaClock() - dmaEnd[dmaHead]) >= 0;
+}
+
+
+/***************************************************************************************
+** Function name:           dmaComplete
+** Description:             Wait for the oldest queued transfer and clock it out
+***************************************************************************************/
+void TFT_Host::dmaComplete(void)
+{
+  if (!dmaCount) return;
+
+  int32_t wait = (int32_t)(dmaEnd[dmaHead] - dmaClock());
+  if (wait > 0) {
+    stats.dmaStallUs += wait;
+    dmaStall += wait;
+  }
+
+  // The buffer is read now, so changes made while the transfer was queued are seen
+  writeBytes(dmaData[dmaHead], dmaLen[dmaHead]);
+
+  dmaHead = (dmaHead + 1) % TFT_HOST_DMA_QUEUE;
+  dmaCount--;
+}
+
+
+/***************************************************************************************
+** Function name:           transfer
+** Description:             Clock one byte, returns the byte read back from the panel
+***************************************************************************************/
+uint8_t TFT_Host::transfer(uint8_t c)
+{
+  stats.bytes++;
+
+  if (!cs) return 0xFF; // Panel not selected, MISO floats high
+
+  if (!dc) {
+    command(c);
+    return 0;
+  }
+
+  return data(c);
+}
+
+
+/***************************************************************************************
+** Function name:           command
+** Description:             Decode a command byte
+***************************************************************************************/
+void TFT_Host::command(uint8_t c)
+{
+  stats.commands++;
+
+  cmd  = c;
+  argc = 0;
+  msbHeld = false;
+
+  switch (c) {
+    case TFT_CASET:
+      stats.caset++;
+      break;
+    case TFT_PASET:
+      stats.paset++;
+      break;
+    case TFT_RAMWR:
+      stats.ramwr++;
+      cx = xs; cy = ys;
+      break;
+    case TFT_RAMRD:
+      stats.ramrd++;
+      cx = xs; cy = ys;
+      readStep = 0;
+      break;
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           data
+** Description:             Decode a data byte for the current command
+***************************************************************************************/
+uint8_t TFT_Host::data(uint8_t c)
+{
+  switch (cmd) {
+
+    case TFT_CASET:
+    case TFT_PASET:
+      if (argc < 4) args[argc++] = c;
+      if (argc == 4) {
+        uint16_t s = (args[0] << 8) | args[1];
+        uint16_t e = (args[2] << 8) | args[3];
+        if (cmd == TFT_CASET) { xs = s; xe = e; }
+        else                  { ys = s; ye = e; }
+        argc++; // Ignore any further bytes
+      }
+      break;
+
+    case TFT_MADCTL:
+      madctl = c;
+      break;
+
+    case TFT_RAMWR:
+      if (!msbHeld) {
+        args[0] = c;   // Hold MSB of the pixel
+        msbHeld = true;
+      }
+      else {
+        uint16_t *p = pointer();
+        if (p) *p = (args[0] << 8) | c;
+        stats.pixels++;
+        msbHeld = false;
+        advance();
+      }
+      break;
+
+    case TFT_RAMRD:
+      // First byte is a dummy read, then 3 bytes (R, G, B) per pixel
+      if (readStep == 0) { readStep = 1; return 0; }
+      {
+        uint16_t *p = pointer();
+        uint16_t  color = p ? *p : 0;
+        uint8_t   rgb;
+        if      (readStep == 1) rgb = (color >> 8) & 0xF8;
+        else if (readStep == 2) rgb = (color >> 3) & 0xFC;
+        else                    rgb = (color << 3) & 0xF8;
+        if (++readStep > 3) { readStep = 1; advance(); }
+        return rgb;
+      }
+  }
+
+  return 0;
+}
+
+
+/***************************************************************************************
+** Function name:           advance
+** Description:             Step the memory pointer through the address window
+***************************************************************************************/
+void TFT_Host::advance(void)
+{
+  if (cx < xe) { cx++; return; }
+  cx = xs;
+  if (cy < ye) cy++;
+  else cy = ys;
+}
+
+
+/***************************************************************************************
+** Function name:           pointer
+** Description:             Map the memory pointer to GRAM using the MADCTL settings
+***************************************************************************************/
+uint16_t *TFT_Host::pointer(void)
+{
+  int32_t px = cx, py = cy;
+
+  if (madctl & TFT_MAD_MV) { px = cy; py = cx; }
+  if (madctl & TFT_MAD_MX) px = TFT_HOST_GRAM_WIDTH  - 1 - px;
+  if (madctl & TFT_MAD_MY) py = TFT_HOST_GRAM_HEIGHT - 1 - py;
+
+  if ((px < 0) || (px >= TFT_HOST_GRAM_WIDTH) || (py < 0) || (py >= TFT_HOST_GRAM_HEIGHT)) return NULL;
+
+  return &gram[py * TFT_HOST_GRAM_WIDTH + px];
+}
+
+
+/***************************************************************************************
+** Function name:           readGRAM
+** Description:             Return the RGB565 value stored at a native GRAM location
+***************************************************************************************/
+uint16_t TFT_Host::readGRAM(int32_t x, int32_t y)
+{
+  if ((x < 0) || (x >= TFT_HOST_GRAM_WIDTH) || (y < 0) || (y >= TFT_HOST_GRAM_HEIGHT)) return 0;
+  return gram[y * TFT_HOST_GRAM_WIDTH + x];
+}
+
+
+/***************************************************************************************
+** Function name:           checksum
+** Description:             Hash the GRAM contents so rendered frames can be compared
+***************************************************************************************/
+uint32_t TFT_Host::checksum(void)
+{
+  uint32_t hash = 2166136261UL;
+  for (uint32_t i = 0; i < TFT_HOST_GRAM_WIDTH * TFT_HOST_GRAM_HEIGHT; i++) {
+    hash = (hash ^ (gram[i] >> 8))   * 16777619UL;
+    hash = (hash ^ (gram[i] & 0xFF)) * 16777619UL;
+  }
+  return hash;
+}
+
+
+/***************************************************************************************
+** Function name:           savePPM
+** Description:             Save the GRAM as a 24 bit binary PPM image file
+***************************************************************************************/
+bool TFT_Host::savePPM(const char *filename)
+{
+  FILE *f = fopen(filename, "wb");
+  if (!f) return false;
+
+  fprintf(f, "P6\n%d %d\n255\n", TFT_HOST_GRAM_WIDTH, TFT_HOST_GRAM_HEIGHT);
+  for (uint32_t i = 0; i < TFT_HOST_GRAM_WIDTH * TFT_HOST_GRAM_HEIGHT; i++) {
+    uint8_t rgb[3] = { (uint8_t)((gram[i] >> 8) & 0xF8), (uint8_t)((gram[i] >> 3) & 0xFC), (uint8_t)((gram[i] << 3) & 0xF8) };
+    fwrite(rgb, 1, 3, f);
+  }
+  fclose(f);
+  return true;
+}
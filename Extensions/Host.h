@@ -0,0 +1,112 @@
+/***************************************************************************************
+// Host (e.g. Linux PC) transport backend and display panel model
+//
+// This is only used when the library is compiled with TFT_HOST_BACKEND defined, for
+// example by adding -DTFT_HOST_BACKEND to the compiler flags of a host build that
+// provides the Arduino core API (Arduino.h, Print and String). Tools/Host_Test has a
+// minimal one, and the library's regression and pixel tests that use this backend.
+//
+// The DC_C, DC_D, CS_L, CS_H and tft_Write_xx / tft_Read_8 macros in TFT_eSPI.h are
+// then routed here instead of to the SPI peripheral. The command stream is decoded
+// into an in-memory RGB565 copy of the display GRAM and the bus activity is counted.
+// This allows the library to be benchmarked and the rendered output to be compared
+// pixel for pixel without any hardware.
+//
+// The panel model understands CASET, PASET, RAMWR, RAMRD and MADCTL (MX, MY, MV bits),
+// other commands and their parameters are counted but otherwise ignored.
+//
+// DMA transfers (pushColorsDMA and pushRectDMA) are modelled as running in the
+// background at SPI_FREQUENCY, starting when queued. The bytes are clocked into the
+// panel model when the transfer is retired so a buffer changed too early shows up as
+// corrupt pixels just as it would on hardware. The time the processor had to wait for
+// a transfer to finish is counted in dmaStallUs, the rest of dmaBusUs was overlapped.
+***************************************************************************************/
+
+#ifndef _TFT_eSPI_HostH_
+#define _TFT_eSPI_HostH_
+
+// Size of the modelled GRAM in native (rotation 0) orientation
+#if defined (ST7735_DRIVER)
+  #define TFT_HOST_GRAM_WIDTH  132
+  #define TFT_HOST_GRAM_HEIGHT 162
+#else
+  #define TFT_HOST_GRAM_WIDTH  240
+  #define TFT_HOST_GRAM_HEIGHT 320
+#endif
+
+// Maximum number of DMA transfers in the modelled queue
+#define TFT_HOST_DMA_QUEUE 2
+
+// Bus activity counters, zeroed by TFT_Host::clearStats()
+typedef struct {
+  uint32_t bytes;        // Total bytes clocked on the bus (written and read)
+  uint32_t commands;     // Bytes sent with DC low
+  uint32_t caset;        // Column address set commands
+  uint32_t paset;        // Page (row) address set commands
+  uint32_t ramwr;        // Memory write commands
+  uint32_t ramrd;        // Memory read commands
+  uint32_t pixels;       // Pixels written into GRAM
+  uint32_t csToggles;    // CS assertions (high to low transitions)
+  uint32_t transactions; // spi_begin() calls, i.e. SPI bus lock handshakes
+  uint32_t dmaTransfers; // DMA transfers queued
+  uint32_t dmaBytes;     // Bytes sent by DMA (also included in bytes)
+  uint32_t dmaBusUs;     // Modelled bus time of the DMA transfers in microseconds
+  uint32_t dmaStallUs;   // Modelled time spent waiting for DMA transfers to finish
+} TFT_HostStats;
+
+class TFT_Host {
+
+ public:
+
+  static TFT_HostStats stats;
+
+  static void     reset(void),      // Clear GRAM, panel state and counters
+                  clearStats(void); // Clear counters only
+
+                  // Transport entry points used by the macros in TFT_eSPI.h
+  static void     dcLow(void), dcHigh(void),
+                  csLow(void), csHigh(void),
+                  beginTransaction(void),
+                  write8(uint8_t c),
+                  write16(uint16_t c),
+                  writePattern(const uint8_t *data, uint8_t size, uint32_t repeat),
+                  writeBytes(const uint8_t *data, uint32_t len);
+  static uint8_t  read8(void);
+
+                  // DMA model, at most TFT_HOST_DMA_QUEUE transfers can be queued
+  static void     dmaQueue(const uint8_t *data, uint32_t len);
+  static bool     dmaDone(void);     // Oldest queued transfer has finished
+  static void     dmaComplete(void); // Wait for the oldest queued transfer to finish
+
+                  // Panel model access, coordinates are native GRAM column and row
+  static uint16_t readGRAM(int32_t x, int32_t y);
+  static uint32_t checksum(void);                  // FNV-1a hash of whole GRAM
+  static bool     savePPM(const char *filename);   // Write GRAM as a binary PPM image
+
+ private:
+
+  static uint8_t  transfer(uint8_t c);
+  static void     command(uint8_t c);
+  static uint8_t  data(uint8_t c);
+  static void     advance(void);
+  static uint16_t *pointer(void);
+  static uint32_t dmaClock(void);
+
+  static uint16_t gram[TFT_HOST_GRAM_WIDTH * TFT_HOST_GRAM_HEIGHT];
+
+  static bool     dc, cs,            // Pin states, dc true = data, cs true = selected
+                  msbHeld;           // First byte of a RAMWR pixel has been received
+  static uint8_t  cmd, argc, madctl, readStep;
+  static uint8_t  args[4];
+  static uint16_t xs, xe, ys, ye,    // Address window as sent with CASET and PASET
+                  cx, cy;            // Memory pointer inside the window
+
+  static const uint8_t *dmaData[TFT_HOST_DMA_QUEUE];
+  static uint32_t dmaLen[TFT_HOST_DMA_QUEUE],
+                  dmaEnd[TFT_HOST_DMA_QUEUE], // Modelled finish time of each transfer
+                  dmaLast,           // Modelled finish time of the last queued transfer
+                  dmaStall;          // Total stall time, unlike stats not cleared
+  static uint8_t  dmaHead, dmaCount;
+};
+
+#endif
@@ -0,0 +1,432 @@
+/***************************************************************************************
+// The number field class member functions, this file is included by TFT_eSPI.cpp. See
+// NumberField.h for details.
+***************************************************************************************/
+
+/***************************************************************************************
+** Function name:           TFT_eNumberField
+** Description:             Class constructor
+***************************************************************************************/
+TFT_eNumberField::TFT_eNumberField(TFT_eSPI *tft)
+{
+  _tft = tft;
+
+  _x = _y = _w = 0;
+  _datum = TL_DATUM;
+  _font  = 1;
+  _size  = 1;
+  _fg    = TFT_WHITE;
+  _bg    = TFT_BLACK;
+  _fixed = true;
+
+  _gfxFont = NULL;
+  _smooth  = false;
+
+  _drawn = false;
+  _count = 0;
+}
+
+
+/***************************************************************************************
+** Function name:           setPosition
+** Description:             place the field
+***************************************************************************************/
+void TFT_eNumberField::setPosition(int32_t x, int32_t y, int32_t w, uint8_t datum)
+{
+  _x = x;
+  _y = y;
+  _w = w;
+  _datum = datum;
+  _drawn = false;
+}
+
+
+/***************************************************************************************
+** Function name:           setTextFont
+** Description:             use a numbered font
+***************************************************************************************/
+void TFT_eNumberField::setTextFont(uint8_t font)
+{
+  _font = (font > 0) ? font : 1;
+  _gfxFont = NULL;
+  _smooth = false;
+  _drawn = false;
+}
+
+
+#ifdef LOAD_GFXFF
+/***************************************************************************************
+** Function name:           setFreeFont
+** Description:             use a free font
+***************************************************************************************/
+void TFT_eNumberField::setFreeFont(const GFXfont *f)
+{
+  _font = 1;
+  _gfxFont = f;
+  _smooth = false;
+  _drawn = false;
+}
+
+
+/***************************************************************************************
+** Function name:           setSmoothFont
+** Description:             use an anti-aliased font
+***************************************************************************************/
+void TFT_eNumberField::setSmoothFont(const SmoothFont *f)
+{
+  _font = 1;
+  _gfxFont = f;
+  _smooth = true;
+  _drawn = false;
+}
+#endif
+
+
+/***************************************************************************************
+** Function name:           setTextColor
+** Description:             set the text and background colours
+***************************************************************************************/
+void TFT_eNumberField::setTextColor(uint16_t fgcolor, uint16_t bgcolor)
+{
+  _fg = fgcolor;
+  _bg = bgcolor;
+  _drawn = false;
+}
+
+
+/***************************************************************************************
+** Function name:           setTextSize
+** Description:             set the text size multiplier
+***************************************************************************************/
+void TFT_eNumberField::setTextSize(uint8_t size)
+{
+  _size = (size > 0) ? size : 1;
+  _drawn = false;
+}
+
+
+/***************************************************************************************
+** Function name:           setFixedPitch
+** Description:             give the digits cells of equal width
+***************************************************************************************/
+void TFT_eNumberField::setFixedPitch(boolean fixed)
+{
+  _fixed = fixed;
+  _drawn = false;
+}
+
+
+/***************************************************************************************
+** Function name:           redraw
+** Description:             draw the whole field at the next update
+***************************************************************************************/
+void TFT_eNumberField::redraw(void)
+{
+  _drawn = false;
+}
+
+
+/***************************************************************************************
+** Function name:           drawNumber
+** Description:             draw a long integer
+***************************************************************************************/
+void TFT_eNumberField::drawNumber(long number)
+{
+  char str[12];
+  ltoa(number, str, 10);
+  drawString(str);
+}
+
+
+/***************************************************************************************
+** Function name:           drawFloat
+** Description:             draw a float with dp decimal places, as TFT_eSPI::drawFloat()
+***************************************************************************************/
+void TFT_eNumberField::drawFloat(float number, uint8_t dp)
+{
+  char str[14];
+  floatString(str, number, dp);
+  drawString(str);
+}
+
+
+/***************************************************************************************
+** Function name:           saveText
+** Description:             keep the text settings of the TFT and set those of the field
+***************************************************************************************/
+void TFT_eNumberField::saveText(void)
+{
+  _tftFg   = _tft->textcolor;
+  _tftBg   = _tft->textbgcolor;
+  _tftFont = _tft->textfont;
+  _tftSize = _tft->textsize;
+
+#ifdef LOAD_GFXFF
+  _tftGfxFont = _tft->gfxFont;
+  _tftSmooth  = _tft->smoothFont;
+  _tftAb      = _tft->glyph_ab;
+  _tftBb      = _tft->glyph_bb;
+  _tftKern    = _tft->kernPairs;
+  _tftKerns   = _tft->kernCount;
+
+  // These set the glyph heights and turn kerning off
+  if (_gfxFont && _smooth) _tft->setSmoothFont((const SmoothFont *)_gfxFont);
+  else if (_gfxFont) _tft->setFreeFont((const GFXfont *)_gfxFont);
+  else {
+    _tft->gfxFont = NULL;
+    _tft->smoothFont = false;
+  }
+#endif
+
+  _tft->textfont    = _font;
+  _tft->textcolor   = _fg;
+  _tft->textbgcolor = _bg;
+  _tft->textsize    = _size;
+}
+
+
+/***************************************************************************************
+** Function name:           restoreText
+** Description:             put back the text settings of the TFT
+***************************************************************************************/
+void TFT_eNumberField::restoreText(void)
+{
+  _tft->textcolor   = _tftFg;
+  _tft->textbgcolor = _tftBg;
+  _tft->textfont    = _tftFont;
+  _tft->textsize    = _tftSize;
+
+#ifdef LOAD_GFXFF
+  _tft->gfxFont    = _tftGfxFont;
+  _tft->smoothFont = _tftSmooth;
+  _tft->glyph_ab   = _tftAb;
+  _tft->glyph_bb   = _tftBb;
+  _tft->kernPairs  = _tftKern;
+  _tft->kernCount  = _tftKerns;
+#endif
+}
+
+
+/***************************************************************************************
+** Function name:           layout
+** Description:             find the cells of the characters of a string
+***************************************************************************************/
+// The TFT must have the field's text settings. Positions are in pixels from the left
+// of the text, x0 and x1 cover the cell and every pixel the character draws. Characters
+// without a glyph are skipped. Returns the width of the text, the sum of the cells.
+int16_t TFT_eNumberField::layout(const char *string, TFT_FieldChar *chr, uint8_t *count)
+{
+  int32_t ts = _size, x = 0, pitch = 0;
+  uint8_t n = 0;
+
+  // Advance, first and last + 1 column drawn of a character at textsize 1
+  int16_t adv, ink0, ink1;
+  uint16_t c = '0';
+
+  // Look at the digits first for the fixed pitch, then the string
+  boolean digits = _fixed;
+
+  while (digits || *string) {
+    if (digits) {
+      if (c > '9') {
+        digits = false;
+        continue;
+      }
+    }
+#ifdef LOAD_GFXFF
+    else if (_gfxFont) c = _tft->nextChar(&string);
+#endif
+    else c = (uint8_t)*string++;
+
+    if (!_tft->charMetrics(c, _font, &adv, &ink0, &ink1)) { c++; continue; }
+
+    if (digits) {
+      if (adv > pitch) pitch = adv;
+      c++;
+      continue;
+    }
+
+    if (n >= NUMBER_FIELD_CHARS) break;
+
+    int32_t w = adv, gx = x;
+    if (pitch && (c >= '0') && (c <= '9')) {
+      w  = pitch;
+      gx = x + (pitch - adv) / 2; // Centre the digit in its cell
+    }
+
+    chr[n].code = c;
+    chr[n].x    = x * ts;
+    chr[n].w    = w * ts;
+    chr[n].gx   = gx * ts;
+    chr[n].x0   = ((gx + ink0 < x) ? gx + ink0 : x) * ts;
+    chr[n].x1   = ((gx + ink1 > x + w) ? gx + ink1 : x + w) * ts;
+    n++;
+
+    x += w;
+  }
+
+  *count = n;
+  return x * ts;
+}
+
+
+/***************************************************************************************
+** Function name:           drawRun
+** Description:             draw n characters of adjacent cells with their background
+***************************************************************************************/
+// The TFT must have the field's text settings, top is the top of the box, h its height
+// and base the distance from the top to the baseline
+void TFT_eNumberField::drawRun(const TFT_FieldChar *chr, uint8_t n, int32_t top, int32_t h, int32_t base)
+{
+  int32_t ts = _size;
+  int32_t rx = chr[0].x, rw = chr[n - 1].x + chr[n - 1].w - rx;
+
+#ifdef LOAD_GFXFF
+  if (_gfxFont) {
+    // The cells are one background box for the string functions
+    TFT_GlyphPos pos[NUMBER_FIELD_CHARS + 1];
+    for (uint8_t i = 0; i < n; i++) {
+      pos[i].code  = chr[i].code;
+      pos[i].glyph = _tft->glyphIndex(chr[i].code);
+      pos[i].x     = (chr[i].gx - rx) / ts;
+    }
+    pos[n].x = rw / ts;
+
+    int16_t done = _smooth ? _tft->drawSmoothString(pos, n, rx, top + base, rw)
+                           : _tft->drawFreeFontOpaque(pos, n, rx, top + base, rw);
+    if (done >= 0) return;
+
+    // Not enough RAM, clear the cells and draw the glyphs over them
+    _tft->fillRect(rx, top, rw, h, _bg);
+    for (uint8_t i = 0; i < n; i++) _tft->drawChar(chr[i].gx, top + base, chr[i].code, _fg, _bg, ts);
+    return;
+  }
+#endif
+
+  // The numbered fonts draw their own background, only the rest of a cell is filled
+  for (uint8_t i = 0; i < n; i++) {
+    int32_t x = chr[i].x, gx = chr[i].gx;
+    if (gx > x) _tft->fillRect(x, top, gx - x, h, _bg);
+    int32_t dx = _tft->drawChar(chr[i].code, gx, top, _font);
+    if (gx + dx < x + chr[i].w) _tft->fillRect(gx + dx, top, x + chr[i].w - gx - dx, h, _bg);
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           drawString
+** Description:             draw a string in the field, sending only what has changed
+***************************************************************************************/
+void TFT_eNumberField::drawString(const char *string)
+{
+  saveText();
+
+  int32_t ts = _size, h, base; // Box height and baseline below its top
+#ifdef LOAD_GFXFF
+  if (_gfxFont) {
+    h    = (_tft->glyph_ab + _tft->glyph_bb) * ts;
+    base = _tft->glyph_ab * ts;
+  }
+  else
+#endif
+  {
+    h    = pgm_read_byte(&fontdata[_font].height) * ts;
+    base = pgm_read_byte(&fontdata[_font].baseline) * ts;
+  }
+
+  // Place the box with the datum, its horizontal part also aligns the text in the box
+  uint8_t align = _datum % 3;
+  int32_t left = _x, top = _y;
+  if (align == 1) left -= _w / 2;
+  else if (align == 2) left -= _w;
+  switch (_datum / 3) {
+    case 1: top -= h / 2; break; // Middle
+    case 2: top -= h;     break; // Bottom
+    case 3: top -= base;  break; // Baseline
+  }
+
+  TFT_FieldChar chr[NUMBER_FIELD_CHARS];
+  uint8_t  n;
+  int32_t  tw = layout(string, chr, &n);
+  int32_t  tx = left;
+  if (align == 1) tx += (_w - tw) / 2;
+  else if (align == 2) tx += _w - tw;
+
+  for (uint8_t i = 0; i < n; i++) {
+    chr[i].x  += tx;
+    chr[i].gx += tx;
+    chr[i].x0 += tx;
+    chr[i].x1 += tx;
+  }
+
+  boolean changed[NUMBER_FIELD_CHARS], kept[NUMBER_FIELD_CHARS];
+  memset(kept, 0, sizeof(kept));
+
+  _tft->startWrite();
+
+  if (!_drawn) {
+    // Clear the whole box and draw everything
+    _tft->fillRect(left, top, _w, h, _bg);
+    memset(changed, 1, sizeof(changed));
+  }
+  else {
+    // A character is unchanged if the same one is in the same cell and place
+    for (uint8_t i = 0; i < n; i++) {
+      changed[i] = true;
+      for (uint8_t j = 0; j < _count; j++) {
+        if (!kept[j] && (chr[i].code == _chr[j].code) && (chr[i].x == _chr[j].x) &&
+            (chr[i].w == _chr[j].w) && (chr[i].gx == _chr[j].gx)) {
+          changed[i] = false;
+          kept[j] = true;
+          break;
+        }
+      }
+    }
+
+    // Columns of the old characters that have gone, outside the new text they are
+    // filled with the background
+    int32_t s0 = 0x7FFF, s1 = -0x7FFF;
+    for (uint8_t j = 0; j < _count; j++) {
+      if (kept[j]) continue;
+      if (_chr[j].x0 < s0) s0 = _chr[j].x0;
+      if (_chr[j].x1 > s1) s1 = _chr[j].x1;
+    }
+    int32_t f0 = (s1 < tx) ? s1 : tx, f1 = (s0 > tx + tw) ? s0 : tx + tw;
+
+    // Redraw unchanged characters that are drawn over by a change, until none are
+    boolean more = true;
+    while (more) {
+      more = false;
+      for (uint8_t i = 0; i < n; i++) {
+        if (changed[i]) continue;
+        int32_t x0 = chr[i].x0, x1 = chr[i].x1;
+        boolean over = ((x0 < f0) && (x1 > s0)) || ((x1 > f1) && (x0 < s1));
+        for (uint8_t j = 0; !over && (j < _count); j++)
+          over = !kept[j] && (x0 < _chr[j].x1) && (x1 > _chr[j].x0);
+        for (uint8_t j = 0; !over && (j < n); j++)
+          over = changed[j] && (x0 < chr[j].x1) && (x1 > chr[j].x0);
+        if (over) changed[i] = more = true;
+      }
+    }
+
+    if (s0 < f0) _tft->fillRect(s0, top, f0 - s0, h, _bg);
+    if (f1 < s1) _tft->fillRect(f1, top, s1 - f1, h, _bg);
+  }
+
+  // Draw the runs of changed characters
+  for (uint8_t i = 0; i < n; ) {
+    if (!changed[i]) { i++; continue; }
+    uint8_t j = i;
+    while ((j < n) && changed[j]) j++;
+    drawRun(chr + i, j - i, top, h, base);
+    i = j;
+  }
+
+  _tft->endWrite();
+
+  memcpy(_chr, chr, n * sizeof(TFT_FieldChar));
+  _count = n;
+  _drawn = true;
+
+  restoreText();
+}
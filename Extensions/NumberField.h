@@ -0,0 +1,93 @@
+/***************************************************************************************
+// The following class draws a number at a fixed place on the TFT and then updates it
+// by only redrawing the characters that have changed. It is intended for displays of
+// readings that change often but by a few digits at a time, e.g. 12.34 to 12.35 only
+// sends the last digit.
+//
+// The field is a box of the given width, one font high, placed with a datum as for
+// drawString() and the text is aligned in the box by the datum. The box is cleared with
+// the background colour when the field is first drawn and the text then always has a
+// background, so the field is updated without flicker.
+//
+// Each character is drawn in a cell of its x advance. With fixed pitch digits each
+// digit has the cell width of the widest digit and is centred in it, so numbers in a
+// proportional font do not shift as they change. A character is redrawn if it, its
+// cell or its place changes, or if a redrawn neighbour overlaps it. Glyphs that reach
+// above '/' or below 'y' in a free font are not cleared, as with setTextPadding().
+//
+// The text settings of the TFT are not changed, the field has its own font, colours
+// and size. Kerning is not used and the text is not clipped to the box.
+***************************************************************************************/
+
+#ifndef _TFT_eSPI_NumberFieldH_
+#define _TFT_eSPI_NumberFieldH_
+
+#define NUMBER_FIELD_CHARS 14 // Maximum characters in a field, as drawFloat()
+
+// A character drawn in a field, the positions are in pixels on the TFT
+typedef struct {
+  uint16_t code;        // Character code
+  int16_t  x, w;        // Cell
+  int16_t  gx;          // Glyph origin
+  int16_t  x0, x1;      // Columns the character has drawn on, can be wider than the cell
+} TFT_FieldChar;
+
+class TFT_eNumberField {
+
+ public:
+
+  TFT_eNumberField(TFT_eSPI *tft);
+
+           // Place the field, x,y is the datum point (see setTextDatum()) of a box w pixels
+           // wide. Changing a setting redraws the whole field at the next update.
+  void     setPosition(int32_t x, int32_t y, int32_t w, uint8_t datum = TL_DATUM),
+           setTextFont(uint8_t font),
+#ifdef LOAD_GFXFF
+           setFreeFont(const GFXfont *f),
+           setSmoothFont(const SmoothFont *f),
+#endif
+           setTextColor(uint16_t fgcolor, uint16_t bgcolor),
+           setTextSize(uint8_t size),
+           setFixedPitch(boolean fixed), // Give the digits equal cells (default true)
+
+           // Draw the value, only the changed characters are sent to the TFT
+           drawNumber(long number),
+           drawFloat(float number, uint8_t dp),
+           drawString(const char *string),
+
+           // Draw the whole field at the next update, e.g. after the screen is cleared
+           redraw(void);
+
+ private:
+
+  int16_t  layout(const char *string, TFT_FieldChar *chr, uint8_t *count); // Returns the width
+  void     drawRun(const TFT_FieldChar *chr, uint8_t n, int32_t top, int32_t h, int32_t base),
+           saveText(void),
+           restoreText(void);
+
+  TFT_eSPI *_tft;
+
+  int16_t  _x, _y, _w;      // Datum point and box width
+  uint8_t  _datum, _font, _size;
+  uint16_t _fg, _bg;
+  boolean  _fixed;
+  const void *_gfxFont;     // Free or smooth font, NULL for the numbered fonts
+  boolean  _smooth;
+
+  boolean  _drawn;          // The box has been cleared and _chr[] is on the TFT
+  uint8_t  _count;          // Characters in _chr[]
+  TFT_FieldChar _chr[NUMBER_FIELD_CHARS];
+
+  // Text settings of the TFT, kept while the field is drawn
+  uint32_t _tftFg, _tftBg;
+  uint8_t  _tftFont, _tftSize;
+#ifdef LOAD_GFXFF
+  GFXfont *_tftGfxFont;
+  boolean  _tftSmooth;
+  uint8_t  _tftAb, _tftBb;
+  const GFXkern *_tftKern;
+  uint16_t _tftKerns;
+#endif
+};
+
+#endif
@@ -0,0 +1,1233 @@
+/***************************************************************************************
+// The sprite class member functions, this file is included by TFT_eSPI.cpp. See
+// Sprite.h for details.
+***************************************************************************************/
+
+/***************************************************************************************
+** Function name:           TFT_eSprite
+** Description:             Class constructor, tft is the display the sprite is pushed to
+***************************************************************************************/
+TFT_eSprite::TFT_eSprite(TFT_eSPI *tft)
+{
+  _tft  = tft;
+  _img  = NULL;
+  _img8 = NULL;
+  _lut  = NULL;
+  _nib  = NULL;
+
+  _bpp     = 16;
+  _indexed = false;
+
+  _iwidth  = _iheight = _istride = 0;
+  _width   = _height  = 0; // Clips all graphics until the sprite is created
+  _ox = _oy = 0;
+
+  _xs = _ys = _xe = _ye = 0;
+  _xptr = _yptr = 0;
+  _winDirty = true;
+
+  _dirtyOn    = false;
+  _dirtyCount = 0;
+  _writeDepth = 0;
+  _pending    = false;
+
+  _shadow      = NULL;
+  _shadowValid = false;
+  clearDiffStats();
+}
+
+
+/***************************************************************************************
+** Function name:           ~TFT_eSprite
+** Description:             Class destructor, frees the sprite RAM
+***************************************************************************************/
+TFT_eSprite::~TFT_eSprite(void)
+{
+  deleteSprite();
+}
+
+
+/***************************************************************************************
+** Function name:           createSprite
+** Description:             Create a sprite (bitmap) of defined width and height
+***************************************************************************************/
+// Returns a pointer to the pixel buffer, or NULL if there is not enough RAM
+
+void* TFT_eSprite::createSprite(int16_t w, int16_t h)
+{
+  if (_img) deleteSprite();
+
+  if ((w < 1) || (h < 1)) return NULL;
+
+  // Rows start on a byte boundary
+  _istride = ((int32_t)w * _bpp + 7) >> 3;
+
+  // calloc so the sprite starts filled with colour 0
+  _img8 = (uint8_t*) calloc((uint32_t)_istride * h, 1);
+  if (!_img8) return NULL;
+
+  // The colour lookup table, 1 bit sprites also have a table for 4 pixels at a time
+  if (_bpp != 16) {
+    uint16_t entries = (_bpp == 1) ? 2 + 16 * 4 : (1 << _bpp);
+    _lut = (uint16_t*) malloc(entries * sizeof(uint16_t));
+    if (!_lut) { free(_img8); _img8 = NULL; return NULL; }
+    if (_bpp == 1) _nib = _lut + 2;
+    initPalette();
+  }
+
+  _img = (uint16_t*) _img8;
+
+  _iwidth  = _width  = w;
+  _iheight = _height = h;
+  _ox = _oy = 0;
+
+  writeAddrWindow(0, 0, w - 1, h - 1);
+
+  return _img8;
+}
+
+
+/***************************************************************************************
+** Function name:           setColorDepth
+** Description:             Set bits per pixel for colour (1, 4, 8 or 16)
+***************************************************************************************/
+// If the sprite exists it is created again at the new depth, a pointer to the RAM
+// is returned, or NULL if there is not enough
+
+void* TFT_eSprite::setColorDepth(int8_t b)
+{
+  if ((b != 1) && (b != 4) && (b != 8)) b = 16;
+
+  if (b == _bpp) return _img8;
+  _bpp = b;
+
+  if (!_img8) return NULL;
+
+  int32_t w = _iwidth, h = _iheight;
+  deleteSprite();
+  return createSprite(w, h);
+}
+
+
+/***************************************************************************************
+** Function name:           getColorDepth
+** Description:             Return the bits per pixel
+***************************************************************************************/
+int8_t TFT_eSprite::getColorDepth(void)
+{
+  return _bpp;
+}
+
+
+/***************************************************************************************
+** Function name:           initPalette
+** Description:             Fill the colour lookup table with the default colours
+***************************************************************************************/
+// 8 bits: RGB332 expanded to RGB565, 4 bits: the 16 colours of the TFT_ colour list,
+// 1 bit: white on black
+
+void TFT_eSprite::initPalette(void)
+{
+  _indexed = false;
+
+  if (_bpp == 8) {
+    for (uint16_t i = 0; i < 256; i++) {
+      uint16_t r = (i >> 5) & 7, g = (i >> 2) & 7, b = i & 3;
+      uint16_t color = (((r << 2) | (r >> 1)) << 11) | (((g << 3) | g) << 5) | ((b << 3) | (b << 1) | (b >> 1));
+      _lut[i] = (color >> 8) | (color << 8);
+    }
+  }
+  else if (_bpp == 4) {
+    static const uint16_t colors[16] = {
+      TFT_BLACK, TFT_NAVY,  TFT_DARKGREEN, TFT_DARKCYAN, TFT_MAROON, TFT_PURPLE,  TFT_OLIVE,  TFT_LIGHTGREY,
+      TFT_DARKGREY, TFT_BLUE, TFT_GREEN,   TFT_CYAN,     TFT_RED,    TFT_MAGENTA, TFT_YELLOW, TFT_WHITE };
+    for (uint8_t i = 0; i < 16; i++) setPaletteColor(i, colors[i]);
+  }
+  else if (_bpp == 1) setBitmapColor(TFT_WHITE, TFT_BLACK);
+}
+
+
+/***************************************************************************************
+** Function name:           createPalette
+** Description:             Set palette entries 0 to n - 1 from an array of colours
+***************************************************************************************/
+// An 8 bit sprite then uses the colours as palette indexes instead of RGB332
+
+void TFT_eSprite::createPalette(const uint16_t *colors, uint16_t n)
+{
+  if ((_bpp != 4) && (_bpp != 8)) return;
+
+  if (n > (1 << _bpp)) n = 1 << _bpp;
+  for (uint16_t i = 0; i < n; i++) setPaletteColor(i, colors[i]);
+
+  _indexed = true;
+}
+
+
+/***************************************************************************************
+** Function name:           setPaletteColor, getPaletteColor
+** Description:             Set or get the RGB565 colour of one palette entry
+***************************************************************************************/
+void TFT_eSprite::setPaletteColor(uint8_t index, uint16_t color)
+{
+  if (!_lut || (index >= (1 << _bpp))) return;
+
+  _lut[index] = (color >> 8) | (color << 8);
+
+  // Update the 4 pixel patterns of a 1 bit sprite
+  if (_bpp == 1) {
+    for (uint8_t n = 0; n < 16; n++) {
+      for (uint8_t i = 0; i < 4; i++) _nib[n * 4 + i] = _lut[(n >> (3 - i)) & 1];
+    }
+  }
+}
+
+uint16_t TFT_eSprite::getPaletteColor(uint8_t index)
+{
+  if (!_lut || (index >= (1 << _bpp))) return 0;
+
+  uint16_t color = _lut[index];
+  return (color >> 8) | (color << 8);
+}
+
+
+/***************************************************************************************
+** Function name:           setBitmapColor
+** Description:             Set the colours that a 1 bit sprite is pushed with
+***************************************************************************************/
+void TFT_eSprite::setBitmapColor(uint16_t fg, uint16_t bg)
+{
+  if (_bpp != 1) return;
+
+  _lut[0] = (bg >> 8) | (bg << 8);
+  setPaletteColor(1, fg); // Also updates the 4 pixel patterns
+}
+
+
+/***************************************************************************************
+** Function name:           deleteSprite
+** Description:             Delete the sprite to free up memory (RAM)
+***************************************************************************************/
+void TFT_eSprite::deleteSprite(void)
+{
+  deleteShadow();
+
+  if (_img8) free(_img8);
+  if (_lut)  free(_lut);
+  _img  = NULL;
+  _img8 = NULL;
+  _lut  = NULL;
+  _nib  = NULL;
+
+  _istride = 0;
+  _iwidth  = _width  = 0;
+  _iheight = _height = 0;
+  _ox = _oy = 0;
+}
+
+
+/***************************************************************************************
+** Function name:           created
+** Description:             Returns true if the sprite has been created
+***************************************************************************************/
+bool TFT_eSprite::created(void)
+{
+  return _img8 != NULL;
+}
+
+
+/***************************************************************************************
+** Function name:           setCanvas
+** Description:             Make the sprite a window onto a larger drawing area
+***************************************************************************************/
+void TFT_eSprite::setCanvas(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+  if (!_img8) return;
+
+  _ox = x;
+  _oy = y;
+  _width  = w;
+  _height = h;
+}
+
+
+/***************************************************************************************
+** Function name:           pushSprite
+** Description:             Push the whole sprite to the TFT at x, y
+***************************************************************************************/
+void TFT_eSprite::pushSprite(int32_t x, int32_t y)
+{
+  pushSprite(x, y, 0, 0, _iwidth, _iheight);
+  _dirtyCount = 0;
+}
+
+
+/***************************************************************************************
+** Function name:           pushSprite
+** Description:             Push the sprite area sx, sy, sw, sh to the TFT at x, y
+***************************************************************************************/
+// The area is sent as one address window and one stream of pixels, a sprite that
+// is partly off the edges of the TFT is clipped
+
+void TFT_eSprite::pushSprite(int32_t x, int32_t y, int32_t sx, int32_t sy, int32_t sw, int32_t sh)
+{
+  if (!_img8) return;
+
+  // Clip the area to the sprite
+  if (sx < 0) { sw += sx; x -= sx; sx = 0; }
+  if (sy < 0) { sh += sy; y -= sy; sy = 0; }
+  if ((sx + sw) > _iwidth)  sw = _iwidth  - sx;
+  if ((sy + sh) > _iheight) sh = _iheight - sy;
+
+  // Clip the area to the TFT
+  if (x < 0) { sw += x; sx -= x; x = 0; }
+  if (y < 0) { sh += y; sy -= y; y = 0; }
+  if ((x + sw) > _tft->width())  sw = _tft->width()  - x;
+  if ((y + sh) > _tft->height()) sh = _tft->height() - y;
+
+  if ((sw < 1) || (sh < 1)) return;
+
+  _tft->startWrite();
+
+  _tft->writeAddrWindow(x, y, x + sw - 1, y + sh - 1);
+
+  if (_bpp == 16) {
+    uint16_t *ptr = _img + sy * _iwidth + sx;
+
+    // The rows are contiguous in RAM if the full sprite width is pushed
+    if (sw == _iwidth) _tft->pushColors((uint8_t*)ptr, (uint32_t)sw * sh * 2);
+    else {
+      while (sh--) {
+        _tft->pushColors((uint8_t*)ptr, sw * 2);
+        ptr += _iwidth;
+      }
+    }
+  }
+  else {
+    // Expand the pixels to RGB565 a block at a time and send each block
+    uint16_t lineBuf[64];
+
+    for (int32_t row = sy; row < sy + sh; row++) {
+      int32_t px = sx, n = sw;
+      while (n > 0) {
+        int32_t len = (n > 64) ? 64 : n;
+        expandRow(lineBuf, px, row, len);
+        _tft->pushColors((uint8_t*)lineBuf, len * 2);
+        px += len;
+        n  -= len;
+      }
+    }
+  }
+
+  _tft->endWrite();
+}
+
+
+/***************************************************************************************
+** Function name:           setDirtyTracking
+** Description:             Enable or disable recording of the areas drawn
+***************************************************************************************/
+void TFT_eSprite::setDirtyTracking(bool enable)
+{
+  _dirtyOn    = enable;
+  _dirtyCount = 0;
+  _pending    = false;
+}
+
+
+/***************************************************************************************
+** Function name:           markDirty
+** Description:             Add an area to the dirty list
+***************************************************************************************/
+// Inside a startWrite() session the areas are combined and added at endWrite()
+
+void TFT_eSprite::markDirty(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+  if (!_dirtyOn) return;
+
+  // Clip to the sprite
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  if ((x + w) > _iwidth)  w = _iwidth  - x;
+  if ((y + h) > _iheight) h = _iheight - y;
+  if ((w < 1) || (h < 1)) return;
+
+  TFT_DirtyRect r = { (int16_t)x, (int16_t)y, (int16_t)(x + w - 1), (int16_t)(y + h - 1) };
+
+  if (!_writeDepth) { addDirty(r); return; }
+
+  if (!_pending) { _pendingRect = r; _pending = true; return; }
+
+  if (r.x0 < _pendingRect.x0) _pendingRect.x0 = r.x0;
+  if (r.y0 < _pendingRect.y0) _pendingRect.y0 = r.y0;
+  if (r.x1 > _pendingRect.x1) _pendingRect.x1 = r.x1;
+  if (r.y1 > _pendingRect.y1) _pendingRect.y1 = r.y1;
+}
+
+
+/***************************************************************************************
+** Function name:           rectCost
+** Description:             Bus time to push a rectangle in its own window
+***************************************************************************************/
+// In SPI bit periods, the window setup plus 16 bits per pixel
+
+uint32_t TFT_eSprite::rectCost(const TFT_DirtyRect &r)
+{
+  return TFT_WINDOW_COST + 16 * (uint32_t)(r.x1 - r.x0 + 1) * (r.y1 - r.y0 + 1);
+}
+
+
+/***************************************************************************************
+** Function name:           addDirty
+** Description:             Add a clipped rectangle to the dirty list
+***************************************************************************************/
+// The rectangle is merged with any in the list where pushing the bounding box of the
+// two is no slower than pushing them separately. This merges rectangles that overlap
+// a lot or touch along an edge, and small ones close together where the window setup
+// time outweighs the extra pixels. Each merge can make a new merge worthwhile so the
+// list is checked again from the start.
+
+void TFT_eSprite::addDirty(TFT_DirtyRect r)
+{
+  uint8_t i = 0;
+
+  while (i < _dirtyCount) {
+    TFT_DirtyRect u = _dirty[i];
+    if (r.x0 < u.x0) u.x0 = r.x0;
+    if (r.y0 < u.y0) u.y0 = r.y0;
+    if (r.x1 > u.x1) u.x1 = r.x1;
+    if (r.y1 > u.y1) u.y1 = r.y1;
+
+    if (rectCost(u) <= rectCost(r) + rectCost(_dirty[i])) {
+      r = u;
+      _dirty[i] = _dirty[--_dirtyCount];
+      i = 0;
+    }
+    else i++;
+  }
+
+  if (_dirtyCount < TFT_DIRTY_RECTS) { _dirty[_dirtyCount++] = r; return; }
+
+  // The list is full, merge with the rectangle that adds the least bus time
+  uint8_t  best = 0;
+  uint32_t bestCost = 0xFFFFFFFF;
+
+  for (i = 0; i < _dirtyCount; i++) {
+    TFT_DirtyRect u = _dirty[i];
+    if (r.x0 < u.x0) u.x0 = r.x0;
+    if (r.y0 < u.y0) u.y0 = r.y0;
+    if (r.x1 > u.x1) u.x1 = r.x1;
+    if (r.y1 > u.y1) u.y1 = r.y1;
+
+    uint32_t cost = rectCost(u) - rectCost(_dirty[i]);
+    if (cost < bestCost) { bestCost = cost; best = i; }
+  }
+
+  TFT_DirtyRect u = _dirty[best];
+  if (r.x0 < u.x0) u.x0 = r.x0;
+  if (r.y0 < u.y0) u.y0 = r.y0;
+  if (r.x1 > u.x1) u.x1 = r.x1;
+  if (r.y1 > u.y1) u.y1 = r.y1;
+
+  _dirty[best] = _dirty[--_dirtyCount];
+  addDirty(u);
+}
+
+
+/***************************************************************************************
+** Function name:           clearDirty, dirtyCount, dirtyPixels, getDirtyRect
+** Description:             Access to the dirty list
+***************************************************************************************/
+void TFT_eSprite::clearDirty(void)
+{
+  _dirtyCount = 0;
+}
+
+uint8_t TFT_eSprite::dirtyCount(void)
+{
+  return _dirtyCount;
+}
+
+uint32_t TFT_eSprite::dirtyPixels(void)
+{
+  uint32_t pixels = 0;
+
+  for (uint8_t i = 0; i < _dirtyCount; i++)
+    pixels += (uint32_t)(_dirty[i].x1 - _dirty[i].x0 + 1) * (_dirty[i].y1 - _dirty[i].y0 + 1);
+
+  return pixels;
+}
+
+bool TFT_eSprite::getDirtyRect(uint8_t n, TFT_DirtyRect *rect)
+{
+  if (n >= _dirtyCount) return false;
+
+  *rect = _dirty[n];
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           pushDirty
+** Description:             Push only the dirty areas of the sprite to the TFT at x, y
+***************************************************************************************/
+// Each area is sent with its own address window, all in one transaction
+
+void TFT_eSprite::pushDirty(int32_t x, int32_t y)
+{
+  if (!_img8) return;
+
+  _tft->startWrite();
+
+  for (uint8_t i = 0; i < _dirtyCount; i++) {
+    TFT_DirtyRect *r = &_dirty[i];
+    pushSprite(x + r->x0, y + r->y0, r->x0, r->y0, r->x1 - r->x0 + 1, r->y1 - r->y0 + 1);
+  }
+
+  _tft->endWrite();
+
+  _dirtyCount = 0;
+}
+
+
+/***************************************************************************************
+** Function name:           createShadow, deleteShadow
+** Description:             Create or delete the shadow copy used by pushDiff()
+***************************************************************************************/
+void* TFT_eSprite::createShadow(void)
+{
+  if (!_img8) return NULL;
+  if (_shadow) return _shadow;
+
+  _shadow = (uint8_t*) malloc((uint32_t)_istride * _iheight);
+  _shadowValid = false;
+
+  return _shadow;
+}
+
+void TFT_eSprite::deleteShadow(void)
+{
+  if (_shadow) free(_shadow);
+  _shadow = NULL;
+  _shadowValid = false;
+}
+
+
+/***************************************************************************************
+** Function name:           invalidateShadow, clearDiffStats
+** Description:             Send the whole sprite next time, zero the counters
+***************************************************************************************/
+void TFT_eSprite::invalidateShadow(void)
+{
+  _shadowValid = false;
+}
+
+void TFT_eSprite::clearDiffStats(void)
+{
+  diffStats.compared = diffStats.sent = diffStats.skipped = diffStats.runs = 0;
+}
+
+
+/***************************************************************************************
+** Function name:           pushDiff
+** Description:             Push the runs of pixels that differ from the shadow copy
+***************************************************************************************/
+// Each row is compared a byte at a time up to a 32 bit boundary and then a word at a
+// time, the sprite and shadow rows have the same alignment. Unchanged words are skipped
+// quickly, the end of a changed run is found a byte at a time. A gap of unchanged pixels
+// between two runs is sent as well when that takes less time than a new window.
+
+void TFT_eSprite::pushDiff(int32_t x, int32_t y)
+{
+  if (!_img8) return;
+
+  uint32_t pixels = (uint32_t)_iwidth * _iheight;
+  diffStats.compared += pixels;
+
+  if (!_shadow || !_shadowValid) {
+    pushSprite(x, y);
+    diffStats.sent += pixels;
+    diffStats.runs++;
+    if (_shadow) {
+      memcpy(_shadow, _img8, (uint32_t)_istride * _iheight);
+      _shadowValid = true;
+    }
+    return;
+  }
+
+  uint32_t sent = diffStats.sent;
+  int32_t  maxGap = TFT_WINDOW_COST / 16; // Longest gap in pixels that is sent
+
+  _tft->startWrite();
+
+  for (int32_t row = 0; row < _iheight; row++) {
+    uint8_t *a = _img8   + row * _istride;
+    uint8_t *b = _shadow + row * _istride;
+    int32_t  i = 0, rs = -1, re = 0;
+
+    while (1) {
+      // Find the next changed byte
+      while ((i < _istride) && (((uintptr_t)(a + i)) & 3) && (a[i] == b[i])) i++;
+      if ((i < _istride) && !(((uintptr_t)(a + i)) & 3)) {
+        while ((i + 4 <= _istride) && (*(uint32_t*)(a + i) == *(uint32_t*)(b + i))) i += 4;
+        while ((i < _istride) && (a[i] == b[i])) i++;
+      }
+      if (i >= _istride) break;
+
+      // Find the end of the changed bytes
+      int32_t j = i + 1;
+      while ((j < _istride) && (a[j] != b[j])) j++;
+
+      // Convert to pixels
+      int32_t xs = (i * 8) / _bpp;
+      int32_t xe = (j * 8 + _bpp - 1) / _bpp;
+      if (xe > _iwidth) xe = _iwidth;
+
+      if ((rs >= 0) && (xs - re <= maxGap)) re = xe;
+      else {
+        if (rs >= 0) pushRun(x, y, row, rs, re);
+        rs = xs;
+        re = xe;
+      }
+
+      i = j;
+    }
+
+    if (rs >= 0) pushRun(x, y, row, rs, re);
+  }
+
+  _tft->endWrite();
+
+  diffStats.skipped += pixels - (diffStats.sent - sent);
+}
+
+
+/***************************************************************************************
+** Function name:           pushRun
+** Description:             Push pixels xs to xe - 1 of a row and update the shadow
+***************************************************************************************/
+void TFT_eSprite::pushRun(int32_t x, int32_t y, int32_t row, int32_t xs, int32_t xe)
+{
+  pushSprite(x + xs, y + row, xs, row, xe - xs, 1);
+
+  int32_t b0 = (xs * _bpp) >> 3;
+  int32_t b1 = (xe * _bpp + 7) >> 3;
+  memcpy(_shadow + row * _istride + b0, _img8 + row * _istride + b0, b1 - b0);
+
+  diffStats.sent += xe - xs;
+  diffStats.runs++;
+}
+
+
+/***************************************************************************************
+** Function name:           expandRow
+** Description:             Convert n pixels from x, y to byte swapped RGB565 colours
+***************************************************************************************/
+// The whole bytes of 1 and 4 bit sprites are converted with one table lookup per 4
+// or 2 pixels
+
+void TFT_eSprite::expandRow(uint16_t *out, int32_t x, int32_t y, int32_t n)
+{
+  uint8_t *ptr = _img8 + y * _istride;
+
+  if (_bpp == 16) {
+    memcpy(out, _img + y * _iwidth + x, n * 2);
+  }
+  else if (_bpp == 8) {
+    ptr += x;
+    while (n--) *out++ = _lut[*ptr++];
+  }
+  else if (_bpp == 4) {
+    ptr += x >> 1;
+    if ((x & 1) && n) { *out++ = _lut[*ptr++ & 0x0F]; n--; }
+    while (n >= 2) {
+      uint8_t b = *ptr++;
+      out[0] = _lut[b >> 4];
+      out[1] = _lut[b & 0x0F];
+      out += 2;
+      n   -= 2;
+    }
+    if (n) *out = _lut[*ptr >> 4];
+  }
+  else {
+    ptr += x >> 3;
+    // Leading pixels up to a byte boundary
+    while ((x & 7) && n) { *out++ = _lut[(*ptr >> (7 - (x & 7))) & 1]; x++; n--; if (!(x & 7)) ptr++; }
+    while (n >= 8) {
+      uint8_t  b = *ptr++;
+      uint16_t *t = _nib + ((b >> 4) << 2);
+      out[0] = t[0]; out[1] = t[1]; out[2] = t[2]; out[3] = t[3];
+      t = _nib + ((b & 0x0F) << 2);
+      out[4] = t[0]; out[5] = t[1]; out[6] = t[2]; out[7] = t[3];
+      out += 8;
+      n   -= 8;
+    }
+    // Trailing pixels
+    for (uint8_t i = 0; i < n; i++) *out++ = _lut[(*ptr >> (7 - i)) & 1];
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           mapColor
+** Description:             Convert a colour to the value stored in the sprite
+***************************************************************************************/
+uint32_t TFT_eSprite::mapColor(uint32_t color)
+{
+  color &= 0xFFFF; // As the TFT, only the low 16 bits are used
+
+  if (_bpp == 16) return ((color >> 8) & 0xFF) | ((color << 8) & 0xFF00);
+  if (_bpp == 8) {
+    if (_indexed) return color & 0xFF;
+    return ((color & 0xE000) >> 8) | ((color & 0x0700) >> 6) | ((color & 0x0018) >> 3);
+  }
+  if (_bpp == 4) return color & 0x0F;
+  return color ? 1 : 0;
+}
+
+
+/***************************************************************************************
+** Function name:           putPixel
+** Description:             Store a pixel value, x and y must be inside the sprite
+***************************************************************************************/
+void TFT_eSprite::putPixel(int32_t x, int32_t y, uint32_t value)
+{
+  if (_bpp == 16) { _img[x + y * _iwidth] = value; return; }
+
+  uint8_t *ptr = _img8 + y * _istride;
+
+  if (_bpp == 8) ptr[x] = value;
+  else if (_bpp == 4) {
+    ptr += x >> 1;
+    if (x & 1) *ptr = (*ptr & 0xF0) | value;
+    else       *ptr = (*ptr & 0x0F) | (value << 4);
+  }
+  else {
+    ptr += x >> 3;
+    uint8_t mask = 0x80 >> (x & 7);
+    if (value) *ptr |= mask;
+    else       *ptr &= ~mask;
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           fillSpan
+** Description:             Store a value in w pixels from x, y, the span must be inside
+***************************************************************************************/
+void TFT_eSprite::fillSpan(int32_t x, int32_t y, int32_t w, uint32_t value)
+{
+  if (_bpp == 16) {
+    uint16_t *ptr = _img + y * _iwidth + x;
+    while (w--) *ptr++ = value;
+    return;
+  }
+
+  uint8_t *ptr = _img8 + y * _istride;
+
+  if (_bpp == 8) { memset(ptr + x, value, w); return; }
+
+  if (_bpp == 4) {
+    if ((x & 1) && w) { putPixel(x++, y, value); w--; }
+    memset(ptr + (x >> 1), value | (value << 4), w >> 1);
+    if (w & 1) putPixel(x + w - 1, y, value);
+    return;
+  }
+
+  // 1 bit, pixels up to a byte boundary, whole bytes, then the remaining pixels
+  while ((x & 7) && w) { putPixel(x++, y, value); w--; }
+  memset(ptr + (x >> 3), value ? 0xFF : 0x00, w >> 3);
+  x += w & ~7;
+  w &= 7;
+  while (w--) putPixel(x++, y, value);
+}
+
+
+/***************************************************************************************
+** Function name:           fillSprite
+** Description:             Fill the whole sprite with a colour
+***************************************************************************************/
+void TFT_eSprite::fillSprite(uint32_t color)
+{
+  writeFillRect(_ox, _oy, _iwidth, _iheight, color);
+}
+
+
+/***************************************************************************************
+** Function name:           startWrite, endWrite
+** Description:             Group graphics calls into one dirty rectangle
+***************************************************************************************/
+void TFT_eSprite::startWrite(void)
+{
+  _writeDepth++;
+}
+
+void TFT_eSprite::endWrite(void)
+{
+  if (_writeDepth) _writeDepth--;
+
+  // The area drawn in the session is one dirty rectangle
+  if (!_writeDepth && _pending) {
+    _pending = false;
+    addDirty(_pendingRect);
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           setWindow, setAddrWindow, writeAddrWindow
+** Description:             Define an area to receive a stream of pixels
+***************************************************************************************/
+void TFT_eSprite::setWindow(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+  writeAddrWindow(x0, y0, x1, y1);
+}
+
+void TFT_eSprite::setAddrWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+{
+  writeAddrWindow(x0, y0, x1, y1);
+}
+
+void TFT_eSprite::writeAddrWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+{
+  _xs = x0;
+  _ys = y0;
+  _xe = x1;
+  _ye = y1;
+
+  _xptr = _xs;
+  _yptr = _ys;
+
+  _winDirty = false;
+}
+
+
+/***************************************************************************************
+** Function name:           pushWindow
+** Description:             Store a pixel value at the window pointer and advance
+***************************************************************************************/
+// The pointer steps through the window and wraps back to the start, like the TFT
+
+void TFT_eSprite::pushWindow(uint32_t value)
+{
+  if (!_winDirty) {
+    markDirty(_xs - _ox, _ys - _oy, _xe - _xs + 1, _ye - _ys + 1);
+    _winDirty = true;
+  }
+
+  int32_t x = _xptr - _ox, y = _yptr - _oy;
+
+  if ((x >= 0) && (x < _iwidth) && (y >= 0) && (y < _iheight))
+    putPixel(x, y, value);
+
+  if (_xptr < _xe) { _xptr++; return; }
+
+  _xptr = _xs;
+  if (_yptr < _ye) _yptr++;
+  else _yptr = _ys;
+}
+
+
+/***************************************************************************************
+** Function name:           pushColor
+** Description:             Push a single pixel into the window
+***************************************************************************************/
+void TFT_eSprite::pushColor(uint16_t color)
+{
+  pushWindow(mapColor(color));
+}
+
+
+/***************************************************************************************
+** Function name:           pushColor
+** Description:             Push a single colour to "len" pixels in the window
+***************************************************************************************/
+void TFT_eSprite::pushColor(uint16_t color, uint16_t len)
+{
+  uint32_t value = mapColor(color);
+
+  while (len--) pushWindow(value);
+}
+
+
+/***************************************************************************************
+** Function name:           pushColors
+** Description:             Push an array of pixels into the window
+***************************************************************************************/
+void TFT_eSprite::pushColors(uint16_t *data, uint8_t len)
+{
+  while (len--) pushWindow(mapColor(*data++));
+}
+
+
+/***************************************************************************************
+** Function name:           pushColors
+** Description:             Push an array of pixels in TFT byte order into the window
+***************************************************************************************/
+// len is the number of bytes
+
+void TFT_eSprite::pushColors(uint8_t *data, uint32_t len)
+{
+  while (len > 1) {
+    pushWindow(mapColor((data[0] << 8) | data[1]));
+    data += 2;
+    len  -= 2;
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           pushRect
+** Description:             Copy a block of pixels into the sprite
+***************************************************************************************/
+// The data uses the same byte order as TFT_eSPI::pushRect()
+
+void TFT_eSprite::pushRect(uint32_t x0, uint32_t y0, uint32_t w, uint32_t h, uint16_t *data)
+{
+  // Clip to the sprite, in sprite RAM coordinates
+  int32_t x = (int32_t)x0 - _ox, y = (int32_t)y0 - _oy;
+  int32_t dw = w, dh = h;
+
+  if (x < 0) { dw += x; data -= x; x = 0; }
+  if (y < 0) { dh += y; data -= y * (int32_t)w; y = 0; }
+  if ((x + dw) > _iwidth)  dw = _iwidth  - x;
+  if ((y + dh) > _iheight) dh = _iheight - y;
+  if ((dw < 1) || (dh < 1)) return;
+
+  markDirty(x, y, dw, dh);
+
+  if (_bpp == 16) {
+    uint16_t *ptr = _img + y * _iwidth + x;
+
+    while (dh--) {
+      memcpy(ptr, data, dw * 2);
+      ptr  += _iwidth;
+      data += w;
+    }
+    return;
+  }
+
+  for (int32_t j = 0; j < dh; j++) {
+    for (int32_t i = 0; i < dw; i++) {
+      uint16_t color = data[i];
+      putPixel(x + i, y + j, mapColor((color >> 8) | (color << 8)));
+    }
+    data += w;
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           readRect
+** Description:             Copy a block of pixels out of the sprite
+***************************************************************************************/
+// The data uses the same byte order as TFT_eSPI::readRect(), pixels outside the
+// sprite are not written
+
+void TFT_eSprite::readRect(uint32_t x0, uint32_t y0, uint32_t w, uint32_t h, uint16_t *data)
+{
+  // Clip to the sprite, in sprite RAM coordinates
+  int32_t x = (int32_t)x0 - _ox, y = (int32_t)y0 - _oy;
+  int32_t dw = w, dh = h;
+
+  if (x < 0) { dw += x; data -= x; x = 0; }
+  if (y < 0) { dh += y; data -= y * (int32_t)w; y = 0; }
+  if ((x + dw) > _iwidth)  dw = _iwidth  - x;
+  if ((y + dh) > _iheight) dh = _iheight - y;
+  if ((dw < 1) || (dh < 1)) return;
+
+  for (int32_t j = 0; j < dh; j++) {
+    expandRow(data, x, y + j, dw);
+    data += w;
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           readPixel
+** Description:             Read the 565 colour of a pixel in the sprite
+***************************************************************************************/
+uint16_t TFT_eSprite::readPixel(int32_t x, int32_t y)
+{
+  x -= _ox;
+  y -= _oy;
+
+  if ((x < 0) || (x >= _iwidth) || (y < 0) || (y >= _iheight)) return 0;
+
+  uint16_t color;
+  expandRow(&color, x, y, 1);
+  return (color >> 8) | (color << 8);
+}
+
+
+/***************************************************************************************
+** Function name:           drawPixel, writePixel
+** Description:             Draw a pixel in the sprite
+***************************************************************************************/
+void TFT_eSprite::drawPixel(uint32_t x, uint32_t y, uint32_t color)
+{
+  writePixel(x, y, color);
+}
+
+void TFT_eSprite::writePixel(uint32_t x, uint32_t y, uint32_t color)
+{
+  x -= _ox;
+  y -= _oy;
+
+  // Faster range checking, possible because x and y are unsigned
+  if ((x >= (uint32_t)_iwidth) || (y >= (uint32_t)_iheight)) return;
+
+  markDirty(x, y, 1, 1);
+
+  putPixel(x, y, mapColor(color));
+}
+
+
+/***************************************************************************************
+** Function name:           drawFastVLine, writeFastVLine
+** Description:             Draw a vertical line in the sprite
+***************************************************************************************/
+void TFT_eSprite::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color)
+{
+  writeFillRect(x, y, 1, h, color);
+}
+
+void TFT_eSprite::writeFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color)
+{
+  writeFillRect(x, y, 1, h, color);
+}
+
+
+/***************************************************************************************
+** Function name:           drawFastHLine, writeFastHLine
+** Description:             Draw a horizontal line in the sprite
+***************************************************************************************/
+void TFT_eSprite::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color)
+{
+  writeFillRect(x, y, w, 1, color);
+}
+
+void TFT_eSprite::writeFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color)
+{
+  writeFillRect(x, y, w, 1, color);
+}
+
+
+/***************************************************************************************
+** Function name:           fillRect, writeFillRect
+** Description:             Draw a filled rectangle in the sprite
+***************************************************************************************/
+void TFT_eSprite::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+  writeFillRect(x, y, w, h, color);
+}
+
+void TFT_eSprite::writeFillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+  x -= _ox;
+  y -= _oy;
+
+  // Clip to the sprite
+  if ((x >= _iwidth) || (y >= _iheight)) return;
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  if ((x + w) > _iwidth)  w = _iwidth  - x;
+  if ((y + h) > _iheight) h = _iheight - y;
+  if ((w < 1) || (h < 1)) return;
+
+  markDirty(x, y, w, h);
+
+  uint32_t value = mapColor(color);
+
+  while (h--) fillSpan(x, y++, w, value);
+}
+
+
+/***************************************************************************************
+** Function name:           drawLine
+** Description:             Draw a line between 2 arbitrary points in the sprite
+***************************************************************************************/
+// Same algorithm as the generic TFT_eSPI::drawLine() so lines look the same
+
+void TFT_eSprite::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color)
+{
+  boolean steep = abs(y1 - y0) > abs(x1 - x0);
+  if (steep) {
+    swap(x0, y0);
+    swap(x1, y1);
+  }
+
+  if (x0 > x1) {
+    swap(x0, x1);
+    swap(y0, y1);
+  }
+
+  int32_t dx = x1 - x0, dy = abs(y1 - y0);
+
+  int32_t err = dx >> 1, ystep = -1, xs = x0, dlen = 0;
+
+  if (y0 < y1) ystep = 1;
+
+  startWrite(); // The line is one dirty rectangle
+
+  // Split into steep and not steep for FastH/V separation
+  if (steep) {
+    for (; x0 <= x1; x0++) {
+      dlen++;
+      err -= dy;
+      if (err < 0) {
+        err += dx;
+        writeFillRect(y0, xs, 1, dlen, color);
+        dlen = 0; y0 += ystep; xs = x0 + 1;
+      }
+    }
+    if (dlen) writeFillRect(y0, xs, 1, dlen, color);
+  }
+  else
+  {
+    for (; x0 <= x1; x0++) {
+      dlen++;
+      err -= dy;
+      if (err < 0) {
+        err += dx;
+        writeFillRect(xs, y0, dlen, 1, color);
+        dlen = 0; y0 += ystep; xs = x0 + 1;
+      }
+    }
+    if (dlen) writeFillRect(xs, y0, dlen, 1, color);
+  }
+
+  endWrite();
+}
+
+
+/***************************************************************************************
+** Function name:           drawChar
+** Description:             Draw a single character in the GLCD or GFXFF font
+***************************************************************************************/
+// Only the size 1 GLCD font with a background is written directly, the other cases
+// are drawn by TFT_eSPI::drawChar() using the sprite primitives
+
+void TFT_eSprite::drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size)
+{
+#ifdef LOAD_GLCD
+  #ifdef LOAD_GFXFF
+  if (!gfxFont && (size == 1) && (bg != color))
+  #else
+  if ((size == 1) && (bg != color))
+  #endif
+  {
+    x -= _ox;
+    y -= _oy;
+
+    if ((x >= _iwidth) || (y >= _iheight) || ((x + 5) < 0) || ((y + 7) < 0)) return;
+
+    uint32_t fg = mapColor(color);
+    uint32_t bk = mapColor(bg);
+
+    markDirty(x, y, 6, 8);
+
+    for (int8_t i = 0; i < 6; i++ ) {
+      uint8_t line = (i == 5) ? 0 : pgm_read_byte(font + (c * 5) + i);
+      int32_t px = x + i;
+
+      if ((px >= 0) && (px < _iwidth)) {
+        for (int8_t j = 0; j < 8; j++) {
+          int32_t py = y + j;
+          if ((py >= 0) && (py < _iheight)) putPixel(px, py, (line & 0x1) ? fg : bk);
+          line >>= 1;
+        }
+      }
+    }
+    return;
+  }
+#endif
+
+  TFT_eSPI::drawChar(x, y, c, color, bg, size);
+}
+
+
+/***************************************************************************************
+** Function name:           drawChar
+** Description:             Draw a unicode character in the sprite
+***************************************************************************************/
+// Font 2 with a background at size 1 and the RLE fonts are decoded straight into the
+// sprite, other cases are drawn by TFT_eSPI::drawChar() using the sprite primitives
+
+int16_t TFT_eSprite::drawChar(unsigned int uniCode, int x, int y, int font)
+{
+  boolean fillbg = (textcolor != textbgcolor);
+
+#ifdef LOAD_FONT2
+  if ((font == 2) && fillbg && (textsize == 1))
+  {
+    uniCode -= 32;
+    uintptr_t flash_address = pgm_read_dword(&chrtbl_f16[uniCode]);
+    int width  = pgm_read_byte(widtbl_f16 + uniCode);
+    int height = chr_hgt_f16;
+    int w = (width + 6) / 8; // Width in whole bytes, as TFT_eSPI::drawChar()
+
+    if (x + width >= (int32_t)_width) return width; // As TFT_eSPI::drawChar()
+
+    x -= _ox;
+    y -= _oy;
+
+    uint32_t fg = mapColor(textcolor);
+    uint32_t bg = mapColor(textbgcolor);
+
+    markDirty(x, y, w * 8, height);
+
+    for (int i = 0; i < height; i++)
+    {
+      int32_t py = y + i;
+      if ((py < 0) || (py >= _iheight)) continue;
+
+      for (int k = 0; k < w; k++)
+      {
+        uint8_t line = pgm_read_byte(flash_address + w * i + k);
+        int32_t px = x + k * 8;
+        for (uint8_t mask = 0x80; mask; mask >>= 1, px++) {
+          if ((px >= 0) && (px < _iwidth)) putPixel(px, py, (line & mask) ? fg : bg);
+        }
+      }
+    }
+    return width;
+  }
+#endif
+
+#ifdef LOAD_RLE
+  if ((font > 2) && (font < 9))
+  {
+    uniCode -= 32;
+    uintptr_t flash_address = pgm_read_dword( pgm_read_dword( &(fontdata[font].chartbl ) ) + uniCode*sizeof(void *) );
+    int width  = pgm_read_byte( pgm_read_dword( &(fontdata[font].widthtbl ) ) + uniCode );
+    int height = pgm_read_byte( &fontdata[font].height );
+
+    // Each RLE byte is a run of up to 128 foreground (bit 7 set) or background
+    // pixels, the runs are split at the end of each character row and drawn as
+    // horizontal spans, textsize high
+    int32_t pc = 0, px = 0, py = 0, total = width * height;
+    int32_t ts = textsize;
+
+    while (pc < total)
+    {
+      uint8_t line = pgm_read_byte(flash_address++);
+      boolean fg  = line & 0x80;
+      int32_t len = (line & 0x7F) + 1;
+      pc += len;
+
+      while (len > 0) {
+        int32_t run = width - px;
+        if (run > len) run = len;
+        if (fg || fillbg) writeFillRect(x + px * ts, y + py * ts, run * ts, ts, fg ? textcolor : textbgcolor);
+        len -= run;
+        px  += run;
+        if (px >= width) { px = 0; py++; }
+      }
+    }
+    return width * textsize;
+  }
+#endif
+
+  return TFT_eSPI::drawChar(uniCode, x, y, font);
+}
@@ -0,0 +1,243 @@
+/***************************************************************************************
+// The following class creates Sprites in RAM, graphics can then be drawn in the Sprite
+// and rendered quickly onto the TFT screen. The class inherits the graphics functions
+// from the TFT_eSPI class. The virtual functions of TFT_eSPI are overridden here so
+// all graphics, including text in every font, are drawn in the Sprite instead of on
+// the TFT.
+//
+// A Sprite is pushed to the TFT with a single address window and one stream of pixels
+// so an update appears in one go without flicker. Typical uses are meter needles,
+// scrolling graphs and clock faces that are redrawn in the Sprite and then pushed.
+//
+// A 16 bit Sprite needs width * height * 2 bytes of RAM. The pixels are stored with
+// the bytes in the order they are sent to the TFT, the same as readRect() and
+// pushRect() use, so the Sprite can be pushed without conversion.
+//
+// To save RAM the colour depth can be reduced with setColorDepth() before the Sprite
+// is created, so a full screen Sprite fits in the RAM of an ESP8266:
+//
+//   16 bits per pixel, RGB565 colours
+//    8 bits per pixel, colours are reduced to RGB332, or are palette indexes (0-255)
+//      once a palette has been set with createPalette()
+//    4 bits per pixel, colours are palette indexes (0-15) into a 16 colour palette
+//    1 bit  per pixel, colour 0 is drawn with the background colour and any other
+//      value with the foreground colour set by setBitmapColor()
+//
+// Rows start on a byte boundary. Reduced depth pixels are expanded to RGB565 through a
+// lookup table as they are pushed to the TFT, so pushSprite() runs close to the speed
+// of a 16 bit push. The data for pushColor(), pushColors() and pushRect() is mapped
+// to the Sprite colour depth in the same way as the colours of the graphics functions,
+// readRect() and readPixel() always return RGB565 colours.
+//
+// Sprites do not support setRotation(), draw the graphics in the Sprite rotated instead.
+//
+// When dirty rectangle tracking is enabled with setDirtyTracking(true) the bounding box
+// of every graphics call is recorded, the area drawn between startWrite() and endWrite()
+// counts as one call (e.g. a whole drawString()). Boxes are merged when sending their
+// bounding box would take less bus time than sending them separately, each separate
+// window costs TFT_WINDOW_COST bit periods on top of 16 per pixel. pushDirty() then
+// pushes only the recorded areas, so an unchanged background is not sent again.
+//
+// For widgets that are redrawn completely each time a shadow copy of the Sprite as it
+// was last pushed can be kept with createShadow(), this doubles the RAM used. pushDiff()
+// compares the Sprite with the shadow 32 bits at a time and sends only the horizontal
+// runs of changed pixels. Runs on a row separated by a gap that is quicker to send than
+// a new window (TFT_WINDOW_COST) are sent as one run.
+***************************************************************************************/
+
+#ifndef _TFT_eSPI_SpriteH_
+#define _TFT_eSPI_SpriteH_
+
+// Maximum number of dirty rectangles, when the list is full a new area is merged with
+// the rectangle that adds the least bus time
+#ifndef TFT_DIRTY_RECTS
+  #define TFT_DIRTY_RECTS 8
+#endif
+
+// Processor, CS and DC switching time of setting an address window in nanoseconds
+#ifndef TFT_WINDOW_OVERHEAD_NS
+  #define TFT_WINDOW_OVERHEAD_NS 2000
+#endif
+
+// Bus time of setting an address window in SPI bit periods: CASET, PASET and RAMWR
+// with their 8 parameter bytes, plus the overhead above at SPI_FREQUENCY
+#define TFT_WINDOW_COST (11 * 8 + (uint32_t)((uint64_t)TFT_WINDOW_OVERHEAD_NS * (SPI_FREQUENCY / 1000) / 1000000))
+
+// A dirty rectangle, corners are inclusive
+typedef struct {
+  int16_t x0, y0, x1, y1;
+} TFT_DirtyRect;
+
+// pushDiff() counters, zeroed by clearDiffStats()
+typedef struct {
+  uint32_t compared; // Pixels compared with the shadow
+  uint32_t sent;     // Pixels sent, including unchanged pixels in coalesced gaps
+  uint32_t skipped;  // Pixels not sent
+  uint32_t runs;     // Runs sent, each with its own address window
+} TFT_DiffStats;
+
+class TFT_eSprite : public TFT_eSPI {
+
+ public:
+
+  TFT_eSprite(TFT_eSPI *tft);
+  ~TFT_eSprite(void);
+
+           // Create a sprite of width x height pixels, return a pointer to the RAM used,
+           // or NULL if there is not enough free RAM. The sprite is filled with colour 0
+           // (black with the default palette).
+  void*    createSprite(int16_t width, int16_t height);
+
+           // Set the colour depth to 1, 4, 8 or 16 (default) bits per pixel. A sprite
+           // that has been created is created again at the new depth, which clears it.
+  void*    setColorDepth(int8_t bpp);
+  int8_t   getColorDepth(void);
+
+           // Set palette entries 0 to n - 1 to the RGB565 colours in the array, for 4 and
+           // 8 bit sprites. Call after createSprite(), an 8 bit sprite then uses indexes.
+  void     createPalette(const uint16_t *colors, uint16_t n),
+           setPaletteColor(uint8_t index, uint16_t color),
+
+           // Set the foreground and background colours a 1 bit sprite is pushed with
+           setBitmapColor(uint16_t fg, uint16_t bg);
+
+  uint16_t getPaletteColor(uint8_t index);
+
+           // Delete the sprite to free up the RAM
+  void     deleteSprite(void);
+
+           // Make the sprite a window onto a larger w x h drawing area, e.g. a strip of
+           // the screen. Graphics coordinates are then those of the drawing area, the
+           // sprite holds the pixels from x,y and everything else is clipped. width()
+           // and height() return w and h, so text is positioned as on the whole area.
+           // createSprite() sets x,y to 0,0 and w,h to the sprite size. pushSprite()
+           // and the dirty list still use sprite RAM coordinates.
+  void     setCanvas(int32_t x, int32_t y, int32_t w, int32_t h);
+
+           // Returns true if the sprite has been created
+  bool     created(void);
+
+  void     fillSprite(uint32_t color),
+
+           // Push the whole sprite to the TFT with the top left corner at x,y
+           pushSprite(int32_t x, int32_t y),
+
+           // Push the area sx,sy,sw,sh of the sprite to the TFT with the top left
+           // corner at x,y, e.g. only the part that has changed
+           pushSprite(int32_t x, int32_t y, int32_t sx, int32_t sy, int32_t sw, int32_t sh),
+
+           // Enable or disable dirty rectangle tracking, either clears the dirty list
+           setDirtyTracking(bool enable),
+
+           // Add an area to the dirty list, e.g. after changing the sprite RAM directly
+           markDirty(int32_t x, int32_t y, int32_t w, int32_t h),
+           clearDirty(void),
+
+           // Push the dirty areas of the sprite at x,y in one transaction and clear the
+           // list. Pushing the whole sprite also clears the list.
+           pushDirty(int32_t x, int32_t y);
+
+           // Number of dirty rectangles and their total area in pixels
+  uint8_t  dirtyCount(void);
+  uint32_t dirtyPixels(void);
+
+           // Copy dirty rectangle n, returns false if n >= dirtyCount()
+  bool     getDirtyRect(uint8_t n, TFT_DirtyRect *rect);
+
+           // Create a shadow copy for pushDiff(), return a pointer to the RAM used, or
+           // NULL if there is not enough. The shadow is deleted with the sprite.
+  void*    createShadow(void);
+  void     deleteShadow(void),
+
+           // Push the pixels that changed since the last pushDiff() at x,y, the first
+           // push after createShadow() or invalidateShadow() sends the whole sprite
+           pushDiff(int32_t x, int32_t y),
+
+           // Force the next pushDiff() to send the whole sprite, e.g. if the TFT has
+           // been drawn on directly
+           invalidateShadow(void),
+           clearDiffStats(void);
+
+  TFT_DiffStats diffStats;
+
+           // The overridden TFT_eSPI functions
+  void     drawPixel(uint32_t x, uint32_t y, uint32_t color),
+
+           startWrite(void),
+           endWrite(void),
+
+           writePixel(uint32_t x, uint32_t y, uint32_t color),
+           writeFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color),
+           writeFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color),
+           writeFillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color),
+           writeAddrWindow(int32_t xs, int32_t ys, int32_t xe, int32_t ye),
+
+           drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t font),
+           setWindow(int16_t x0, int16_t y0, int16_t x1, int16_t y1),
+           setAddrWindow(int32_t xs, int32_t ys, int32_t xe, int32_t ye),
+
+           pushColor(uint16_t color),
+           pushColor(uint16_t color, uint16_t len),
+
+           pushColors(uint16_t *data, uint8_t len),
+           pushColors(uint8_t  *data, uint32_t len),
+
+           drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color),
+           drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color),
+           drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color),
+           fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color),
+
+           pushRect(uint32_t x0, uint32_t y0, uint32_t w, uint32_t h, uint16_t *data),
+           readRect(uint32_t x0, uint32_t y0, uint32_t w, uint32_t h, uint16_t *data);
+
+  uint16_t readPixel(int32_t x0, int32_t y0);
+
+  int16_t  drawChar(unsigned int uniCode, int x, int y, int font);
+
+           // Bring the other overloads of these names into scope
+  using    TFT_eSPI::drawChar;
+
+ private:
+
+  uint32_t mapColor(uint32_t color);      // Convert a colour to the stored pixel value
+  void     putPixel(int32_t x, int32_t y, uint32_t value),        // Store a pixel value
+           fillSpan(int32_t x, int32_t y, int32_t w, uint32_t value), // Store a row span
+           expandRow(uint16_t *out, int32_t x, int32_t y, int32_t n), // Convert to RGB565
+           pushWindow(uint32_t value); // Store a pixel value at the window pointer and advance
+  void     initPalette(void),
+           addDirty(TFT_DirtyRect r); // Add a clipped rectangle to the list, merging
+  uint32_t rectCost(const TFT_DirtyRect &r); // Bus time to push r in its own window
+  void     pushRun(int32_t x, int32_t y, int32_t row, int32_t xs, int32_t xe); // For pushDiff()
+
+  TFT_eSPI *_tft;     // The TFT the sprite is pushed to
+
+  uint16_t *_img;     // 16 bit pixel buffer, colours are stored byte swapped ready to send
+  uint8_t  *_img8;    // The same buffer for the other colour depths
+
+  uint16_t *_lut,     // Byte swapped RGB565 colour of each pixel value, NULL for 16 bits
+           *_nib;     // 1 bit sprites, 4 byte swapped colours for each 4 bit pattern
+
+  int8_t   _bpp;      // Bits per pixel
+  boolean  _indexed;  // 8 bit colours are palette indexes, not RGB332
+
+  int32_t  _iwidth, _iheight, // Sprite width and height
+           _istride,          // Bytes per row
+           _xs, _ys, _xe, _ye, // Window set by setWindow() for pushColor() and pushColors()
+           _xptr, _yptr,       // Window pointer, the next pixel is written here
+           _ox, _oy;           // Drawing coordinates of the first sprite pixel, see setCanvas()
+
+  boolean  _winDirty;         // The window has been added to the dirty list
+
+  boolean  _dirtyOn;          // Dirty rectangle tracking is enabled
+  uint8_t  _dirtyCount,       // Rectangles in the dirty list
+           _writeDepth;       // Nesting depth of startWrite() calls
+  boolean  _pending;          // _pendingRect holds the area drawn in this session
+  TFT_DirtyRect _pendingRect,
+                _dirty[TFT_DIRTY_RECTS];
+
+  uint8_t  *_shadow;          // The sprite as last sent by pushDiff()
+  boolean  _shadowValid;      // The shadow matches the TFT
+
+};
+
+#endif
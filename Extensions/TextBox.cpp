@@ -0,0 +1,350 @@
+/***************************************************************************************
+// The text box class member functions, this file is included by TFT_eSPI.cpp. See
+// TextBox.h for details.
+***************************************************************************************/
+
+/***************************************************************************************
+** Function name:           TFT_eTextBox
+** Description:             Class constructor
+***************************************************************************************/
+TFT_eTextBox::TFT_eTextBox(TFT_eSPI *tft)
+{
+  _tft = tft;
+
+  _x = _y = _w = _h = 0;
+  _datum   = TL_DATUM;
+  _spacing = 0;
+  _text    = NULL;
+
+  _laidOut = false;
+  _count   = 0;
+  _more    = false;
+}
+
+
+/***************************************************************************************
+** Function name:           setBox
+** Description:             place the box
+***************************************************************************************/
+void TFT_eTextBox::setBox(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+  _x = x;
+  _y = y;
+  _w = w;
+  _h = h;
+}
+
+
+/***************************************************************************************
+** Function name:           setTextDatum
+** Description:             set the alignment of the lines in the box
+***************************************************************************************/
+void TFT_eTextBox::setTextDatum(uint8_t datum)
+{
+  _datum = datum;
+}
+
+
+/***************************************************************************************
+** Function name:           setLineSpacing
+** Description:             set the pixels added between lines
+***************************************************************************************/
+void TFT_eTextBox::setLineSpacing(int8_t spacing)
+{
+  _spacing = spacing;
+}
+
+
+/***************************************************************************************
+** Function name:           setText
+** Description:             set the text, the lines are laid out again when drawn
+***************************************************************************************/
+void TFT_eTextBox::setText(const char *text)
+{
+  _text = text;
+  _laidOut = false;
+}
+
+
+/***************************************************************************************
+** Function name:           lines
+** Description:             return the number of lines in the text
+***************************************************************************************/
+uint16_t TFT_eTextBox::lines(void)
+{
+  layout();
+  return _count;
+}
+
+
+/***************************************************************************************
+** Function name:           overflow
+** Description:             return true if not all the lines fit in the box
+***************************************************************************************/
+boolean TFT_eTextBox::overflow(void)
+{
+  int32_t rows, pitch;
+  layout();
+  metrics(&rows, &pitch);
+  return _more || (_count && ((_count - 1) * pitch + rows > _h));
+}
+
+
+/***************************************************************************************
+** Function name:           metrics
+** Description:             find the rows drawn by a line and the distance between lines
+***************************************************************************************/
+void TFT_eTextBox::metrics(int32_t *rows, int32_t *pitch)
+{
+  int32_t ts = _tft->textsize;
+#ifdef LOAD_GFXFF
+  if ((_tft->textfont == 1) && _tft->gfxFont) *rows = (_tft->glyph_ab + _tft->glyph_bb) * ts;
+  else
+#endif
+  *rows = pgm_read_byte(&fontdata[_tft->textfont].height) * ts;
+
+  *pitch = _tft->fontHeight(_tft->textfont) + _spacing;
+  if (*pitch < 1) *pitch = 1;
+}
+
+
+/***************************************************************************************
+** Function name:           layout
+** Description:             break the text into lines that fit the box width
+***************************************************************************************/
+// The text is measured once, a character at a time. The place after the last word that
+// fitted is kept, when a character does not fit the line ends there and the rest of
+// the word so far moves to the next line without being measured again.
+void TFT_eTextBox::layout(void)
+{
+  boolean freeFont = false;
+#ifdef LOAD_GFXFF
+  freeFont = (_tft->textfont == 1) && _tft->gfxFont;
+  if (_laidOut && (_font == _tft->textfont) && (_size == _tft->textsize) && (_lineW == _w) &&
+      (_gfxFont == _tft->gfxFont) && (_kern == _tft->kernPairs)) return;
+  _gfxFont = _tft->gfxFont;
+  _kern    = _tft->kernPairs;
+#else
+  if (_laidOut && (_font == _tft->textfont) && (_size == _tft->textsize) && (_lineW == _w)) return;
+#endif
+
+  _font    = _tft->textfont;
+  _size    = _tft->textsize;
+  _lineW   = _w;
+  _laidOut = true;
+  _count   = 0;
+  _more    = false;
+
+  if (!_text) return;
+
+  int32_t  ts = _size;
+  const char *p = _text;
+  uint16_t start = 0, end = 0;   // Bytes of the line, end is after its last non space
+  int32_t  x = 0, width = 0;     // x advance and width of the line at textsize 1
+  uint16_t last = 0;             // Previous character, for kerning
+  boolean  space = false;        // Previous character was a space
+
+  // The last break, the line can end at brkEnd and the next start at brkNext
+  int32_t  brkEnd = -1, brkNext = 0, brkX = 0, brkWidth = 0;
+
+  while (_count < TEXT_BOX_LINES) {
+    if (!*p || (*p == '\n')) {
+      _line[_count].start = start;
+      _line[_count].len   = end - start;
+      _line[_count].width = width * ts;
+      _count++;
+      if (!*p) return;
+
+      start = end = ++p - _text;
+      x = width = 0;
+      last = 0;
+      space = false;
+      brkEnd = -1;
+      continue;
+    }
+
+    uint16_t at = p - _text, c;
+#ifdef LOAD_GFXFF
+    if (freeFont) c = _tft->nextChar(&p);
+    else
+#endif
+    c = (uint8_t)*p++;
+
+    int16_t adv, ink0, ink1;
+    if (!_tft->charMetrics(c, _font, &adv, &ink0, &ink1)) continue; // No glyph
+
+    int32_t cx = x;
+#ifdef LOAD_GFXFF
+    if (freeFont && _tft->kernPairs && last) cx += _tft->kerning(last, c);
+#endif
+    last = c;
+
+    if (c == ' ') {
+      if (!space && (end > start)) { // Break after a word
+        brkEnd   = end;
+        brkWidth = width;
+      }
+      space   = true;
+      x       = cx + adv;
+      brkNext = p - _text;
+      brkX    = x;
+      continue;
+    }
+
+    // Spaces at the start of a line are dropped if the word after them does not fit,
+    // there is no break after a word but the last space is past the start of the line
+    if ((brkEnd < 0) && (brkNext > start) && ((cx + ink1) * ts > _w)) {
+      cx    -= brkX;
+      width  = (end > brkNext) ? width - brkX : 0;
+      start  = brkNext;
+      if (end < start) end = start;
+    }
+
+    // A character that does not fit starts a new line, unless it is the first
+    while (((cx + ink1) * ts > _w) && (end > start) && (_count < TEXT_BOX_LINES)) {
+      _line[_count].start = start;
+      if (brkEnd >= 0) { // At the last space, the rest of the word moves down
+        _line[_count].len   = brkEnd - start;
+        _line[_count].width = brkWidth * ts;
+        start  = brkNext;
+        cx    -= brkX;
+        width -= brkX;
+        if (end < start) end = start;
+        brkEnd = -1;
+      }
+      else { // In a word wider than the box
+        _line[_count].len   = end - start;
+        _line[_count].width = width * ts;
+        start = end = at;
+        cx = width = 0;
+      }
+      _count++;
+    }
+
+    x     = cx + adv;
+    width = cx + ink1;
+    end   = p - _text;
+    space = false;
+  }
+
+  _more = true; // There is text after the last line
+}
+
+
+/***************************************************************************************
+** Function name:           drawLine
+** Description:             draw a line of text with its top left corner at x,y
+***************************************************************************************/
+void TFT_eTextBox::drawLine(const TFT_TextLine *line, int32_t x, int32_t y)
+{
+  uint16_t len = line->len;
+  if (!len) return;
+
+  const char *s = _text + line->start;
+
+#ifdef LOAD_GFXFF
+  if ((_font == 1) && _tft->gfxFont) {
+    int32_t ts = _size, base = y + _tft->glyph_ab * ts;
+
+    // A short line is laid out again from a copy ending in a null, a line of more
+    // than TFT_LAYOUT_GLYPHS bytes is drawn a character at a time
+    char buf[TFT_LAYOUT_GLYPHS + 1];
+    TFT_GlyphPos pos[TFT_LAYOUT_GLYPHS + 1];
+    uint16_t n = 0;
+    if (len <= TFT_LAYOUT_GLYPHS) {
+      memcpy(buf, s, len);
+      buf[len] = 0;
+      _tft->layoutString(buf, pos, &n);
+    }
+
+    if (_tft->textcolor != _tft->textbgcolor) {
+      if (len <= TFT_LAYOUT_GLYPHS) {
+        int16_t done = _tft->smoothFont ? _tft->drawSmoothString(pos, n, x, base, line->width)
+                                        : _tft->drawFreeFontOpaque(pos, n, x, base, line->width);
+        if (done >= 0) return;
+      }
+
+      // Not enough RAM or too long, fill the background and draw the characters over it
+      _tft->fillRect(x, y, line->width, (_tft->glyph_ab + _tft->glyph_bb) * ts, _tft->textbgcolor);
+    }
+
+    if (len <= TFT_LAYOUT_GLYPHS) {
+      for (uint16_t i = 0; i < n; i++)
+        _tft->drawChar(x + pos[i].x * ts, base, pos[i].code, _tft->textcolor, _tft->textbgcolor, ts);
+      return;
+    }
+
+    // The glyphs are found again as they are drawn, as layoutString() does
+    const char *e = s + len;
+    int32_t  cx = 0;
+    uint16_t last = 0;
+    while (s < e) {
+      uint16_t c = _tft->nextChar(&s);
+      int16_t  adv, ink0, ink1;
+      if (!_tft->charMetrics(c, 1, &adv, &ink0, &ink1)) continue; // No glyph
+      if (_tft->kernPairs && last) cx += _tft->kerning(last, c);
+      last = c;
+      _tft->drawChar(x + cx * ts, base, c, _tft->textcolor, _tft->textbgcolor, ts);
+      cx += adv;
+    }
+    return;
+  }
+#endif
+
+  while (len--) {
+    uint8_t c = *s++;
+    if ((_font == 1) || ((c >= 32) && (c <= 127))) x += _tft->drawChar(c, x, y, _font);
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           draw
+** Description:             draw the lines that fit in the box
+***************************************************************************************/
+void TFT_eTextBox::draw(void)
+{
+  layout();
+
+  int32_t rows, pitch;
+  metrics(&rows, &pitch);
+
+  // Top of the first line, the vertical part of the datum aligns the block of lines
+  int32_t block = _count ? (_count - 1) * pitch + rows : 0;
+  int32_t y = _y;
+  switch (_datum / 3) {
+    case 1: y += (_h - block) / 2; break; // Middle
+    case 2: y += _h - block;       break; // Bottom
+  }
+
+  uint8_t  align  = _datum % 3;
+  uint32_t bg     = _tft->textbgcolor;
+  boolean  opaque = (_tft->textcolor != bg);
+  int32_t  row    = _y; // Rows of the box above this have been drawn
+
+  _tft->startWrite();
+
+  for (uint16_t i = 0; i < _count; i++, y += pitch) {
+    if ((y < _y) || (y + rows > _y + _h)) continue; // Cut by the box
+
+    const TFT_TextLine *line = &_line[i];
+    int32_t x = _x;
+    if (align == 1) x += (_w - line->width) / 2;
+    else if (align == 2) x += _w - line->width;
+
+    // The background around the line and any gap above it
+    if (opaque) {
+      if (y > row) _tft->fillRect(_x, row, _w, y - row, bg);
+      if (x > _x) _tft->fillRect(_x, y, x - _x, rows, bg);
+      int32_t xe = x + line->width;
+      if (xe < _x + _w) _tft->fillRect(xe, y, _x + _w - xe, rows, bg);
+    }
+
+    drawLine(line, x, y);
+    if (y + rows > row) row = y + rows;
+  }
+
+  if (opaque && (row < _y + _h)) _tft->fillRect(_x, row, _w, _y + _h - row, bg);
+
+  _tft->endWrite();
+}
@@ -0,0 +1,81 @@
+/***************************************************************************************
+// The following class draws a block of text in a box on the TFT. The text is broken
+// into lines at spaces so each line fits the box width, a word that is wider than the
+// box is broken between characters and '\n' starts a new line. Spaces at the start of a
+// line are kept as an indent unless the word after them would not fit. The lines are aligned
+// in the box with a datum, e.g. MC_DATUM centres every line and the block of lines.
+//
+// The line breaks are found in one pass over the text and kept, so drawing the box
+// again does not measure the text again until setText() is called or the font, text
+// size or box width has changed.
+//
+// The text uses the font, size and colours of the TFT when draw() is called. With a
+// background colour the whole box is drawn, the text and the background around it in
+// one transaction, so the box can be redrawn without flicker. Only the lines that fit
+// in the box are drawn, a line that would be cut by the top or bottom is left out.
+***************************************************************************************/
+
+#ifndef _TFT_eSPI_TextBoxH_
+#define _TFT_eSPI_TextBoxH_
+
+#define TEXT_BOX_LINES 32 // Maximum lines laid out, the rest of the text is not shown
+
+// A line of text in a box
+typedef struct {
+  uint16_t start, len;  // Bytes of the text in the line, trailing spaces are not included
+  int16_t  width;       // Width in pixels
+} TFT_TextLine;
+
+class TFT_eTextBox {
+
+ public:
+
+  TFT_eTextBox(TFT_eSPI *tft);
+
+           // Place the box, x,y is the top left corner
+  void     setBox(int32_t x, int32_t y, int32_t w, int32_t h),
+
+           // Align the lines, the datums are as for setTextDatum(). The baseline datums
+           // are the same as the top ones.
+           setTextDatum(uint8_t datum),
+
+           // Add pixels between lines, can be negative
+           setLineSpacing(int8_t spacing),
+
+           // The text is not copied, call setText() again after changing it
+           setText(const char *text),
+
+           // Draw the box, the lines are laid out first if anything has changed
+           draw(void);
+
+  uint16_t lines(void);    // Number of lines in the text
+  boolean  overflow(void); // Not all the lines fit in the box
+
+ private:
+
+  void     layout(void), // Lay out the lines if the text or settings have changed
+           metrics(int32_t *rows, int32_t *pitch),
+           drawLine(const TFT_TextLine *line, int32_t x, int32_t y);
+
+  TFT_eSPI *_tft;
+
+  int16_t  _x, _y, _w, _h;
+  uint8_t  _datum;
+  int8_t   _spacing;
+  const char *_text;
+
+  // Settings the lines were laid out with
+  boolean  _laidOut;
+  uint8_t  _font, _size;
+  int16_t  _lineW;
+#ifdef LOAD_GFXFF
+  const GFXfont *_gfxFont;
+  const GFXkern *_kern;
+#endif
+
+  uint16_t _count;          // Lines in _line[]
+  boolean  _more;           // There was more text than TEXT_BOX_LINES lines
+  TFT_TextLine _line[TEXT_BOX_LINES];
+};
+
+#endif
@@ -6,6 +6,13 @@
 // file and pass address of GFXfont struct to setFont().  Pass NULL to
 // revert to 'classic' fixed-space bitmap font.
 
+// If LOAD_UNICODE is defined in the setup file free font text is decoded as UTF-8
+// and a font can have glyphs for several ranges of Unicode character codes, e.g.
+// ASCII, Latin Extended-A and Cyrillic. The ranges are in code order and are found
+// with a binary search. A font with range == NULL has the single range first..last,
+// so the fonts in the Fonts folder work unchanged. Without LOAD_UNICODE the extra
+// fields are not compiled. Tools/Font_Compiler makes fonts with ranges.
+
 #ifndef _GFXFONT_H_
 #define _GFXFONT_H_
 
@@ -18,11 +25,27 @@ typedef struct { // Data stored PER GLYPH
 	int8_t   xOffset, yOffset; // Dist from cursor pos to UL corner
 } GFXglyph;
 
+typedef struct { // Data stored PER KERNING PAIR, see setKerning()
+	uint16_t left, right;      // Character codes of the pair
+	int8_t   xAdjust;          // Added to the xAdvance of left when right follows it
+} GFXkern;
+
+#ifdef LOAD_UNICODE
+typedef struct { // Data stored PER RANGE of consecutive character codes
+	uint16_t first, last;      // Unicode extents
+	uint16_t glyph;            // Index in the glyph array of the glyph for first
+} GFXrange;
+#endif
+
 typedef struct { // Data stored for FONT AS A WHOLE:
 	uint8_t  *bitmap;      // Glyph bitmaps, concatenated
 	GFXglyph *glyph;       // Glyph array
 	uint8_t   first, last; // ASCII extents
 	uint8_t   yAdvance;    // Newline distance (y axis)
+#ifdef LOAD_UNICODE
+	GFXrange *range;       // Character code ranges, NULL if only first..last
+	uint16_t  ranges;      // Number of ranges
+#endif
 } GFXfont;
 
 #endif // LOAD_GFXFF
@@ -0,0 +1,1302 @@
+// FreeSans24pt7b scaled to 2/3 with 4 bit coverage per pixel, see smoothfont.h
+
+const uint8_t FreeSansSmooth16pt7bBitmaps[] PROGMEM = {
+  0xFF, 0xAF, 0xFA, 0xFF, 0xAF, 0xFA, 0xFF, 0xAF, 0xFA, 0xFF, 0xAF, 0xFA,
+  0xFF, 0xAF, 0xFA, 0xFF, 0xAF, 0xFA, 0xFF, 0xA8, 0xFA, 0x5F, 0x05, 0xF0,
+  0x5F, 0x02, 0x50, 0x00, 0x0A, 0xA7, 0xFF, 0xAF, 0xFA, 0xAA, 0x70, 0x35,
+  0x50, 0x05, 0x53, 0xAF, 0xF0, 0x0F, 0xFA, 0xAF, 0xF0, 0x0F, 0xFA, 0xAF,
+  0xF0, 0x0F, 0xFA, 0xAF, 0xF0, 0x0F, 0xFA, 0xAF, 0xF0, 0x0F, 0xFA, 0x7F,
+  0xC0, 0x0C, 0xF7, 0x0F, 0x50, 0x05, 0xF0, 0x0A, 0x30, 0x03, 0xA0, 0x00,
+  0x00, 0x00, 0x3A, 0x70, 0x00, 0x3A, 0xA3, 0x00, 0x00, 0x00, 0x08, 0xFA,
+  0x00, 0x05, 0xFD, 0x30, 0x00, 0x00, 0x00, 0xFF, 0xA0, 0x00, 0x5F, 0xA0,
+  0x00, 0x00, 0x00, 0x0F, 0xF7, 0x00, 0x0F, 0xFA, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0xAF, 0xF0, 0x00, 0x0F,
+  0xF0, 0x00, 0x07, 0xAA, 0xAD, 0xFF, 0xAA, 0xAA, 0xFF, 0xAA, 0x70, 0xAF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x03, 0x55, 0x8F, 0xF8, 0x55,
+  0x5C, 0xF8, 0x55, 0x30, 0x00, 0x05, 0xFF, 0x50, 0x00, 0xAF, 0x50, 0x00,
+  0x00, 0x00, 0x5F, 0xC2, 0x00, 0x3D, 0xF5, 0x00, 0x00, 0x00, 0x05, 0xFA,
+  0x00, 0x05, 0xFF, 0x50, 0x00, 0x00, 0x00, 0xCF, 0xA0, 0x00, 0x5F, 0xC2,
+  0x00, 0x02, 0x55, 0x5F, 0xFC, 0x55, 0x58, 0xFC, 0x55, 0x50, 0x5F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xAA, 0xDF, 0xFA, 0xAA, 0xAF,
+  0xFA, 0xAA, 0xA0, 0x00, 0x0A, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0xAF, 0xC0, 0x00, 0xAF, 0xF0, 0x00, 0x00, 0x00, 0x0A, 0xF5, 0x00,
+  0x0A, 0xFF, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x50, 0x00, 0xAF, 0x50, 0x00,
+  0x00, 0x00, 0x5F, 0xF5, 0x00, 0x0A, 0xF5, 0x00, 0x00, 0x00, 0x05, 0xFA,
+  0x00, 0x05, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x25, 0x30, 0x00, 0x25, 0x52,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xA3, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x55, 0xFF, 0xFF, 0xC5, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x70, 0x00, 0x00, 0x8F, 0xFF, 0xAD, 0xFC, 0xCF, 0xF8, 0x00, 0x00,
+  0xFF, 0xF8, 0x0A, 0xF5, 0x2C, 0xFF, 0x00, 0x0A, 0xFF, 0x70, 0x0A, 0xF5,
+  0x00, 0xCF, 0xA0, 0x0A, 0xFF, 0x00, 0x0A, 0xF5, 0x00, 0x5F, 0xA0, 0x0A,
+  0xFF, 0x00, 0x0A, 0xF5, 0x00, 0x3A, 0x70, 0x0A, 0xFF, 0x00, 0x0A, 0xF5,
+  0x00, 0x00, 0x00, 0x07, 0xFF, 0xC2, 0x0A, 0xF5, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFC, 0x7A, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xFF, 0xFF, 0xF8,
+  0x55, 0x00, 0x00, 0x00, 0x03, 0x8F, 0xFF, 0xFF, 0xFF, 0xA3, 0x00, 0x00,
+  0x00, 0x00, 0xAD, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x0A, 0xF8,
+  0x5C, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x0A, 0xF5, 0x00, 0xCF, 0xF8, 0x00,
+  0x00, 0x00, 0x0A, 0xF5, 0x00, 0x2C, 0xFF, 0x5F, 0xA0, 0x00, 0x0A, 0xF5,
+  0x00, 0x0A, 0xFF, 0x5F, 0xD3, 0x00, 0x0A, 0xF5, 0x00, 0x0A, 0xFF, 0x3D,
+  0xF8, 0x00, 0x0A, 0xF5, 0x00, 0x2C, 0xFC, 0x0A, 0xFF, 0x70, 0x0A, 0xF5,
+  0x00, 0x5F, 0xF5, 0x07, 0xFF, 0xC5, 0x0A, 0xF5, 0x25, 0xFF, 0xD3, 0x00,
+  0x8F, 0xFF, 0xAD, 0xFC, 0xCF, 0xFF, 0x30, 0x00, 0x07, 0xAD, 0xFF, 0xFF,
+  0xFC, 0x70, 0x00, 0x00, 0x00, 0x03, 0x5C, 0xF8, 0x52, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0A, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF5,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xA3, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x0A, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFA, 0x00,
+  0x00, 0x00, 0x00, 0x5C, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFC,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00,
+  0xAF, 0x50, 0x00, 0x00, 0x00, 0x2C, 0xFC, 0x70, 0x07, 0xCF, 0xC2, 0x00,
+  0x00, 0x5F, 0xA0, 0x00, 0x00, 0x00, 0x05, 0xFC, 0x20, 0x00, 0x02, 0xCF,
+  0x50, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xA0, 0x00, 0x00,
+  0x0A, 0xF5, 0x00, 0x0A, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFA, 0x00,
+  0x00, 0x00, 0xAF, 0x50, 0x03, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3D,
+  0xF8, 0x30, 0x03, 0x8F, 0xD3, 0x00, 0x8F, 0xA0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3F, 0xFD, 0xAA, 0xDF, 0xFA, 0x00, 0x0F, 0xF3, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFC, 0x00, 0x0A, 0xFC, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x5F, 0xFF, 0xF5, 0x20, 0x03, 0xDC, 0x20,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+  0x70, 0x00, 0x03, 0x55, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0xF0, 0x00, 0x03, 0xDF, 0xFF, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x2C, 0xF5, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0xFC, 0x20, 0x03, 0xDF, 0xF5, 0x58, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0x70, 0x00, 0xFF, 0x70, 0x00, 0x00, 0xCF,
+  0xA0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+  0x05, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xF5, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x00, 0x5F, 0xA0, 0x00, 0x00, 0x00, 0x05, 0xFC, 0x20, 0x00, 0x0F,
+  0xF7, 0x00, 0x00, 0x0C, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0x00, 0x3D, 0xFF, 0x55, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80,
+  0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2C,
+  0xD3, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xFF, 0xFC, 0x70, 0x00, 0x00, 0x00,
+  0x02, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x55, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x35, 0x55, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAD,
+  0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xCF, 0xFF, 0xFF, 0xFC,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x55, 0x8F, 0xF5, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0xFD, 0x30, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xA0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFA, 0x00,
+  0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xD3, 0x00, 0x07, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xDF, 0xF3, 0x38, 0xFD, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0xFF, 0xDD, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0xFF, 0xFA, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
+  0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0xAC, 0xFF, 0x50, 0x00,
+  0x35, 0x50, 0x00, 0x3D, 0xFF, 0x30, 0x2C, 0xFC, 0x00, 0x0A, 0xFF, 0x00,
+  0x0F, 0xFD, 0x30, 0x00, 0x7F, 0xFC, 0x25, 0xFF, 0xC0, 0x07, 0xFF, 0x30,
+  0x00, 0x00, 0x8F, 0xFC, 0xCF, 0xF5, 0x00, 0xAF, 0xF0, 0x00, 0x00, 0x00,
+  0x7F, 0xFF, 0xFA, 0x00, 0x0A, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0x30, 0x00, 0xAF, 0xF3, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFC, 0x20, 0x03,
+  0xFF, 0xD3, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF5, 0x00, 0x0C, 0xFF, 0xFC,
+  0x55, 0x5F, 0xFD, 0x3C, 0xFF, 0xF3, 0x00, 0x2C, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x30, 0x2C, 0xFF, 0xD3, 0x00, 0x0A, 0xDF, 0xFF, 0xFA, 0x30, 0x00, 0x0A,
+  0xAA, 0x30, 0x00, 0x03, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35,
+  0x5A, 0xFF, 0xAF, 0xFA, 0xFF, 0xAF, 0xFA, 0xFF, 0x7F, 0xC0, 0xF5, 0x0A,
+  0x30, 0x00, 0x00, 0x5F, 0xA0, 0x00, 0x0C, 0xF3, 0x00, 0x0A, 0xF5, 0x00,
+  0x03, 0xDF, 0x50, 0x00, 0x8F, 0xA0, 0x00, 0x0F, 0xF3, 0x00, 0x03, 0xFF,
+  0x00, 0x00, 0xAF, 0x80, 0x00, 0x5F, 0xF5, 0x00, 0x05, 0xFF, 0x50, 0x00,
+  0x5F, 0xD3, 0x00, 0x0C, 0xFA, 0x00, 0x00, 0xFF, 0xA0, 0x00, 0x0F, 0xFA,
+  0x00, 0x00, 0xFF, 0xA0, 0x00, 0x0F, 0xFA, 0x00, 0x00, 0xFF, 0xA0, 0x00,
+  0x0F, 0xFA, 0x00, 0x00, 0xCF, 0xA0, 0x00, 0x05, 0xFD, 0x30, 0x00, 0x5F,
+  0xF5, 0x00, 0x02, 0xCF, 0x50, 0x00, 0x0A, 0xFF, 0x00, 0x00, 0x3F, 0xF0,
+  0x00, 0x00, 0xCF, 0xA0, 0x00, 0x05, 0xFA, 0x00, 0x00, 0x0A, 0xF5, 0x00,
+  0x00, 0x3F, 0xC0, 0x00, 0x00, 0x5F, 0x30, 0x00, 0x02, 0x53, 0xAF, 0x50,
+  0x00, 0x03, 0xFC, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x5F, 0xD3, 0x00,
+  0x00, 0xAF, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF3, 0x00, 0x00,
+  0x8F, 0xA0, 0x00, 0x05, 0xFC, 0x20, 0x00, 0x5F, 0xF5, 0x00, 0x03, 0xDF,
+  0x50, 0x00, 0x0A, 0xFC, 0x00, 0x00, 0xAF, 0xF0, 0x00, 0x0A, 0xFF, 0x00,
+  0x00, 0xAF, 0xF0, 0x00, 0x0A, 0xFF, 0x00, 0x00, 0xAF, 0xF0, 0x00, 0x0A,
+  0xFF, 0x00, 0x02, 0xCF, 0xC0, 0x00, 0x5F, 0xF5, 0x00, 0x05, 0xFF, 0x50,
+  0x00, 0x5F, 0xC2, 0x00, 0x0F, 0xFA, 0x00, 0x00, 0xFF, 0x30, 0x00, 0xAF,
+  0xC0, 0x00, 0x0A, 0xF5, 0x00, 0x05, 0xFA, 0x00, 0x00, 0xCF, 0x30, 0x00,
+  0x3F, 0x50, 0x00, 0x03, 0x52, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00,
+  0x00, 0x00, 0xAA, 0x00, 0x00, 0x05, 0x20, 0xAA, 0x02, 0x50, 0x7F, 0xCA,
+  0xDD, 0xAC, 0xF7, 0x7A, 0xAF, 0xFF, 0xFA, 0xA7, 0x00, 0x08, 0xFF, 0x80,
+  0x00, 0x00, 0x3F, 0xCC, 0xF3, 0x00, 0x00, 0xAF, 0x55, 0xFD, 0x30, 0x03,
+  0xAA, 0x00, 0xAA, 0x30, 0x00, 0x03, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFA, 0x7A, 0xAA, 0xAA, 0xAF, 0xFA, 0xAA, 0xAA, 0xA7, 0x00, 0x00, 0x00,
+  0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x3A, 0xA3, 0x5F,
+  0xF5, 0x5F, 0xF5, 0x3A, 0xF5, 0x00, 0xF5, 0x00, 0xF5, 0x07, 0xC2, 0x5F,
+  0x70, 0x25, 0x00, 0x35, 0x55, 0x55, 0x53, 0xAF, 0xFF, 0xFF, 0xFA, 0xAF,
+  0xFF, 0xFF, 0xFA, 0x35, 0x55, 0x55, 0x53, 0x3A, 0xA3, 0x5F, 0xF5, 0x5F,
+  0xF5, 0x3A, 0xA3, 0x00, 0x00, 0x00, 0x5F, 0xA0, 0x00, 0x00, 0x05, 0xF3,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0A,
+  0xF5, 0x00, 0x00, 0x00, 0xAC, 0x20, 0x00, 0x00, 0x2C, 0xA0, 0x00, 0x00,
+  0x05, 0xFA, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+  0x00, 0x00, 0xF5, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x0A, 0xA0,
+  0x00, 0x00, 0x03, 0xDA, 0x00, 0x00, 0x00, 0x5F, 0x70, 0x00, 0x00, 0x0C,
+  0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x50, 0x00, 0x00,
+  0x0A, 0xF5, 0x00, 0x00, 0x00, 0xAC, 0x20, 0x00, 0x00, 0x5F, 0xA0, 0x00,
+  0x00, 0x05, 0xF3, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x05, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x55, 0x53, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xCF, 0xFF, 0xDA, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x80, 0x00, 0x0A, 0xFF, 0xF8, 0x55, 0xFF, 0xFF, 0x00, 0x05, 0xFF, 0xC0,
+  0x00, 0x00, 0x7F, 0xFA, 0x00, 0xCF, 0xF5, 0x00, 0x00, 0x00, 0xFF, 0xD3,
+  0x0F, 0xFA, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x50, 0xFF, 0xA0, 0x00, 0x00,
+  0x00, 0x5F, 0xF5, 0xAF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFA, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xAF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0xAF, 0xFA, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xAF, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0xAF, 0xFA, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF,
+  0xAF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFA, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x0A, 0xFF, 0x0F, 0xFA, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x50, 0xFF,
+  0xA0, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x0C, 0xFF, 0x50, 0x00, 0x00, 0x0F,
+  0xFD, 0x30, 0x5F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xA0, 0x00, 0xAF, 0xFC,
+  0x55, 0x5F, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+  0x00, 0x00, 0x7C, 0xFF, 0xFD, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x25, 0x55,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x03, 0xDA, 0x00,
+  0x00, 0x08, 0xFA, 0x00, 0x00, 0x7F, 0xFA, 0x35, 0xCF, 0xFF, 0xFA, 0xAF,
+  0xFF, 0xFF, 0xFA, 0x7A, 0xAA, 0xAF, 0xFA, 0x00, 0x00, 0x0F, 0xFA, 0x00,
+  0x00, 0x0F, 0xFA, 0x00, 0x00, 0x0F, 0xFA, 0x00, 0x00, 0x0F, 0xFA, 0x00,
+  0x00, 0x0F, 0xFA, 0x00, 0x00, 0x0F, 0xFA, 0x00, 0x00, 0x0F, 0xFA, 0x00,
+  0x00, 0x0F, 0xFA, 0x00, 0x00, 0x0F, 0xFA, 0x00, 0x00, 0x0F, 0xFA, 0x00,
+  0x00, 0x0F, 0xFA, 0x00, 0x00, 0x0F, 0xFA, 0x00, 0x00, 0x0F, 0xFA, 0x00,
+  0x00, 0x0F, 0xFA, 0x00, 0x00, 0x0F, 0xFA, 0x00, 0x00, 0x0A, 0xA7, 0x00,
+  0x00, 0x05, 0x55, 0x55, 0x20, 0x00, 0x00, 0x00, 0x3A, 0xFF, 0xFF, 0xFC,
+  0x70, 0x00, 0x02, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x5F, 0xFF,
+  0xC5, 0x55, 0x8F, 0xFF, 0xD3, 0x0F, 0xFD, 0x30, 0x00, 0x00, 0x0C, 0xFF,
+  0x87, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xAF, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0xAF, 0xFA, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0xCF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x5F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0xAD, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x38, 0xFF, 0xFD, 0xA0,
+  0x00, 0x00, 0x00, 0x3D, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x02, 0xCF, 0xFF,
+  0xC7, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0x52, 0x00, 0x00, 0x00, 0x02,
+  0xCF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xC5, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7A, 0xAA, 0xAA, 0xAA,
+  0xAA, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x55, 0x55, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0xAA, 0xFF, 0xFF, 0xDA, 0x70, 0x00, 0x00, 0x2C, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xCF, 0xFF, 0x55, 0x55, 0x8F, 0xFF, 0x70,
+  0x03, 0xFF, 0xD3, 0x00, 0x00, 0x07, 0xFF, 0xC2, 0x0A, 0xFF, 0x30, 0x00,
+  0x00, 0x00, 0x8F, 0xF5, 0x0A, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5,
+  0x03, 0x55, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0xA0,
+  0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x5F,
+  0xFF, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xAA, 0xCF, 0xFF, 0xC2,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3D, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF,
+  0x25, 0x52, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x00,
+  0x00, 0x00, 0x0A, 0xFF, 0x3D, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFC,
+  0x0A, 0xFF, 0x70, 0x00, 0x00, 0x00, 0xCF, 0xF5, 0x00, 0xFF, 0xFF, 0x55,
+  0x55, 0x8F, 0xFF, 0xA0, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30,
+  0x00, 0x00, 0xAD, 0xFF, 0xFF, 0xDA, 0x70, 0x00, 0x00, 0x00, 0x03, 0x55,
+  0x55, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x30, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2C, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xA0, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x3D,
+  0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xD3, 0xFF, 0xA0, 0x00,
+  0x00, 0x00, 0x07, 0xFF, 0x30, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x2C, 0xFC,
+  0x00, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0xCF, 0xC2, 0x00, 0xFF, 0xA0, 0x00,
+  0x00, 0x0A, 0xFF, 0x00, 0x00, 0xFF, 0xA0, 0x00, 0x00, 0x3D, 0xF8, 0x00,
+  0x00, 0xFF, 0xA0, 0x00, 0x03, 0xFF, 0x70, 0x00, 0x00, 0xFF, 0xA0, 0x00,
+  0x0A, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xA0, 0x00, 0x5F, 0xF8, 0x55, 0x55,
+  0x55, 0xFF, 0xC5, 0x55, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x25, 0x55, 0x55, 0x55,
+  0x55, 0xFF, 0xC5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xA0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xA0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x70, 0x00, 0x00, 0x35, 0x55, 0x55,
+  0x55, 0x55, 0x53, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00,
+  0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x3D, 0xF8, 0x55, 0x55, 0x55,
+  0x55, 0x30, 0x05, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x78, 0xFF,
+  0xFF, 0x83, 0x00, 0x00, 0xFF, 0xDD, 0xFF, 0xFF, 0xFF, 0xD3, 0x00, 0x0F,
+  0xFF, 0xFA, 0xAA, 0xAC, 0xFF, 0xF3, 0x00, 0xFF, 0xC5, 0x00, 0x00, 0x2C,
+  0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x2C, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xAF, 0xF7, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x7F,
+  0xFA, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x50, 0xFF, 0xD3, 0x00, 0x00, 0x00,
+  0xCF, 0xC2, 0x0C, 0xFF, 0xFC, 0x55, 0x58, 0xFF, 0xF7, 0x00, 0x2C, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0A, 0xAF, 0xFF, 0xFD, 0xA7, 0x00,
+  0x00, 0x00, 0x00, 0x55, 0x55, 0x30, 0x00, 0x00, 0x00, 0x00, 0x02, 0x55,
+  0x55, 0x20, 0x00, 0x00, 0x00, 0x07, 0xCF, 0xFF, 0xFC, 0x70, 0x00, 0x00,
+  0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xF8, 0x55, 0x8F,
+  0xFF, 0x70, 0x05, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFC, 0x20, 0x5F, 0xF5,
+  0x00, 0x00, 0x00, 0x8F, 0xF5, 0x0F, 0xFA, 0x00, 0x00, 0x00, 0x03, 0xAA,
+  0x30, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xF0, 0x02, 0x55,
+  0x55, 0x20, 0x00, 0x0A, 0xFF, 0x07, 0xCF, 0xFF, 0xFC, 0x70, 0x00, 0xAF,
+  0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x0A, 0xFF, 0xFF, 0xC5, 0x55, 0x8F,
+  0xFF, 0xA0, 0xAF, 0xFD, 0x30, 0x00, 0x00, 0x0C, 0xFF, 0x5A, 0xFF, 0xA0,
+  0x00, 0x00, 0x00, 0x5F, 0xFC, 0xAF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xAF,
+  0xFA, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x7F, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0xAF, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x0F,
+  0xFC, 0x20, 0x00, 0x00, 0x08, 0xFF, 0x50, 0x8F, 0xFC, 0x00, 0x00, 0x00,
+  0xFF, 0xF5, 0x03, 0xDF, 0xFC, 0x55, 0x58, 0xFF, 0xF7, 0x00, 0x03, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xAF, 0xFF, 0xFF, 0xC7, 0x00,
+  0x00, 0x00, 0x00, 0x55, 0x55, 0x52, 0x00, 0x00, 0x35, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x2A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xAF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x8F, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF7, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0A, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFD, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xAF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xF5, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3D, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFA, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0xCF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0xFD, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF,
+  0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA7, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x20, 0x00, 0x00, 0x00, 0x3A, 0xFF,
+  0xFF, 0xFC, 0x70, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+  0x3D, 0xFF, 0xC5, 0x55, 0x8F, 0xFF, 0x70, 0x0F, 0xFF, 0x50, 0x00, 0x00,
+  0x0F, 0xFC, 0x20, 0xFF, 0xC2, 0x00, 0x00, 0x00, 0x8F, 0xF5, 0x0F, 0xFA,
+  0x00, 0x00, 0x00, 0x05, 0xFF, 0x50, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0xCF,
+  0xF5, 0x05, 0xFF, 0x83, 0x00, 0x02, 0x5F, 0xFA, 0x00, 0x2C, 0xFF, 0xDA,
+  0xAA, 0xCF, 0xFF, 0x30, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFC, 0x20, 0x00,
+  0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x08, 0xFF, 0xC7, 0x00, 0x03,
+  0xAF, 0xFC, 0x20, 0xFF, 0xC2, 0x00, 0x00, 0x00, 0x8F, 0xF5, 0xAF, 0xF7,
+  0x00, 0x00, 0x00, 0x03, 0xDF, 0xFA, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A,
+  0xFF, 0xAF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFA, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x0A, 0xFF, 0x7F, 0xFA, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xC0,
+  0xFF, 0xD3, 0x00, 0x00, 0x00, 0xCF, 0xF5, 0x05, 0xFF, 0xFC, 0x55, 0x58,
+  0xFF, 0xFA, 0x00, 0x2C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x03,
+  0xAF, 0xFF, 0xFF, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x52, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0x55, 0x53, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xFF,
+  0xFF, 0xDA, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x20, 0x00,
+  0x3D, 0xFF, 0xC5, 0x55, 0xFF, 0xFC, 0x00, 0x0F, 0xFD, 0x30, 0x00, 0x00,
+  0xAF, 0xF3, 0x00, 0xFF, 0xA0, 0x00, 0x00, 0x03, 0xFF, 0xA0, 0xAF, 0xF0,
+  0x00, 0x00, 0x00, 0x05, 0xFA, 0x0A, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x5F,
+  0xD3, 0xAF, 0xF0, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x5A, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x5F, 0xF5, 0x7F, 0xFA, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x50,
+  0xFF, 0xD3, 0x00, 0x00, 0x07, 0xFF, 0xF5, 0x05, 0xFF, 0xFC, 0x55, 0x5F,
+  0xFF, 0xFF, 0x50, 0x2C, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xF5, 0x00, 0x0A,
+  0xAF, 0xFF, 0xFA, 0x35, 0xFF, 0x50, 0x00, 0x00, 0x55, 0x55, 0x00, 0x5F,
+  0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFA, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0xA0, 0x0F, 0xFA, 0x00, 0x00, 0x00, 0x3F, 0xF7, 0x00,
+  0xFF, 0xD3, 0x00, 0x00, 0x3D, 0xFF, 0x00, 0x05, 0xFF, 0xF5, 0x55, 0x5F,
+  0xFD, 0x30, 0x00, 0x2C, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x0A,
+  0xDF, 0xFF, 0xFA, 0x30, 0x00, 0x00, 0x00, 0x03, 0x55, 0x55, 0x00, 0x00,
+  0x00, 0x5F, 0xF5, 0x5F, 0xF5, 0x5F, 0xF5, 0x25, 0x52, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3A, 0xA3, 0x5F, 0xF5, 0x5F, 0xF5, 0x3A, 0xA3, 0x5F,
+  0xF5, 0x5F, 0xF5, 0x5F, 0xF5, 0x25, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3A, 0xA3, 0x5F, 0xF5, 0x5F, 0xF5, 0x3A, 0xF5, 0x00, 0xF5, 0x00,
+  0xF5, 0x07, 0xC2, 0x5F, 0x70, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x38, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xDF, 0xFA, 0x00,
+  0x00, 0x00, 0x02, 0x5F, 0xFF, 0xFA, 0xA0, 0x00, 0x00, 0x03, 0xAC, 0xFF,
+  0xFC, 0x50, 0x00, 0x00, 0x05, 0xCF, 0xFF, 0xCA, 0x30, 0x00, 0x00, 0x0A,
+  0xAF, 0xFF, 0xF5, 0x20, 0x00, 0x00, 0x00, 0xAF, 0xFD, 0xA0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xAF, 0xFD, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+  0xDF, 0xFF, 0x85, 0x20, 0x00, 0x00, 0x00, 0x00, 0x38, 0xFF, 0xFF, 0xC7,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xAF, 0xFF, 0xF5, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0xCF, 0xFF, 0xFA, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7C, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x58, 0xFA, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x7A, 0xAA, 0xAA, 0xAA, 0xAA,
+  0xAA, 0xAA, 0xA7, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xAF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x53, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFA, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x35,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x53, 0x70, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xAF, 0x85, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF,
+  0xFF, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xAF, 0xFF, 0xF5, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0xCF, 0xFF, 0xFA, 0x30, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7C, 0xFF, 0xFC, 0x53, 0x00, 0x00, 0x00, 0x00, 0x02, 0x58,
+  0xFF, 0xFD, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xDF, 0xFA, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xDF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x35,
+  0xCF, 0xFD, 0xA7, 0x00, 0x00, 0x00, 0x0A, 0xDF, 0xFF, 0x83, 0x00, 0x00,
+  0x02, 0x5F, 0xFF, 0xFA, 0xA0, 0x00, 0x00, 0x03, 0xAC, 0xFF, 0xFC, 0x50,
+  0x00, 0x00, 0x00, 0xAF, 0xFF, 0xCA, 0x30, 0x00, 0x00, 0x00, 0x00, 0xAF,
+  0xF5, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xAA, 0xA3, 0x00, 0x00, 0x00, 0x2C,
+  0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70,
+  0x0A, 0xFF, 0xA3, 0x00, 0x3A, 0xFF, 0xF5, 0x0A, 0xFF, 0x00, 0x00, 0x00,
+  0x8F, 0xFC, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F, 0xF5, 0x00,
+  0x00, 0x00, 0x0A, 0xFF, 0x3A, 0xA3, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
+  0xD3, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x2C,
+  0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x30, 0x00, 0x00, 0x00,
+  0x03, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x0A, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xAA,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0xAA, 0xAA,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x8F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x2C, 0xFF, 0xFC, 0xA3, 0x00, 0x00, 0x3A, 0xCF, 0xFF, 0xF8, 0x00,
+  0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF5, 0x20, 0x00, 0x00, 0x00, 0x02, 0x5F,
+  0xFF, 0xF7, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x0C, 0xFF, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF7, 0x00, 0x03, 0xFF, 0x70,
+  0x00, 0x00, 0x25, 0xFF, 0xFF, 0x30, 0x25, 0x52, 0x07, 0xFF, 0xC2, 0x03,
+  0xDF, 0xF0, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0xFD, 0x35, 0xFF, 0x50, 0x08,
+  0xFF, 0x50, 0x8F, 0xF5, 0x00, 0x00, 0x8F, 0xFC, 0x70, 0x07, 0xFF, 0xFF,
+  0xD3, 0x00, 0x5F, 0xFF, 0x0F, 0xFC, 0x20, 0x00, 0x7F, 0xFC, 0x20, 0x00,
+  0x08, 0xFF, 0xFA, 0x00, 0x02, 0xCF, 0xF0, 0xFF, 0xA0, 0x00, 0x2C, 0xFC,
+  0x00, 0x00, 0x00, 0x5F, 0xFF, 0x70, 0x00, 0x0A, 0xFF, 0x7F, 0xF3, 0x00,
+  0x05, 0xFF, 0x50, 0x00, 0x00, 0x05, 0xFF, 0xF0, 0x00, 0x00, 0xAF, 0xFA,
+  0xFF, 0x00, 0x00, 0x8F, 0xD3, 0x00, 0x00, 0x00, 0x5F, 0xFC, 0x00, 0x00,
+  0x0A, 0xFF, 0xAF, 0xF0, 0x00, 0x0F, 0xFA, 0x00, 0x00, 0x00, 0x05, 0xFF,
+  0x50, 0x00, 0x03, 0xDF, 0xFA, 0xFF, 0x00, 0x00, 0xFF, 0xA0, 0x00, 0x00,
+  0x00, 0xFF, 0xD3, 0x00, 0x00, 0x5F, 0xF5, 0xAF, 0xF0, 0x00, 0x0F, 0xFA,
+  0x00, 0x00, 0x00, 0x0F, 0xFA, 0x00, 0x00, 0x0C, 0xFC, 0x2A, 0xFF, 0x30,
+  0x00, 0xFF, 0xC2, 0x00, 0x00, 0x2C, 0xFF, 0x70, 0x00, 0x0A, 0xFF, 0x70,
+  0x3F, 0xFA, 0x00, 0x08, 0xFF, 0xC0, 0x00, 0x0C, 0xFF, 0xF0, 0x00, 0x03,
+  0xDF, 0xF0, 0x00, 0xFF, 0xC2, 0x00, 0x3D, 0xFF, 0xC5, 0x5C, 0xFC, 0xFF,
+  0xC5, 0x5C, 0xFF, 0xD3, 0x00, 0x08, 0xFF, 0x50, 0x00, 0x3F, 0xFF, 0xFF,
+  0xF5, 0x2F, 0xFF, 0xFF, 0xFF, 0x83, 0x00, 0x00, 0x3D, 0xFF, 0x30, 0x00,
+  0x07, 0xAA, 0x70, 0x00, 0x07, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0xAF,
+  0xFD, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xCF, 0xFF, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0xCF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAD, 0xFF, 0xFF, 0x55,
+  0x55, 0x55, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xAA, 0xFF, 0xFF, 0xFF, 0xDA, 0xA3, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x53, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xA0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0A, 0xFF, 0x8F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C,
+  0xFF, 0x3D, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF8, 0x0A,
+  0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF5, 0x07, 0xFF, 0xA0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC2, 0x00, 0xFF, 0xD3, 0x00, 0x00,
+  0x00, 0x00, 0x0A, 0xFF, 0x70, 0x00, 0xCF, 0xF5, 0x00, 0x00, 0x00, 0x00,
+  0x0A, 0xFF, 0x00, 0x00, 0x5F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFC,
+  0x00, 0x00, 0x3D, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00,
+  0x0A, 0xFF, 0x70, 0x00, 0x00, 0x00, 0xFF, 0xD3, 0x00, 0x00, 0x07, 0xFF,
+  0xA0, 0x00, 0x00, 0x00, 0xFF, 0xDA, 0xAA, 0xAA, 0xAA, 0xFF, 0xD3, 0x00,
+  0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3D,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x5F, 0xFC, 0x00,
+  0x00, 0x00, 0x00, 0x3D, 0xFF, 0x30, 0x00, 0xCF, 0xF5, 0x00, 0x00, 0x00,
+  0x00, 0x0A, 0xFF, 0xA0, 0x00, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xFF, 0xC2, 0x07, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF5,
+  0x0A, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF8, 0x3D, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x3A, 0xAA, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xAA, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x52, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x70, 0x00,
+  0x5F, 0xFC, 0xAA, 0xAA, 0xAA, 0xAD, 0xFF, 0xC2, 0x00, 0x5F, 0xF5, 0x00,
+  0x00, 0x00, 0x03, 0x8F, 0xF5, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00,
+  0x3D, 0xFF, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x00,
+  0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x5F, 0xF5, 0x00,
+  0x00, 0x00, 0x00, 0x3D, 0xF8, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x03,
+  0x8F, 0xD3, 0x00, 0x5F, 0xFC, 0xAA, 0xAA, 0xAA, 0xAD, 0xFF, 0x30, 0x00,
+  0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x30, 0x00, 0x5F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00,
+  0x3D, 0xFF, 0x30, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xA0,
+  0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x5F, 0xF5, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x5F, 0xF5, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5,
+  0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD3, 0x5F, 0xF5, 0x00,
+  0x00, 0x00, 0x00, 0x3D, 0xFF, 0xA0, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0x00,
+  0x3A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF5, 0x20, 0x00, 0x00, 0x03, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xC7, 0x00, 0x00, 0x0A, 0xDF, 0xF3,
+  0x00, 0x00, 0x7F, 0xFC, 0x20, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x30, 0x05,
+  0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x50, 0x0C, 0xFF, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0xCF, 0xC0, 0x0F, 0xFA, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x7A, 0xA0, 0x0F, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xAF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xAF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x7F, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0x53, 0x0F, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFA, 0x0F,
+  0xFC, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xF7, 0x08, 0xFF, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xF0, 0x03, 0xDF, 0xF3, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x30, 0x00, 0x00, 0x00,
+  0x7F, 0xFF, 0x50, 0x00, 0x0C, 0xFF, 0xFF, 0x85, 0x55, 0x5F, 0xFF, 0xF7,
+  0x00, 0x00, 0x02, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+  0x00, 0x03, 0xAC, 0xFF, 0xFF, 0xFA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x55, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7,
+  0x00, 0x00, 0x5F, 0xFC, 0xAA, 0xAA, 0xAA, 0xAD, 0xFF, 0xF8, 0x00, 0x05,
+  0xFF, 0x50, 0x00, 0x00, 0x00, 0x38, 0xFF, 0xF7, 0x00, 0x5F, 0xF5, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0xFF, 0xF5, 0x05, 0xFF, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0xFF, 0xC0, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+  0xFF, 0x05, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xF0, 0x5F,
+  0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xA5, 0xFF, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xFA, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0xA5, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0xFA, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xA5, 0xFF,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFA, 0x5F, 0xF5, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xFF, 0x75, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xAF, 0xF0, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF,
+  0x05, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x80, 0x5F, 0xF5,
+  0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0xD3, 0x05, 0xFF, 0x50, 0x00, 0x00,
+  0x00, 0x7C, 0xFF, 0xF3, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xD3, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x00,
+  0x3A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0x5F, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x05,
+  0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x5F, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+  0x05, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA5, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x3A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+  0xAA, 0x70, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x5F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x5F, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA,
+  0xAA, 0xA3, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x00, 0x5F, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x5F, 0xF5,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xA3,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0xAA,
+  0xAA, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0x30, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
+  0x30, 0x00, 0x00, 0x8F, 0xFF, 0xAA, 0x00, 0x00, 0x07, 0xCF, 0xFF, 0x30,
+  0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0x5F, 0xFD, 0x30, 0x2C,
+  0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF8, 0x05, 0xFF, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xCF, 0xF0, 0xFF, 0xD3, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFA, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xAF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0A, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x25, 0x55, 0x55, 0x55, 0x55,
+  0xAF, 0xF0, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xF0, 0x00,
+  0x00, 0x00, 0x02, 0x55, 0x55, 0x55, 0xCF, 0xF7, 0xFF, 0xA0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x0F, 0xFA, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xAF, 0xF0, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x5F, 0xFF, 0x08, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C,
+  0xFF, 0xF0, 0x3D, 0xFF, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+  0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0A, 0xDF, 0xFF, 0xF0, 0x00,
+  0x3D, 0xFF, 0xFF, 0x55, 0x55, 0x8F, 0xFF, 0x7A, 0xFF, 0x00, 0x00, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xAD,
+  0xFF, 0xFF, 0xDA, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x35, 0x55,
+  0x53, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F,
+  0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F,
+  0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+  0xAD, 0xFF, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F,
+  0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F,
+  0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x3A,
+  0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xAA, 0xAF, 0xFA, 0xFF, 0xAF,
+  0xFA, 0xFF, 0xAF, 0xFA, 0xFF, 0xAF, 0xFA, 0xFF, 0xAF, 0xFA, 0xFF, 0xAF,
+  0xFA, 0xFF, 0xAF, 0xFA, 0xFF, 0xAF, 0xFA, 0xFF, 0xAF, 0xFA, 0xFF, 0xAF,
+  0xFA, 0xFF, 0xAF, 0xFA, 0xFF, 0x7A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xAF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xAF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xAF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xAF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xAF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x0A, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xF7, 0xAA, 0x00, 0x00,
+  0x00, 0x0A, 0xFF, 0xAF, 0xF0, 0x00, 0x00, 0x00, 0xAF, 0xFA, 0xFF, 0x00,
+  0x00, 0x00, 0x0A, 0xFF, 0xAF, 0xF3, 0x00, 0x00, 0x05, 0xFF, 0xF3, 0xFF,
+  0xA0, 0x00, 0x00, 0xCF, 0xF8, 0x0C, 0xFF, 0xF5, 0x55, 0xCF, 0xFD, 0x30,
+  0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x0A, 0xDF, 0xFF, 0xFA, 0x30,
+  0x00, 0x00, 0x03, 0x55, 0x55, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xFC, 0x05, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x7F,
+  0xFC, 0x20, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFC, 0x00, 0x05,
+  0xFF, 0x50, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x20, 0x00, 0x5F, 0xF5, 0x00,
+  0x00, 0x00, 0x8F, 0xFC, 0x00, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x00, 0x7F,
+  0xFC, 0x20, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x8F, 0xFC, 0x00, 0x00,
+  0x00, 0x05, 0xFF, 0x50, 0x00, 0x7F, 0xFC, 0x20, 0x00, 0x00, 0x00, 0x5F,
+  0xF5, 0x00, 0x8F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x50, 0x7F,
+  0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x8F, 0xFF, 0xFF, 0x30,
+  0x00, 0x00, 0x00, 0x05, 0xFF, 0xCF, 0xFC, 0xCF, 0xFA, 0x00, 0x00, 0x00,
+  0x00, 0x5F, 0xFF, 0xFC, 0x00, 0xCF, 0xF8, 0x00, 0x00, 0x00, 0x05, 0xFF,
+  0xFC, 0x20, 0x05, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x5F, 0xFC, 0x00, 0x00,
+  0x07, 0xFF, 0xC2, 0x00, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x00, 0x0F, 0xFF,
+  0xC0, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x3D, 0xFF, 0x30, 0x00,
+  0x05, 0xFF, 0x50, 0x00, 0x00, 0x00, 0xAF, 0xFD, 0x30, 0x00, 0x5F, 0xF5,
+  0x00, 0x00, 0x00, 0x00, 0xCF, 0xF8, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x00,
+  0x00, 0x02, 0xCF, 0xF7, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xFF, 0xC2, 0x05, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xC0,
+  0x3A, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xAA, 0x70, 0x5F, 0xF5,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA5,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x3A, 0xAA, 0xAA, 0xAA, 0xAA,
+  0xAA, 0xAA, 0x70, 0x5F, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0x5F, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
+  0xFF, 0x5F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF,
+  0x5F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xFF, 0xFF, 0x5F,
+  0xFC, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xDD, 0xFF, 0x5F, 0xF5,
+  0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xAA, 0xFF, 0x5F, 0xF5, 0xCF,
+  0xC2, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x7A, 0xFF, 0x5F, 0xF5, 0x5F, 0xF5,
+  0x00, 0x00, 0x00, 0x07, 0xFF, 0x0A, 0xFF, 0x5F, 0xF5, 0x3D, 0xF8, 0x00,
+  0x00, 0x00, 0x0A, 0xFC, 0x0A, 0xFF, 0x5F, 0xF5, 0x0A, 0xFF, 0x00, 0x00,
+  0x00, 0x3D, 0xF5, 0x0A, 0xFF, 0x5F, 0xF5, 0x07, 0xFF, 0x30, 0x00, 0x00,
+  0x8F, 0xD3, 0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0xFF, 0xA0, 0x00, 0x00, 0xFF,
+  0xA0, 0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0xCF, 0xC2, 0x00, 0x03, 0xFF, 0x70,
+  0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x5F, 0xF5, 0x00, 0x0A, 0xFF, 0x00, 0x0A,
+  0xFF, 0x5F, 0xF5, 0x00, 0x3D, 0xF8, 0x00, 0x2C, 0xFC, 0x00, 0x0A, 0xFF,
+  0x5F, 0xF5, 0x00, 0x0A, 0xFF, 0x00, 0x5F, 0xF5, 0x00, 0x0A, 0xFF, 0x5F,
+  0xF5, 0x00, 0x07, 0xFF, 0x30, 0x8F, 0xD3, 0x00, 0x0A, 0xFF, 0x5F, 0xF5,
+  0x00, 0x00, 0xFF, 0xA0, 0xFF, 0xA0, 0x00, 0x0A, 0xFF, 0x5F, 0xF5, 0x00,
+  0x00, 0x5F, 0xC5, 0xFF, 0x70, 0x00, 0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x00,
+  0x5F, 0xFF, 0xFF, 0x00, 0x00, 0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x00, 0x0A,
+  0xFF, 0xFC, 0x00, 0x00, 0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x00, 0x0A, 0xFF,
+  0xF5, 0x00, 0x00, 0x0A, 0xFF, 0x3A, 0xA3, 0x00, 0x00, 0x00, 0xAA, 0xA3,
+  0x00, 0x00, 0x07, 0xAA, 0x5F, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0A,
+  0xFF, 0x5F, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F, 0xFF,
+  0xF5, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F, 0xFF, 0xFC, 0x00, 0x00,
+  0x00, 0x00, 0x0A, 0xFF, 0x5F, 0xFC, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x0A,
+  0xFF, 0x5F, 0xF5, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F, 0xF5,
+  0x3D, 0xFF, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F, 0xF5, 0x0A, 0xFF, 0x70,
+  0x00, 0x00, 0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0xFF, 0xC2, 0x00, 0x00, 0x0A,
+  0xFF, 0x5F, 0xF5, 0x00, 0x8F, 0xFC, 0x00, 0x00, 0x0A, 0xFF, 0x5F, 0xF5,
+  0x00, 0x0A, 0xFF, 0x30, 0x00, 0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x03, 0xFF,
+  0xD3, 0x00, 0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x00, 0x5F, 0xF8, 0x00, 0x0A,
+  0xFF, 0x5F, 0xF5, 0x00, 0x00, 0x2C, 0xFF, 0x00, 0x0A, 0xFF, 0x5F, 0xF5,
+  0x00, 0x00, 0x07, 0xFF, 0xC2, 0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x00, 0x00,
+  0x8F, 0xF5, 0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x3D, 0xFF, 0x3A,
+  0xFF, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xAA, 0xFF, 0x5F, 0xF5,
+  0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0x5F, 0xF5, 0x00, 0x00, 0x00,
+  0x00, 0x5F, 0xFF, 0xFF, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
+  0xFF, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x3A, 0xA3,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x7A,
+  0xAA, 0xAA, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF8, 0x30, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFD, 0x30, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xAA, 0x00, 0x00,
+  0x3A, 0xCF, 0xFF, 0x30, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0xCF, 0xFD, 0x30, 0x00, 0x2C, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xCF, 0xF8, 0x00, 0x05, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0xCF, 0xF0, 0x00, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xFF, 0xA0, 0x0F, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0xFA, 0x0A, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xCF, 0xF5, 0xAF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0xFF, 0x5A, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F,
+  0xF5, 0xAF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF,
+  0x5A, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5,
+  0xAF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x57,
+  0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD3, 0x0F,
+  0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFA, 0x00, 0xCF,
+  0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x70, 0x05, 0xFF,
+  0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xDF, 0xF0, 0x00, 0x0A, 0xFF,
+  0xC2, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF5, 0x00, 0x00, 0x3F, 0xFF,
+  0xC0, 0x00, 0x00, 0x00, 0x03, 0xDF, 0xFC, 0x20, 0x00, 0x00, 0x3D, 0xFF,
+  0xFF, 0x55, 0x55, 0x8F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x20, 0x00, 0x00, 0x00, 0x00, 0x07, 0xAD,
+  0xFF, 0xFF, 0xFC, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35,
+  0x55, 0x55, 0x20, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x55, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00,
+  0x5F, 0xFC, 0xAA, 0xAA, 0xAA, 0xAD, 0xFF, 0xF8, 0x05, 0xFF, 0x50, 0x00,
+  0x00, 0x00, 0x38, 0xFF, 0xF0, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xFF, 0xA5, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFA, 0x5F, 0xF5,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xA5, 0xFF, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0xFA, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xA5,
+  0xFF, 0x50, 0x00, 0x00, 0x00, 0x03, 0xDF, 0xF3, 0x5F, 0xF8, 0x55, 0x55,
+  0x55, 0x5C, 0xFF, 0xFC, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x20, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x00, 0x05, 0xFF, 0x85,
+  0x55, 0x55, 0x55, 0x53, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F,
+  0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3A, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x7A, 0xAA, 0xAA, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x5C, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x30, 0x00, 0x00, 0x00, 0x8F,
+  0xFF, 0xAA, 0x00, 0x00, 0x3A, 0xCF, 0xFF, 0x30, 0x00, 0x00, 0x7F, 0xFF,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0xCF, 0xFD, 0x30, 0x00, 0x2C, 0xFF, 0x70,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF8, 0x00, 0x05, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0xCF, 0xF0, 0x00, 0xFF, 0xD3, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xA0, 0x0F, 0xFA, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xFA, 0x0A, 0xFF, 0x70, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xCF, 0xF5, 0xAF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0xFF, 0x5A, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x5F, 0xF5, 0xAF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0xFF, 0x5A, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x5F, 0xF5, 0xAF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x05, 0xFF, 0x57, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0xD3, 0x0F, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0xFA, 0x00, 0xCF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x25, 0x30, 0x0A,
+  0xFF, 0x70, 0x05, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0C, 0xFD, 0x33, 0xDF,
+  0xF0, 0x00, 0x0A, 0xFF, 0xC2, 0x00, 0x00, 0x00, 0x3D, 0xFF, 0xFF, 0xF5,
+  0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x20,
+  0x00, 0x00, 0x3D, 0xFF, 0xFF, 0x55, 0x55, 0x8F, 0xFF, 0xFF, 0xC2, 0x00,
+  0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+  0x00, 0x00, 0x07, 0xAD, 0xFF, 0xFF, 0xFC, 0xA3, 0x07, 0xFF, 0xA0, 0x00,
+  0x00, 0x00, 0x00, 0x35, 0x55, 0x55, 0x20, 0x00, 0x08, 0xFA, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x5F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x30, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xD3, 0x00, 0x5F, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0xCF, 0xFF,
+  0x30, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0xA0, 0x5F, 0xF5,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF5, 0x5F, 0xF5, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x5F, 0xF5, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F,
+  0xF5, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x5F, 0xF5,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xD3, 0x5F, 0xF5, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0xFF, 0xA0, 0x5F, 0xF8, 0x55, 0x55, 0x55, 0x55, 0x8F, 0xFC,
+  0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0x00, 0x5F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x5F, 0xF8, 0x55, 0x55, 0x55,
+  0x55, 0x8F, 0xFF, 0x70, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0xC2, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF5, 0x5F, 0xF5,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x5F, 0xF5, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x5F, 0xF5, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F,
+  0xF5, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x5F, 0xF5,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x5F, 0xF5, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x5F, 0xFC, 0x3A, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A,
+  0xAA, 0x00, 0x00, 0x00, 0x7A, 0xAA, 0xAA, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0x2C, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFA, 0x30, 0x00, 0x2C, 0xFF, 0xA3, 0x00, 0x00, 0x3A,
+  0xCF, 0xF8, 0x00, 0x05, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xCF, 0xF0,
+  0x00, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xA0, 0x0F, 0xFA,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFA, 0x00, 0xFF, 0xA0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x5F, 0xFF, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0xCF, 0xFF, 0xFA, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAD,
+  0xFF, 0xFF, 0xFF, 0xF8, 0x52, 0x00, 0x00, 0x00, 0x00, 0x35, 0xCF, 0xFF,
+  0xFF, 0xFF, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xCF, 0xFF,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x5F, 0xFF, 0xF7, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC2, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x5A, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x5F, 0xF5, 0xAF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0xFF, 0x50, 0xFF, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD3, 0x0F,
+  0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFA, 0x00, 0x3D, 0xFF, 0xFF,
+  0x55, 0x55, 0x5C, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x20, 0x00, 0x00, 0x07, 0xAD, 0xFF, 0xFF, 0xFC, 0xA3, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x35, 0x55, 0x55, 0x20, 0x00, 0x00, 0x00, 0xAF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xAF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x7A, 0xAA, 0xAA, 0xAC, 0xFF, 0xCA, 0xAA,
+  0xAA, 0xA7, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xAA, 0x30, 0x00,
+  0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F,
+  0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F,
+  0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F,
+  0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F,
+  0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F,
+  0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xFF, 0x0A, 0xFF, 0x30, 0x00,
+  0x00, 0x00, 0x00, 0x8F, 0xF5, 0x0A, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x07,
+  0xFF, 0xF5, 0x00, 0xCF, 0xFF, 0xC5, 0x55, 0x55, 0xFF, 0xFF, 0x70, 0x00,
+  0x2C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3A, 0xFF,
+  0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00,
+  0x00, 0x00, 0x5F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF5,
+  0x2C, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF5, 0x0A, 0xFF,
+  0xA0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xA0, 0x03, 0xFF, 0xA0, 0x00,
+  0x00, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0xFF, 0xF5, 0x00, 0x00, 0x00,
+  0x00, 0x2C, 0xFF, 0x00, 0x00, 0x8F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x5F,
+  0xFF, 0x00, 0x00, 0x5F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF5, 0x00,
+  0x00, 0x2C, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF5, 0x00, 0x00, 0x07,
+  0xFF, 0xA0, 0x00, 0x00, 0x03, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0xFF, 0xA0,
+  0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0xCF, 0xF5, 0x00, 0x00,
+  0x0A, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFC, 0x00, 0x00, 0x3D, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x3D, 0xFF, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00,
+  0x00, 0x00, 0x0A, 0xFF, 0x70, 0x00, 0xCF, 0xC2, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xFF, 0xA0, 0x00, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0xD3, 0x07, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x0A,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFC, 0x3D, 0xF8, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0A, 0xFF, 0xCF, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xAA,
+  0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF,
+  0xA0, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xA5, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0x05, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFA, 0x0A, 0xFF, 0x30,
+  0x00, 0x00, 0x00, 0x8F, 0xFF, 0xC2, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0x00,
+  0xAF, 0xFA, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x05,
+  0xFF, 0xF0, 0x07, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00,
+  0x00, 0x00, 0x5F, 0xFC, 0x00, 0x0F, 0xFD, 0x30, 0x00, 0x00, 0x7F, 0xF5,
+  0xCF, 0xF0, 0x00, 0x00, 0x0C, 0xFF, 0x50, 0x00, 0xFF, 0xF5, 0x00, 0x00,
+  0x0A, 0xFF, 0x0A, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF5, 0x00, 0x08, 0xFF,
+  0x50, 0x00, 0x03, 0xDF, 0xF0, 0x3F, 0xF7, 0x00, 0x00, 0x0F, 0xFC, 0x20,
+  0x00, 0x5F, 0xFF, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0xFF, 0xA0, 0x00, 0x03,
+  0xFF, 0xA0, 0x00, 0x02, 0xCF, 0xF0, 0x00, 0x05, 0xFF, 0x50, 0x0F, 0xFA,
+  0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0x30, 0x00, 0xFF, 0xD3,
+  0x00, 0x5F, 0xF5, 0x00, 0x0A, 0xFF, 0x00, 0x00, 0x00, 0xAF, 0xFA, 0x00,
+  0x0F, 0xFA, 0x00, 0x05, 0xFF, 0x50, 0x03, 0xDF, 0xF0, 0x00, 0x00, 0x00,
+  0xFF, 0xA0, 0x03, 0xFF, 0x70, 0x00, 0x3D, 0xFF, 0x00, 0x5F, 0xFC, 0x00,
+  0x00, 0x00, 0x0F, 0xFA, 0x00, 0xAF, 0xF0, 0x00, 0x00, 0xAF, 0xF0, 0x05,
+  0xFF, 0x50, 0x00, 0x00, 0x00, 0xCF, 0xF5, 0x2C, 0xFF, 0x00, 0x00, 0x07,
+  0xFF, 0x30, 0x8F, 0xF5, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x55, 0xFF, 0x80,
+  0x00, 0x00, 0x0F, 0xFA, 0x0F, 0xFC, 0x20, 0x00, 0x00, 0x00, 0x5F, 0xF8,
+  0x5F, 0xF5, 0x00, 0x00, 0x00, 0xFF, 0xC2, 0xFF, 0xA0, 0x00, 0x00, 0x00,
+  0x02, 0xCF, 0xFC, 0xFF, 0x50, 0x00, 0x00, 0x08, 0xFF, 0xCF, 0xFA, 0x00,
+  0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x5F, 0xFF,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFA, 0x00, 0x00, 0x00,
+  0x02, 0xCF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xA3, 0x00,
+  0x00, 0x00, 0x0A, 0xFF, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF5,
+  0x03, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xC2, 0x00, 0x3D,
+  0xFF, 0x30, 0x00, 0x00, 0x00, 0x8F, 0xFC, 0x00, 0x00, 0x0A, 0xFF, 0xA0,
+  0x00, 0x00, 0x00, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0xCF, 0xF8, 0x00, 0x00,
+  0x2C, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x00, 0x00, 0x5F, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC2, 0x03, 0xFF, 0xD3, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xF5, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3D, 0xFF, 0x8F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+  0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF,
+  0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xC2, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3D, 0xFF, 0x8F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0xF5, 0x0A, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
+  0xC2, 0x03, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x00, 0x00,
+  0x5F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF8, 0x00, 0x00, 0x2C, 0xFF,
+  0x70, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0x07, 0xFF, 0xF5, 0x00,
+  0x00, 0x3D, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x8F, 0xFC, 0x00, 0x03, 0xFF,
+  0xF5, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xFF, 0xA0, 0x0A, 0xFF, 0xC2, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xFF, 0xD3, 0x3A, 0xAA, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xAA, 0xAA, 0x3D, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x5F, 0xFF, 0x70, 0xAF, 0xFD, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF,
+  0x80, 0x00, 0xCF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD3, 0x00,
+  0x05, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xDF, 0xF3, 0x00, 0x00, 0x07,
+  0xFF, 0xC2, 0x00, 0x00, 0x00, 0x8F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+  0x50, 0x00, 0x00, 0x0F, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x3D, 0xFF, 0x00,
+  0x00, 0x0A, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xF7, 0x00, 0x03,
+  0xDF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF5, 0x00, 0xFF, 0xD3,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xC0, 0x7F, 0xFA, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5C, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x5F, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0xCF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xAF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0A, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xAF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xCF, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x2C, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C,
+  0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD3, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xDF, 0xFA, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xAF, 0xFC, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x5F, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0C, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0xD3,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xF3, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xDF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x3A,
+  0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x70, 0xFF, 0xFF, 0xF5,
+  0xFF, 0xFF, 0xF5, 0xFF, 0xDA, 0xA3, 0xFF, 0xA0, 0x00, 0xFF, 0xA0, 0x00,
+  0xFF, 0xA0, 0x00, 0xFF, 0xA0, 0x00, 0xFF, 0xA0, 0x00, 0xFF, 0xA0, 0x00,
+  0xFF, 0xA0, 0x00, 0xFF, 0xA0, 0x00, 0xFF, 0xA0, 0x00, 0xFF, 0xA0, 0x00,
+  0xFF, 0xA0, 0x00, 0xFF, 0xA0, 0x00, 0xFF, 0xA0, 0x00, 0xFF, 0xA0, 0x00,
+  0xFF, 0xA0, 0x00, 0xFF, 0xA0, 0x00, 0xFF, 0xA0, 0x00, 0xFF, 0xA0, 0x00,
+  0xFF, 0xA0, 0x00, 0xFF, 0xA0, 0x00, 0xFF, 0xA0, 0x00, 0xFF, 0xA0, 0x00,
+  0xFF, 0xA0, 0x00, 0xFF, 0xC5, 0x52, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xF5,
+  0x55, 0x55, 0x52, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00,
+  0x5F, 0xA0, 0x00, 0x00, 0x02, 0xCA, 0x00, 0x00, 0x00, 0x0A, 0xF5, 0x00,
+  0x00, 0x00, 0x3F, 0x50, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0F,
+  0xF0, 0x00, 0x00, 0x00, 0x5F, 0x30, 0x00, 0x00, 0x05, 0xFA, 0x00, 0x00,
+  0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0xAD, 0x30, 0x00, 0x00, 0x00, 0xF5,
+  0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xCF, 0x00, 0x00, 0x00,
+  0x05, 0xF7, 0x00, 0x00, 0x00, 0x3D, 0xA0, 0x00, 0x00, 0x00, 0xAA, 0x00,
+  0x00, 0x00, 0x0A, 0xF5, 0x00, 0x00, 0x00, 0x3F, 0x50, 0x00, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x5F, 0xA0, 0x00,
+  0x00, 0x02, 0x53, 0x5F, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0x3A, 0xAD, 0xFF,
+  0x00, 0x0A, 0xFF, 0x00, 0x0A, 0xFF, 0x00, 0x0A, 0xFF, 0x00, 0x0A, 0xFF,
+  0x00, 0x0A, 0xFF, 0x00, 0x0A, 0xFF, 0x00, 0x0A, 0xFF, 0x00, 0x0A, 0xFF,
+  0x00, 0x0A, 0xFF, 0x00, 0x0A, 0xFF, 0x00, 0x0A, 0xFF, 0x00, 0x0A, 0xFF,
+  0x00, 0x0A, 0xFF, 0x00, 0x0A, 0xFF, 0x00, 0x0A, 0xFF, 0x00, 0x0A, 0xFF,
+  0x00, 0x0A, 0xFF, 0x00, 0x0A, 0xFF, 0x00, 0x0A, 0xFF, 0x00, 0x0A, 0xFF,
+  0x00, 0x0A, 0xFF, 0x00, 0x0A, 0xFF, 0x00, 0x0A, 0xFF, 0x25, 0x5C, 0xFF,
+  0x5F, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0x25, 0x55, 0x55, 0x00, 0x00, 0x05,
+  0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00,
+  0xAF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x3D, 0xFF, 0xFC, 0x00, 0x00, 0x00,
+  0x05, 0xFA, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xCF, 0xA0, 0x8F, 0x70, 0x00,
+  0x00, 0x3F, 0xF0, 0x05, 0xFC, 0x20, 0x00, 0x0A, 0xF8, 0x00, 0x2C, 0xF5,
+  0x00, 0x02, 0xCD, 0x30, 0x00, 0x7F, 0x80, 0x00, 0x5F, 0xA0, 0x00, 0x00,
+  0xFF, 0x00, 0x0F, 0xF7, 0x00, 0x00, 0x0C, 0xFA, 0x00, 0xFF, 0x00, 0x00,
+  0x00, 0x5F, 0xA0, 0x7A, 0x30, 0x00, 0x00, 0x00, 0x7A, 0x30, 0x35, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3A, 0xAA, 0x70, 0x00, 0x00, 0xCF, 0xC2,
+  0x00, 0x00, 0x2C, 0xFC, 0x00, 0x00, 0x00, 0xCF, 0x30, 0x00, 0x00, 0x2C,
+  0xD3, 0x00, 0x00, 0x07, 0xAA, 0xAA, 0xA3, 0x00, 0x00, 0x00, 0x02, 0xCF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0x20, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0x00, 0xAF, 0xFD, 0x30, 0x00, 0x0A, 0xDF, 0xFA, 0x00, 0x0A,
+  0xFF, 0x30, 0x00, 0x00, 0x03, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xA0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xCF, 0xFA, 0x00, 0x00, 0x00, 0x00,
+  0xAA, 0xAA, 0xFF, 0xFF, 0xA0, 0x00, 0x05, 0xCF, 0xFF, 0xFF, 0xFD, 0xAF,
+  0xFA, 0x00, 0x07, 0xFF, 0xFF, 0xC5, 0x55, 0x30, 0xFF, 0xA0, 0x05, 0xFF,
+  0xF7, 0x00, 0x00, 0x00, 0x0F, 0xFA, 0x00, 0x5F, 0xF8, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0xA0, 0x05, 0xFF, 0x50, 0x00, 0x00, 0x00, 0xAF, 0xFA, 0x00,
+  0x5F, 0xFC, 0x00, 0x00, 0x00, 0xAD, 0xFF, 0xA0, 0x00, 0xAF, 0xFF, 0x85,
+  0x58, 0xFF, 0xCF, 0xFC, 0x53, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0x8F,
+  0xFF, 0xA0, 0x03, 0xAF, 0xFF, 0xFA, 0xA0, 0x03, 0xDF, 0xFA, 0x00, 0x00,
+  0x55, 0x55, 0x00, 0x00, 0x03, 0x55, 0x30, 0xFF, 0xA0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xA0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFA, 0x00, 0x0A,
+  0xAA, 0xA0, 0x00, 0x00, 0xFF, 0xA3, 0x8F, 0xFF, 0xFF, 0xF8, 0x00, 0x0F,
+  0xFA, 0xAF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0xFF, 0xFF, 0xD3, 0x00, 0x3A,
+  0xFF, 0xF5, 0x0F, 0xFF, 0xF3, 0x00, 0x00, 0x08, 0xFF, 0xC0, 0xFF, 0xF5,
+  0x00, 0x00, 0x00, 0x0A, 0xFF, 0x0F, 0xFF, 0x50, 0x00, 0x00, 0x00, 0xAF,
+  0xF7, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xAF, 0xFA, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0xFA, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xAF,
+  0xFA, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFA, 0xFF, 0xA0, 0x00, 0x00, 0x00,
+  0x03, 0xFF, 0xAF, 0xFD, 0x30, 0x00, 0x00, 0x00, 0xAF, 0xF3, 0xFF, 0xF8,
+  0x00, 0x00, 0x00, 0x2C, 0xFF, 0x0F, 0xFF, 0xF7, 0x00, 0x00, 0x0C, 0xFF,
+  0x80, 0xFF, 0xCF, 0xF8, 0x55, 0x8F, 0xFF, 0xD3, 0x0F, 0xF2, 0xCF, 0xFF,
+  0xFF, 0xFF, 0xF3, 0x00, 0xAA, 0x00, 0xAD, 0xFF, 0xFF, 0xA3, 0x00, 0x00,
+  0x00, 0x00, 0x35, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA,
+  0x70, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x3D,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x0C, 0xFF,
+  0xF0, 0x07, 0xFF, 0xC2, 0x00, 0x00, 0x2C, 0xFF, 0x00, 0xAF, 0xF0, 0x00,
+  0x00, 0x00, 0x0A, 0xA7, 0x3D, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x2C, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x70, 0xAF, 0xF3, 0x00,
+  0x00, 0x00, 0x3F, 0xFA, 0x03, 0xFF, 0xD3, 0x00, 0x00, 0x3D, 0xFF, 0x30,
+  0x0C, 0xFF, 0xF5, 0x55, 0x5F, 0xFF, 0xC0, 0x00, 0x2C, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xC2, 0x00, 0x00, 0x0A, 0xDF, 0xFF, 0xFA, 0xA0, 0x00, 0x00, 0x00,
+  0x03, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0A, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0A, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x00,
+  0x07, 0xAA, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8,
+  0x3A, 0xFF, 0x00, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xFF, 0x00, 0xFF,
+  0xFC, 0x70, 0x00, 0xAD, 0xFF, 0xFF, 0x07, 0xFF, 0xC2, 0x00, 0x00, 0x03,
+  0xFF, 0xFF, 0x0A, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x3D, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00,
+  0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F, 0xF5,
+  0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00,
+  0x0A, 0xFF, 0x5F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0x2C, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x0A, 0xFF, 0x30, 0x00, 0x00, 0x00,
+  0x8F, 0xFF, 0x03, 0xFF, 0xD3, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0xCF,
+  0xFF, 0xC5, 0x55, 0xFF, 0xFC, 0xFF, 0x00, 0x2C, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC2, 0xFF, 0x00, 0x00, 0xAD, 0xFF, 0xFF, 0xDA, 0x00, 0xAA, 0x00, 0x00,
+  0x03, 0x55, 0x55, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x70,
+  0x00, 0x00, 0x00, 0x03, 0x8F, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x3D,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x00, 0x00, 0x8F, 0xFC, 0x70, 0x00, 0xCF,
+  0xFF, 0x00, 0x07, 0xFF, 0xC2, 0x00, 0x00, 0x2C, 0xFF, 0x70, 0x0A, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xA0, 0x3D, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0xD3, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x5F, 0xFC,
+  0xAA, 0xAA, 0xAA, 0xAA, 0xCF, 0xF5, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF5, 0x5F, 0xF8, 0x55, 0x55, 0x55, 0x55, 0x55, 0x52, 0x5F, 0xF5,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFC, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0A, 0xFF, 0x30, 0x00, 0x00, 0x00, 0xFF, 0xA0, 0x03, 0xFF,
+  0xD3, 0x00, 0x00, 0x07, 0xFF, 0xA0, 0x00, 0xCF, 0xFF, 0x55, 0x55, 0xFF,
+  0xFC, 0x00, 0x00, 0x2C, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00,
+  0xAA, 0xFF, 0xFF, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x30,
+  0x00, 0x00, 0x00, 0x03, 0x8F, 0xF5, 0x00, 0x0A, 0xFF, 0xF5, 0x00, 0x5F,
+  0xFF, 0xA3, 0x00, 0x5F, 0xF8, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x5F,
+  0xF5, 0x00, 0x5F, 0xFF, 0xFF, 0xF5, 0x5F, 0xFF, 0xFF, 0xF5, 0x00, 0x5F,
+  0xF5, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x5F,
+  0xF5, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x5F,
+  0xF5, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x5F,
+  0xF5, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x5F,
+  0xF5, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x3A, 0xA3, 0x00, 0x00, 0x00,
+  0x00, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC5,
+  0x5F, 0xF5, 0x00, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xF5, 0x00, 0xFF,
+  0xFC, 0x70, 0x00, 0xCF, 0xFF, 0xF5, 0x07, 0xFF, 0xC2, 0x00, 0x00, 0x2C,
+  0xFF, 0xF5, 0x0A, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF5, 0x3D, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x8F, 0xF5, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00,
+  0x5F, 0xF5, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x5F, 0xF5,
+  0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00,
+  0x5F, 0xF5, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x2C, 0xFC,
+  0x00, 0x00, 0x00, 0x00, 0xCF, 0xF5, 0x0A, 0xFF, 0x30, 0x00, 0x00, 0x03,
+  0xFF, 0xF5, 0x03, 0xFF, 0xD3, 0x00, 0x00, 0x3D, 0xFF, 0xF5, 0x00, 0xCF,
+  0xFF, 0xC5, 0x55, 0xFF, 0xCF, 0xF5, 0x00, 0x2C, 0xFF, 0xFF, 0xFF, 0xF8,
+  0x5F, 0xF5, 0x00, 0x00, 0xAD, 0xFF, 0xFC, 0x70, 0x5F, 0xF5, 0x00, 0x00,
+  0x03, 0x55, 0x52, 0x00, 0x5F, 0xF5, 0x03, 0x55, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xA0, 0x0A, 0xFF, 0x70, 0x00, 0x00, 0x07, 0xFF, 0xA0, 0x00, 0xFF,
+  0xF8, 0x55, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0x00, 0x00, 0x07, 0xAD, 0xFF, 0xFF, 0xDA, 0x70, 0x00, 0x00, 0x00,
+  0x03, 0x55, 0x55, 0x30, 0x00, 0x00, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xA0, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xA0, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0xFA, 0x00, 0x7A, 0xAA, 0xA0, 0x00, 0xFF, 0xA0, 0x8F,
+  0xFF, 0xFF, 0xC5, 0x0F, 0xFA, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
+  0xA3, 0x00, 0xAD, 0xFF, 0xAF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFA, 0xFF,
+  0xF5, 0x00, 0x00, 0x00, 0xFF, 0xAF, 0xFC, 0x20, 0x00, 0x00, 0x0F, 0xFA,
+  0xFF, 0xA0, 0x00, 0x00, 0x00, 0xFF, 0xAF, 0xFA, 0x00, 0x00, 0x00, 0x0F,
+  0xFA, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0xFF, 0xAF, 0xFA, 0x00, 0x00, 0x00,
+  0x0F, 0xFA, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0xFF, 0xAF, 0xFA, 0x00, 0x00,
+  0x00, 0x0F, 0xFA, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0xFF, 0xAF, 0xFA, 0x00,
+  0x00, 0x00, 0x0F, 0xFA, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0xFF, 0xAF, 0xFA,
+  0x00, 0x00, 0x00, 0x0F, 0xFA, 0xAA, 0x70, 0x00, 0x00, 0x00, 0xAA, 0x70,
+  0xFF, 0xAF, 0xFA, 0xFF, 0xA5, 0x53, 0x00, 0x00, 0x00, 0xFF, 0xAF, 0xFA,
+  0xFF, 0xAF, 0xFA, 0xFF, 0xAF, 0xFA, 0xFF, 0xAF, 0xFA, 0xFF, 0xAF, 0xFA,
+  0xFF, 0xAF, 0xFA, 0xFF, 0xAF, 0xFA, 0xFF, 0xAF, 0xFA, 0xAA, 0x70, 0x00,
+  0x5F, 0xF5, 0x00, 0x5F, 0xF5, 0x00, 0x5F, 0xF5, 0x00, 0x25, 0x52, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x5F, 0xF5, 0x00,
+  0x5F, 0xF5, 0x00, 0x5F, 0xF5, 0x00, 0x5F, 0xF5, 0x00, 0x5F, 0xF5, 0x00,
+  0x5F, 0xF5, 0x00, 0x5F, 0xF5, 0x00, 0x5F, 0xF5, 0x00, 0x5F, 0xF5, 0x00,
+  0x5F, 0xF5, 0x00, 0x5F, 0xF5, 0x00, 0x5F, 0xF5, 0x00, 0x5F, 0xF5, 0x00,
+  0x5F, 0xF5, 0x00, 0x5F, 0xF5, 0x00, 0x5F, 0xF5, 0x00, 0x5F, 0xF5, 0x00,
+  0x5F, 0xF5, 0x00, 0x5F, 0xF5, 0x55, 0xFF, 0xF5, 0xFF, 0xFF, 0xC2, 0xFF,
+  0xFC, 0x70, 0x55, 0x52, 0x00, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xA0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xA0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0xA0, 0x00, 0x00, 0x2C, 0xFF, 0x70, 0xFF, 0xA0, 0x00, 0x00, 0xCF, 0xF8,
+  0x00, 0xFF, 0xA0, 0x00, 0x2C, 0xFF, 0x70, 0x00, 0xFF, 0xA0, 0x00, 0xCF,
+  0xF8, 0x00, 0x00, 0xFF, 0xA0, 0x2C, 0xFF, 0x70, 0x00, 0x00, 0xFF, 0xA0,
+  0xCF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xCC, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0xFF, 0xFF, 0x77, 0xFF, 0xC2,
+  0x00, 0x00, 0xFF, 0xF8, 0x00, 0x8F, 0xFC, 0x00, 0x00, 0xFF, 0xA0, 0x00,
+  0x3D, 0xFF, 0x30, 0x00, 0xFF, 0xA0, 0x00, 0x03, 0xFF, 0xA0, 0x00, 0xFF,
+  0xA0, 0x00, 0x00, 0xCF, 0xF8, 0x00, 0xFF, 0xA0, 0x00, 0x00, 0x5F, 0xFF,
+  0x00, 0xFF, 0xA0, 0x00, 0x00, 0x07, 0xFF, 0xA0, 0xFF, 0xA0, 0x00, 0x00,
+  0x00, 0xFF, 0xD3, 0xAA, 0x70, 0x00, 0x00, 0x00, 0x3A, 0xAA, 0xFF, 0xAF,
+  0xFA, 0xFF, 0xAF, 0xFA, 0xFF, 0xAF, 0xFA, 0xFF, 0xAF, 0xFA, 0xFF, 0xAF,
+  0xFA, 0xFF, 0xAF, 0xFA, 0xFF, 0xAF, 0xFA, 0xFF, 0xAF, 0xFA, 0xFF, 0xAF,
+  0xFA, 0xFF, 0xAF, 0xFA, 0xFF, 0xAF, 0xFA, 0xAA, 0x70, 0x00, 0x00, 0x07,
+  0xAA, 0xA3, 0x00, 0x00, 0x3A, 0xAA, 0x70, 0x00, 0xFF, 0x03, 0xFF, 0xFF,
+  0xFF, 0x30, 0x2C, 0xFF, 0xFF, 0xFF, 0x30, 0xFF, 0x3D, 0xFF, 0xFF, 0xFF,
+  0xD3, 0xCF, 0xFF, 0xFF, 0xFF, 0xA0, 0xFF, 0xFF, 0x70, 0x00, 0xCF, 0xFF,
+  0xFC, 0x00, 0x07, 0xFF, 0xF5, 0xFF, 0xF8, 0x00, 0x00, 0x2C, 0xFF, 0xC2,
+  0x00, 0x00, 0x8F, 0xF5, 0xFF, 0xD3, 0x00, 0x00, 0x0A, 0xFF, 0x70, 0x00,
+  0x00, 0x5F, 0xF5, 0xFF, 0xA0, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x00, 0x00,
+  0x5F, 0xF5, 0xFF, 0xA0, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x00, 0x00, 0x5F,
+  0xF5, 0xFF, 0xA0, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x00, 0x00, 0x5F, 0xF5,
+  0xFF, 0xA0, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0xFF,
+  0xA0, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0xFF, 0xA0,
+  0x00, 0x00, 0x0A, 0xFF, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0xFF, 0xA0, 0x00,
+  0x00, 0x0A, 0xFF, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0xFF, 0xA0, 0x00, 0x00,
+  0x0A, 0xFF, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0xFF, 0xA0, 0x00, 0x00, 0x0A,
+  0xFF, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0xFF, 0xA0, 0x00, 0x00, 0x0A, 0xFF,
+  0x00, 0x00, 0x00, 0x5F, 0xF5, 0xFF, 0xA0, 0x00, 0x00, 0x0A, 0xFF, 0x00,
+  0x00, 0x00, 0x5F, 0xF5, 0xAA, 0x70, 0x00, 0x00, 0x07, 0xAA, 0x00, 0x00,
+  0x00, 0x3A, 0xA3, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x00, 0x00, 0xFF, 0x03,
+  0x8F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0x70,
+  0xFF, 0x8F, 0xD3, 0x00, 0x3A, 0xFF, 0xF5, 0xFF, 0xFF, 0x30, 0x00, 0x00,
+  0xFF, 0xF5, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0xFF, 0xC2, 0x00,
+  0x00, 0x00, 0x5F, 0xF5, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0xFF,
+  0xA0, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x5F,
+  0xF5, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0xFF, 0xA0, 0x00, 0x00,
+  0x00, 0x5F, 0xF5, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0xFF, 0xA0,
+  0x00, 0x00, 0x00, 0x5F, 0xF5, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x5F, 0xF5,
+  0xFF, 0xA0, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0xFF, 0xA0, 0x00, 0x00, 0x00,
+  0x5F, 0xF5, 0xAA, 0x70, 0x00, 0x00, 0x00, 0x3A, 0xA3, 0x00, 0x00, 0x00,
+  0xAA, 0xAA, 0x70, 0x00, 0x00, 0x00, 0x03, 0x8F, 0xFF, 0xFF, 0xFF, 0x52,
+  0x00, 0x00, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFC,
+  0x70, 0x00, 0xAD, 0xFF, 0xA0, 0x07, 0xFF, 0xC2, 0x00, 0x00, 0x03, 0xFF,
+  0xD3, 0x0A, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x3D, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x5F, 0xFC, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x0A,
+  0xFF, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F, 0xF5, 0x00,
+  0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x0A,
+  0xFF, 0x5F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0x2C, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x5F, 0xF8, 0x0A, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x8F,
+  0xF5, 0x03, 0xFF, 0xD3, 0x00, 0x00, 0x07, 0xFF, 0xC2, 0x00, 0xCF, 0xFF,
+  0xC5, 0x55, 0xFF, 0xFF, 0x70, 0x00, 0x2C, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+  0x00, 0x00, 0x00, 0xAA, 0xFF, 0xFF, 0xDA, 0x70, 0x00, 0x00, 0x00, 0x00,
+  0x55, 0x55, 0x30, 0x00, 0x00, 0x00, 0x00, 0x07, 0xAA, 0xAA, 0x00, 0x00,
+  0x0F, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0x3D, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x70, 0x0F, 0xFF, 0xFD, 0xA0, 0x03, 0xAF, 0xFF, 0x50, 0xFF,
+  0xFF, 0x30, 0x00, 0x00, 0x8F, 0xFC, 0x0F, 0xFF, 0x50, 0x00, 0x00, 0x00,
+  0xAF, 0xF0, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x7F, 0xFA, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xFA, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0xAF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFA, 0xFF, 0xA0, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0xAF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFA, 0xFF,
+  0xD3, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x02,
+  0xCF, 0xF0, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0xCF, 0xF8, 0x0F, 0xFF, 0xFF,
+  0x85, 0x58, 0xFF, 0xFD, 0x30, 0xFF, 0xCC, 0xFF, 0xFF, 0xFF, 0xFF, 0x30,
+  0x0F, 0xFA, 0x03, 0xAF, 0xFF, 0xFA, 0x30, 0x00, 0xFF, 0xA0, 0x00, 0x55,
+  0x55, 0x00, 0x00, 0x0F, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFA, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA7, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x70, 0x00,
+  0x00, 0x00, 0x03, 0x8F, 0xFF, 0xFF, 0xFF, 0x30, 0xFF, 0x00, 0x3D, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0x00, 0xFF, 0xFC, 0x70, 0x00, 0xAD, 0xFF,
+  0xFF, 0x07, 0xFF, 0xC2, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x0A, 0xFF, 0x70,
+  0x00, 0x00, 0x00, 0x5F, 0xFF, 0x3D, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x5F,
+  0xFF, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F, 0xF5, 0x00,
+  0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x0A,
+  0xFF, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F, 0xF8, 0x00,
+  0x00, 0x00, 0x00, 0x2C, 0xFF, 0x2C, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x5F,
+  0xFF, 0x0A, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x03, 0xFF, 0xD3,
+  0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0xCF, 0xFF, 0xC5, 0x55, 0xFF, 0xDD,
+  0xFF, 0x00, 0x2C, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xFF, 0x00, 0x00, 0xAD,
+  0xFF, 0xFF, 0xA3, 0x0A, 0xFF, 0x00, 0x00, 0x03, 0x55, 0x55, 0x00, 0x0A,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0xAA, 0x00, 0x00, 0x07, 0xAA, 0xFF, 0x03, 0x8F,
+  0xFF, 0xFF, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0xFF, 0xF8, 0x00,
+  0x00, 0xFF, 0xF5, 0x00, 0x00, 0xFF, 0xC2, 0x00, 0x00, 0xFF, 0xA0, 0x00,
+  0x00, 0xFF, 0xA0, 0x00, 0x00, 0xFF, 0xA0, 0x00, 0x00, 0xFF, 0xA0, 0x00,
+  0x00, 0xFF, 0xA0, 0x00, 0x00, 0xFF, 0xA0, 0x00, 0x00, 0xFF, 0xA0, 0x00,
+  0x00, 0xFF, 0xA0, 0x00, 0x00, 0xFF, 0xA0, 0x00, 0x00, 0xFF, 0xA0, 0x00,
+  0x00, 0xAA, 0x70, 0x00, 0x00, 0x00, 0x00, 0x07, 0xAA, 0xAA, 0x00, 0x00,
+  0x00, 0x2C, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x70, 0x03, 0xFF, 0xD3, 0x00, 0x07, 0xFF, 0xF5, 0x0A, 0xFF, 0x30,
+  0x00, 0x00, 0x8F, 0xF5, 0x0A, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+  0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x52, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xFF, 0xFC, 0xAA, 0x00, 0x00, 0x00, 0x07, 0xCF, 0xFF,
+  0xFF, 0xFF, 0x30, 0x00, 0x00, 0x25, 0x5C, 0xFF, 0xFF, 0xD3, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xCF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF,
+  0x5F, 0xF5, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x5F, 0xFC, 0x00, 0x00, 0x00,
+  0x3D, 0xFF, 0x0A, 0xFF, 0xF8, 0x55, 0x5C, 0xFF, 0xF5, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC2, 0x00, 0x3A, 0xCF, 0xFF, 0xFF, 0xA3, 0x00, 0x00,
+  0x00, 0x25, 0x55, 0x55, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x5F,
+  0xF5, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x5F, 0xFF,
+  0xFF, 0xF5, 0x5F, 0xFF, 0xFF, 0xF5, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x5F,
+  0xF5, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x5F,
+  0xF5, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x5F,
+  0xF5, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x5F,
+  0xF5, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x5F, 0xF8, 0x52, 0x00, 0x5F,
+  0xFF, 0xF5, 0x00, 0x07, 0xFF, 0xF5, 0x00, 0x00, 0x55, 0x52, 0xFF, 0xA0,
+  0x00, 0x00, 0x00, 0x5F, 0xF5, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x5F, 0xF5,
+  0xFF, 0xA0, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0xFF, 0xA0, 0x00, 0x00, 0x00,
+  0x5F, 0xF5, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0xFF, 0xA0, 0x00,
+  0x00, 0x00, 0x5F, 0xF5, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0xFF,
+  0xA0, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x5F,
+  0xF5, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0xFF, 0xA0, 0x00, 0x00,
+  0x00, 0x5F, 0xF5, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0xCF, 0xF5, 0xFF, 0xA0,
+  0x00, 0x00, 0x03, 0xFF, 0xF5, 0xFF, 0xD3, 0x00, 0x00, 0x3D, 0xFF, 0xF5,
+  0xCF, 0xFF, 0xC5, 0x55, 0xFF, 0xDD, 0xF5, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x3A, 0xF5, 0x00, 0xAD, 0xFF, 0xFC, 0xA3, 0x07, 0xA3, 0x00, 0x03, 0x55,
+  0x52, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD3,
+  0x5F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xA0, 0x0A, 0xFF, 0x00, 0x00,
+  0x00, 0x0A, 0xFF, 0x70, 0x0A, 0xFF, 0x70, 0x00, 0x00, 0x0A, 0xFF, 0x00,
+  0x00, 0xFF, 0xA0, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0xFF, 0xD3, 0x00,
+  0x00, 0xCF, 0xF5, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0xFF, 0xA0, 0x00,
+  0x00, 0x5F, 0xFC, 0x00, 0x07, 0xFF, 0xA0, 0x00, 0x00, 0x0A, 0xFF, 0x00,
+  0x0A, 0xFF, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x70, 0x3D, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0xA0, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xD3,
+  0xCF, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0xFF, 0x70, 0x00, 0x00,
+  0x00, 0x00, 0x2C, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF,
+  0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF5, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xAA, 0xA3, 0x00, 0x00, 0x00, 0xCF, 0xF5, 0x00, 0x00,
+  0x0A, 0xFF, 0xC2, 0x00, 0x00, 0x0A, 0xFF, 0x5F, 0xF5, 0x00, 0x00, 0x0A,
+  0xFF, 0xF5, 0x00, 0x00, 0x0A, 0xFF, 0x3D, 0xFF, 0x00, 0x00, 0x2C, 0xFF,
+  0xF5, 0x00, 0x00, 0x5F, 0xFC, 0x0A, 0xFF, 0x00, 0x00, 0x5F, 0xFF, 0xFC,
+  0x00, 0x00, 0x5F, 0xF5, 0x07, 0xFF, 0x30, 0x00, 0x5F, 0xDD, 0xFF, 0x00,
+  0x00, 0x8F, 0xD3, 0x00, 0xFF, 0xA0, 0x00, 0xCF, 0xA3, 0xFF, 0x00, 0x00,
+  0xFF, 0xA0, 0x00, 0xFF, 0xA0, 0x00, 0xFF, 0xA0, 0xFF, 0xA0, 0x00, 0xFF,
+  0xA0, 0x00, 0x8F, 0xD3, 0x00, 0xFF, 0x30, 0xFF, 0xA0, 0x07, 0xFF, 0x30,
+  0x00, 0x5F, 0xF5, 0x0A, 0xFF, 0x00, 0x5F, 0xC2, 0x0A, 0xFF, 0x00, 0x00,
+  0x2C, 0xF5, 0x0A, 0xFF, 0x00, 0x5F, 0xF5, 0x0A, 0xF8, 0x00, 0x00, 0x0A,
+  0xFF, 0x2C, 0xF5, 0x00, 0x3D, 0xF5, 0x5F, 0xF5, 0x00, 0x00, 0x0A, 0xFF,
+  0x5F, 0xF5, 0x00, 0x0A, 0xFC, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0xFF, 0x8F,
+  0xD3, 0x00, 0x0A, 0xFF, 0x8F, 0xA0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xA0,
+  0x00, 0x03, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xA0, 0x00,
+  0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x30, 0x00, 0x00,
+  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xAA, 0x00, 0x00, 0x00, 0x3A,
+  0xA3, 0x00, 0x00, 0x3D, 0xFF, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0x00, 0x3F,
+  0xF7, 0x00, 0x00, 0x05, 0xFF, 0x80, 0x00, 0xCF, 0xF5, 0x00, 0x03, 0xFF,
+  0xA0, 0x00, 0x02, 0xCF, 0xC0, 0x00, 0xAF, 0xF3, 0x00, 0x00, 0x07, 0xFF,
+  0xA0, 0x8F, 0xF5, 0x00, 0x00, 0x00, 0x08, 0xFD, 0x3F, 0xFC, 0x20, 0x00,
+  0x00, 0x00, 0x3D, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xAF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xDA, 0xFF, 0xA0,
+  0x00, 0x00, 0x00, 0x0F, 0xFA, 0x08, 0xFD, 0x30, 0x00, 0x00, 0x2C, 0xFF,
+  0x00, 0x3D, 0xFF, 0x00, 0x00, 0x05, 0xFF, 0x80, 0x00, 0xAF, 0xF7, 0x00,
+  0x03, 0xFF, 0xA0, 0x00, 0x00, 0xCF, 0xF5, 0x03, 0xDF, 0xF3, 0x00, 0x00,
+  0x05, 0xFF, 0xC0, 0x3A, 0xA3, 0x00, 0x00, 0x00, 0x07, 0xAA, 0x70, 0x5F,
+  0xF5, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xA5, 0xFF, 0x50, 0x00, 0x00, 0x00,
+  0xAF, 0xF3, 0x0A, 0xFF, 0x00, 0x00, 0x00, 0x2C, 0xFC, 0x00, 0xAF, 0xF0,
+  0x00, 0x00, 0x05, 0xFF, 0x50, 0x00, 0xFF, 0xA0, 0x00, 0x00, 0x8F, 0xD3,
+  0x00, 0x0F, 0xFA, 0x00, 0x00, 0x0F, 0xFA, 0x00, 0x00, 0x5F, 0xF5, 0x00,
+  0x03, 0xFF, 0x70, 0x00, 0x05, 0xFF, 0x50, 0x00, 0xAF, 0xF0, 0x00, 0x00,
+  0x0A, 0xFF, 0x00, 0x5F, 0xFC, 0x00, 0x00, 0x00, 0xAF, 0xF0, 0x05, 0xFF,
+  0x50, 0x00, 0x00, 0x00, 0xFF, 0xA0, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x0F,
+  0xFA, 0x0F, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF,
+  0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFC, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF3, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0x55, 0xFF, 0xD3, 0x00, 0x00, 0x00,
+  0x00, 0xAF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xDA, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x07, 0xAA, 0xAA, 0xAA, 0xAA, 0xCF, 0xFC, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xCF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0x70, 0x00, 0x00,
+  0x00, 0x00, 0xCF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x5F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD3,
+  0x00, 0x00, 0x00, 0x00, 0x3D, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x03, 0xFF,
+  0xD3, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xA0, 0x00, 0x00, 0x00,
+  0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x3A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x02,
+  0x5F, 0xFA, 0x00, 0x05, 0xFF, 0xFA, 0x00, 0x0F, 0xF7, 0x00, 0x00, 0x0F,
+  0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F,
+  0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F,
+  0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x02, 0xCF,
+  0xC0, 0x00, 0x7C, 0xFC, 0x20, 0x00, 0xAF, 0xF0, 0x00, 0x00, 0xAF, 0xF7,
+  0x00, 0x00, 0x03, 0xDF, 0x50, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F,
+  0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F,
+  0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F,
+  0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF3, 0x00, 0x00, 0x08,
+  0xFD, 0xA7, 0x00, 0x03, 0xAF, 0xFA, 0x00, 0x00, 0x05, 0x53, 0x5F, 0xA5,
+  0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5,
+  0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5,
+  0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5,
+  0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA2, 0x53, 0xAF, 0xF5, 0x20, 0x00, 0xAF,
+  0xFF, 0x50, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+  0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+  0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+  0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x05, 0xFC, 0x20, 0x00,
+  0x02, 0xCF, 0xC7, 0x00, 0x00, 0x0F, 0xFA, 0x00, 0x00, 0x7F, 0xFA, 0x00,
+  0x05, 0xFD, 0x30, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+  0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+  0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+  0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x7A, 0xDF, 0x80, 0x00, 0xAF,
+  0xFA, 0x30, 0x00, 0x35, 0x50, 0x00, 0x00, 0x03, 0xAA, 0xA0, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x5F, 0x7F, 0x85, 0x5F, 0xFA,
+  0x30, 0x0C, 0xFA, 0xA0, 0x00, 0x3A, 0xFF, 0xFF, 0xF5, 0x33, 0x00, 0x00,
+  0x05, 0xCF, 0xFC, 0x20 };
+
+const GFXglyph FreeSansSmooth16pt7bGlyphs[] PROGMEM = {
+  {     0,   0,   0,   8,    0,    1 },   // 0x20 ' '
+  {     0,   3,  23,  11,    4,  -22 },   // 0x21 '!'
+  {    35,   8,   9,  11,    1,  -22 },   // 0x22 '"'
+  {    71,  17,  23,  17,    0,  -21 },   // 0x23 '#'
+  {   267,  16,  28,  17,    0,  -23 },   // 0x24 '$'
+  {   491,  27,  24,  28,    0,  -22 },   // 0x25 '%'
+  {   815,  19,  24,  21,    1,  -22 },   // 0x26 '&'
+  {  1043,   3,   9,   6,    1,  -22 },   // 0x27 '''
+  {  1057,   7,  30,  11,    2,  -22 },   // 0x28 '('
+  {  1162,   7,  30,  11,    1,  -22 },   // 0x29 ')'
+  {  1267,  10,  10,  12,    1,  -22 },   // 0x2A '*'
+  {  1317,  16,  15,  18,    1,  -14 },   // 0x2B '+'
+  {  1437,   4,   9,   9,    2,   -3 },   // 0x2C ','
+  {  1455,   8,   4,  11,    1,  -10 },   // 0x2D '-'
+  {  1471,   4,   4,   8,    2,   -3 },   // 0x2E '.'
+  {  1479,   9,  24,   9,    0,  -22 },   // 0x2F '/'
+  {  1587,  15,  24,  17,    1,  -22 },   // 0x30 '0'
+  {  1767,   8,  23,  17,    3,  -22 },   // 0x31 '1'
+  {  1859,  15,  23,  17,    1,  -22 },   // 0x32 '2'
+  {  2032,  16,  24,  17,    0,  -22 },   // 0x33 '3'
+  {  2224,  16,  23,  17,    0,  -22 },   // 0x34 '4'
+  {  2408,  15,  24,  17,    1,  -22 },   // 0x35 '5'
+  {  2588,  15,  24,  17,    1,  -22 },   // 0x36 '6'
+  {  2768,  15,  23,  17,    1,  -22 },   // 0x37 '7'
+  {  2941,  15,  24,  17,    1,  -22 },   // 0x38 '8'
+  {  3121,  15,  24,  17,    1,  -22 },   // 0x39 '9'
+  {  3301,   4,  17,   8,    2,  -16 },   // 0x3A ':'
+  {  3335,   4,  22,   8,    2,  -16 },   // 0x3B ';'
+  {  3379,  16,  15,  18,    1,  -14 },   // 0x3C '<'
+  {  3499,  16,   9,  18,    1,  -11 },   // 0x3D '='
+  {  3571,  16,  16,  18,    1,  -15 },   // 0x3E '>'
+  {  3699,  14,  24,  17,    2,  -23 },   // 0x3F '?'
+  {  3867,  29,  29,  32,    1,  -23 },   // 0x40 '@'
+  {  4288,  20,  23,  21,    0,  -22 },   // 0x41 'A'
+  {  4518,  18,  23,  21,    2,  -22 },   // 0x42 'B'
+  {  4725,  20,  25,  22,    1,  -23 },   // 0x43 'C'
+  {  4975,  19,  23,  22,    2,  -22 },   // 0x44 'D'
+  {  5194,  17,  23,  20,    2,  -22 },   // 0x45 'E'
+  {  5390,  16,  23,  19,    2,  -22 },   // 0x46 'F'
+  {  5574,  21,  25,  24,    1,  -23 },   // 0x47 'G'
+  {  5837,  18,  23,  23,    2,  -22 },   // 0x48 'H'
+  {  6044,   3,  23,   9,    3,  -22 },   // 0x49 'I'
+  {  6079,  13,  24,  17,    1,  -22 },   // 0x4A 'J'
+  {  6235,  19,  23,  21,    2,  -22 },   // 0x4B 'K'
+  {  6454,  15,  23,  17,    2,  -22 },   // 0x4C 'L'
+  {  6627,  22,  23,  27,    2,  -22 },   // 0x4D 'M'
+  {  6880,  18,  23,  23,    2,  -22 },   // 0x4E 'N'
+  {  7087,  23,  25,  25,    1,  -23 },   // 0x4F 'O'
+  {  7375,  17,  23,  21,    2,  -22 },   // 0x50 'P'
+  {  7571,  23,  26,  25,    1,  -23 },   // 0x51 'Q'
+  {  7870,  18,  23,  22,    2,  -22 },   // 0x52 'R'
+  {  8077,  19,  25,  21,    1,  -23 },   // 0x53 'S'
+  {  8315,  18,  23,  20,    1,  -22 },   // 0x54 'T'
+  {  8522,  18,  24,  23,    2,  -22 },   // 0x55 'U'
+  {  8738,  20,  23,  20,    0,  -22 },   // 0x56 'V'
+  {  8968,  29,  23,  29,    0,  -22 },   // 0x57 'W'
+  {  9302,  20,  23,  21,    0,  -22 },   // 0x58 'X'
+  {  9532,  21,  23,  21,    0,  -22 },   // 0x59 'Y'
+  {  9774,  19,  23,  19,    0,  -22 },   // 0x5A 'Z'
+  {  9993,   6,  30,   9,    2,  -22 },   // 0x5B '['
+  { 10083,   9,  24,   9,    0,  -22 },   // 0x5C '\'
+  { 10191,   6,  30,   9,    0,  -22 },   // 0x5D ']'
+  { 10281,  13,  13,  15,    1,  -22 },   // 0x5E '^'
+  { 10366,  19,   2,  17,   -1,    4 },   // 0x5F '_'
+  { 10385,   8,   5,   8,    0,  -23 },   // 0x60 '`'
+  { 10405,  17,  19,  17,    0,  -17 },   // 0x61 'a'
+  { 10567,  15,  24,  17,    2,  -22 },   // 0x62 'b'
+  { 10747,  15,  19,  16,    0,  -17 },   // 0x63 'c'
+  { 10890,  16,  24,  17,    0,  -22 },   // 0x64 'd'
+  { 11082,  16,  19,  17,    0,  -17 },   // 0x65 'e'
+  { 11234,   8,  23,   9,    0,  -22 },   // 0x66 'f'
+  { 11326,  16,  25,  17,    0,  -17 },   // 0x67 'g'
+  { 11526,  13,  23,  17,    2,  -22 },   // 0x68 'h'
+  { 11676,   3,  23,   7,    2,  -22 },   // 0x69 'i'
+  { 11711,   6,  30,   7,    0,  -22 },   // 0x6A 'j'
+  { 11801,  14,  23,  16,    2,  -22 },   // 0x6B 'k'
+  { 11962,   3,  23,   7,    2,  -22 },   // 0x6C 'l'
+  { 11997,  22,  18,  25,    2,  -17 },   // 0x6D 'm'
+  { 12195,  14,  18,  17,    2,  -17 },   // 0x6E 'n'
+  { 12321,  16,  19,  17,    0,  -17 },   // 0x6F 'o'
+  { 12473,  15,  24,  17,    2,  -17 },   // 0x70 'p'
+  { 12653,  16,  24,  17,    0,  -17 },   // 0x71 'q'
+  { 12845,   8,  18,  11,    2,  -17 },   // 0x72 'r'
+  { 12917,  14,  19,  15,    0,  -17 },   // 0x73 's'
+  { 13050,   8,  22,   9,    0,  -20 },   // 0x74 't'
+  { 13138,  14,  18,  17,    2,  -16 },   // 0x75 'u'
+  { 13264,  16,  17,  15,    0,  -16 },   // 0x76 'v'
+  { 13400,  22,  17,  23,    0,  -16 },   // 0x77 'w'
+  { 13587,  15,  17,  15,    0,  -16 },   // 0x78 'x'
+  { 13715,  15,  24,  15,    0,  -16 },   // 0x79 'y'
+  { 13895,  14,  17,  15,    0,  -16 },   // 0x7A 'z'
+  { 14014,   8,  30,  11,    1,  -22 },   // 0x7B '{'
+  { 14134,   3,  30,   8,    2,  -22 },   // 0x7C '|'
+  { 14179,   8,  30,  11,    1,  -22 },   // 0x7D '}'
+  { 14299,  13,   5,  16,    1,  -13 } };   // 0x7E '~'
+
+const SmoothFont FreeSansSmooth16pt7b PROGMEM = {
+  (uint8_t  *)FreeSansSmooth16pt7bBitmaps,
+  (GFXglyph *)FreeSansSmooth16pt7bGlyphs,
+  0x20, 0x7E, 37 };
+
+// Approx. 15004 bytes
@@ -0,0 +1,27 @@
+// Font structures for anti-aliased (smooth) fonts.
+
+// The glyph metrics are the same as those of the free fonts, see gfxfont.h. The glyph
+// bitmaps hold 4 bits of coverage per pixel, 0 is background and 15 is fully covered,
+// high nibble first, row after row with no padding at the row ends. Each glyph starts
+// on a byte boundary. To use a font pass the address of its SmoothFont struct to
+// setSmoothFont().
+
+#ifndef _SMOOTHFONT_H_
+#define _SMOOTHFONT_H_
+
+#ifdef LOAD_GFXFF
+
+typedef struct { // Data stored for FONT AS A WHOLE, the same layout as GFXfont:
+	uint8_t  *bitmap;      // Glyph coverage bitmaps, concatenated
+	GFXglyph *glyph;       // Glyph array
+	uint8_t   first, last; // ASCII extents
+	uint8_t   yAdvance;    // Newline distance (y axis)
+#ifdef LOAD_UNICODE
+	GFXrange *range;       // Character code ranges, NULL if only first..last
+	uint16_t  ranges;      // Number of ranges
+#endif
+} SmoothFont;
+
+#endif // LOAD_GFXFF
+
+#endif // _SMOOTHFONT_H_
@@ -18,26 +18,49 @@
 
 #include "TFT_eSPI.h"
 
-#include <pgmspace.h>
-
 #include <limits.h>
-#include "pins_arduino.h"
-#include "wiring_private.h"
-#include <SPI.h>
+
+#ifdef TFT_HOST_BACKEND
+  #include "Extensions/Host.cpp"
+#else
+  #include <pgmspace.h>
+  #include "pins_arduino.h"
+  #include "wiring_private.h"
+  #include <SPI.h>
+#endif
 
 // If the SPI library has transaction support, these functions
 // establish settings and protect from interference from other
 // libraries.  Otherwise, they simply do nothing.
 
+// spi_begin() also sets TFT chip select low and spi_end() sets it high again.
+// Both do nothing if the bus is already held, so the transaction and chip select
+// span a whole startWrite() to endWrite() session when one is open.
+
 inline void TFT_eSPI::spi_begin(void){
+#ifdef TFT_DMA
+  if (dmaQueued) dmaWait(); // Bus must be idle before it is used again
+#endif
+  if (inTransaction) return;
+  inTransaction = true;
+#ifdef TFT_HOST_BACKEND
+  TFT_Host::beginTransaction();
+#endif
 #ifdef SPI_HAS_TRANSACTION
   #ifdef SUPPORT_TRANSACTIONS
   _SPI->beginTransaction(SPISettings(SPI_FREQUENCY, MSBFIRST, SPI_MODE0));
   #endif
 #endif
+  CS_L;
 }
 
 inline void TFT_eSPI::spi_end(void){
+  if (writeDepth || !inTransaction) return; // Hold the bus until endWrite()
+#ifdef TFT_DMA
+  if (dmaQueued) dmaWait(); // Pixels must be sent before CS goes high
+#endif
+  inTransaction = false;
+  CS_H;
 #ifdef SPI_HAS_TRANSACTION
   #ifdef SUPPORT_TRANSACTIONS
   _SPI->endTransaction();
@@ -46,6 +69,29 @@ inline void TFT_eSPI::spi_end(void){
 }
 
 
+/***************************************************************************************
+** Function name:           startWrite
+** Description:             Begin a write session, the SPI bus and CS are held until
+**                          the matching endWrite(), sessions can be nested
+***************************************************************************************/
+void TFT_eSPI::startWrite(void)
+{
+  spi_begin();
+  writeDepth++;
+}
+
+
+/***************************************************************************************
+** Function name:           endWrite
+** Description:             End a write session, the bus is released by the outermost
+***************************************************************************************/
+void TFT_eSPI::endWrite(void)
+{
+  if (writeDepth) writeDepth--;
+  spi_end();
+}
+
+
 /***************************************************************************************
 ** Function name:           TFT_eSPI
 ** Description:             Constructor , we must use hardware SPI pins
@@ -53,10 +99,21 @@ inline void TFT_eSPI::spi_end(void){
 TFT_eSPI::TFT_eSPI(int16_t w, int16_t h)
 {
 
+#ifndef TFT_HOST_BACKEND
   _SPI = &SPI; // Initialise class pointer
+#endif
   
   hwSPI = true;
 
+  inTransaction = false; // SPI bus not held
+  writeDepth    = 0;     // No startWrite() session open
+
+  dmaEnabled = false;
+  dmaQueued  = 0;
+#if defined (ESP32) && defined (ESP32_DMA)
+  dmaNext    = 0;
+#endif
+
 // The control pins are deliberately set to the inactive state (CS high) as setup()
 // might call and initialise another SPI peripherals which would could cause conflicts
 // if CS is floating or undefined.
@@ -90,8 +147,34 @@ TFT_eSPI::TFT_eSPI(int16_t w, int16_t h)
   textdatum = TL_DATUM; // Top Left text alignment is default
   fontsloaded = 0;
 
-  addr_row = 0xFFFF;
+  addr_row = 0xFFFF; // Address window unknown
   addr_col = 0xFFFF;
+  win_xe   = 0xFFFF;
+  win_ye   = 0xFFFF;
+
+#ifdef LOAD_GFXFF
+  gfxFont = NULL; // Font 1 is the GLCD font until setFreeFont()
+
+  glyphCache     = NULL; // No glyph cache until setGlyphCache()
+  glyphCacheSize = 0;
+  glyphCacheUsed = 0;
+  glyphCacheTick = 0;
+  clearGlyphCacheStats();
+
+  kernPairs = NULL; // No kerning until setKerning()
+  kernCount = 0;
+  kernLast  = 0;
+
+  smoothFont = false;
+  blendFg    = 0; // Black over black
+  blendBg    = 0;
+  memset(blendLut, 0, sizeof(blendLut));
+#endif
+
+#ifdef LOAD_UNICODE
+  utf8Code  = 0; // No partial UTF-8 character
+  utf8Count = 0;
+#endif
 
 #ifdef LOAD_GLCD
   fontsloaded = 0x0002; // Bit 1 set
@@ -120,6 +203,18 @@ TFT_eSPI::TFT_eSPI(int16_t w, int16_t h)
 }
 
 
+/***************************************************************************************
+** Function name:           ~TFT_eSPI
+** Description:             Class destructor, frees the glyph cache RAM
+***************************************************************************************/
+TFT_eSPI::~TFT_eSPI(void)
+{
+#ifdef LOAD_GFXFF
+  setGlyphCache(0);
+#endif
+}
+
+
 /***************************************************************************************
 ** Function name:           begin
 ** Description:             Included for backwards compatibility
@@ -136,6 +231,7 @@ void TFT_eSPI::begin(void)
 ***************************************************************************************/
 void TFT_eSPI::init(void)
 {
+#ifndef TFT_HOST_BACKEND
   csport    = portOutputRegister(digitalPinToPort(TFT_CS));
   cspinmask = (uint32_t) digitalPinToBitMask(TFT_CS);
   dcport    = portOutputRegister(digitalPinToPort(TFT_DC));
@@ -143,10 +239,11 @@ void TFT_eSPI::init(void)
 
   _SPI->begin(); // This will set MISO to input
 
-#ifndef SUPPORT_TRANSACTIONS
+  #ifndef SUPPORT_TRANSACTIONS
   _SPI->setBitOrder(MSBFIRST);
   _SPI->setDataMode(SPI_MODE0);
   _SPI->setFrequency(SPI_FREQUENCY);
+  #endif
 #endif
 
   // SPI1U1 |= SPIUSIO; // Single I/O pin on MOSI (bi-directional) - not tested
@@ -163,24 +260,24 @@ void TFT_eSPI::init(void)
   }
 #endif
 
-  spi_begin();
+  startWrite();
   writecommand(TFT_SWRST); // Software reset
-  spi_end();
+  endWrite();
   
   delay(5); // Wait for software reset to complete
 
-  spi_begin();
+  startWrite();
   
   // This loads the driver specific initialisation code  <<<<<<<<<<<<<<<<<<<<< ADD NEW DRIVERS TO THE LIST HERE <<<<<<<<<<<<<<<<<<<<<<<
 #if   defined (ILI9341_DRIVER)
-     #include "TFT_Drivers\ILI9341_Init.h"
+     #include "TFT_Drivers/ILI9341_Init.h"
 
 #elif defined (ST7735_DRIVER)
-     #include "TFT_Drivers\ST7735_Init.h"
+     #include "TFT_Drivers/ST7735_Init.h"
 
 #endif
 
-  spi_end();
+  endWrite();
 
 }
 
@@ -192,17 +289,17 @@ void TFT_eSPI::init(void)
 void TFT_eSPI::setRotation(uint8_t m)
 {
 
-  spi_begin();
+  startWrite();
 
     // This loads the driver specific rotation code  <<<<<<<<<<<<<<<<<<<<< ADD NEW DRIVERS TO THE LIST HERE <<<<<<<<<<<<<<<<<<<<<<<
 #if   defined (ILI9341_DRIVER)
-     #include "TFT_Drivers\ILI9341_Rotation.h"
+     #include "TFT_Drivers/ILI9341_Rotation.h"
 
 #elif defined (ST7735_DRIVER)
-     #include "TFT_Drivers\ST7735_Rotation.h"
+     #include "TFT_Drivers/ST7735_Rotation.h"
 #endif
 
-  spi_end();
+  endWrite();
 
   addr_row = 0xFFFF;
   addr_col = 0xFFFF;
@@ -219,7 +316,7 @@ void TFT_eSPI::commandList (const uint8_t *addr)
   uint8_t  numArgs;
   uint8_t  ms;
 
-  spi_begin();
+  startWrite();
 
   numCommands = pgm_read_byte(addr++);   // Number of commands to follow
 
@@ -241,7 +338,7 @@ void TFT_eSPI::commandList (const uint8_t *addr)
       delay( (ms==255 ? 500 : ms) );
     }
   }
-  spi_end();
+  endWrite();
 }
 
 
@@ -251,7 +348,7 @@ void TFT_eSPI::commandList (const uint8_t *addr)
 ***************************************************************************************/
 void TFT_eSPI::spiwrite(uint8_t c)
 {
-  _SPI->transfer(c);
+  tft_Write_8(c);
 }
 
 
@@ -261,11 +358,15 @@ void TFT_eSPI::spiwrite(uint8_t c)
 ***************************************************************************************/
 void TFT_eSPI::writecommand(uint8_t c)
 {
+  spi_begin();
   DC_C;
-  CS_L;
-  _SPI->transfer(c);
-  CS_H;
+  tft_Write_8(c);
   DC_D;
+  spi_end();
+
+  // The command might have changed the address window so forget the cached one
+  addr_row = 0xFFFF;
+  addr_col = 0xFFFF;
 }
 
 
@@ -275,9 +376,20 @@ void TFT_eSPI::writecommand(uint8_t c)
 ***************************************************************************************/
 void TFT_eSPI::writedata(uint8_t c)
 {
-  CS_L;
-  _SPI->transfer(c);
+  spi_begin();
+  tft_Write_8(c);
+  spi_end();
+}
+
+
+/***************************************************************************************
+** Function name:           readEnd
+** Description:             Finish a read, CS must go high to end the TFT read mode
+***************************************************************************************/
+inline void TFT_eSPI::readEnd(void)
+{
   CS_H;
+  if (writeDepth) CS_L; // Select the TFT again for the rest of the write session
 }
 
 
@@ -291,18 +403,21 @@ void TFT_eSPI::writedata(uint8_t c)
   index = 0x10 + (index & 0x0F);
 
   DC_C;
-  CS_L;
-  _SPI->transfer(0xD9);
+  tft_Write_8(0xD9);
   DC_D;
-  _SPI->transfer(index);
+  tft_Write_8(index);
   CS_H;
 
   DC_C;
   CS_L;
-  _SPI->transfer(cmd_function);
+  tft_Write_8(cmd_function);
   DC_D;
-  uint8_t reg = _SPI->transfer(0);
-  CS_H;
+  uint8_t reg = tft_Read_8();
+  readEnd();
+
+  // Any command can be sent via the index register so forget the cached window
+  addr_row = 0xFFFF;
+  addr_col = 0xFFFF;
 
   spi_end();
   return reg;
@@ -315,7 +430,7 @@ void TFT_eSPI::writedata(uint8_t c)
 ***************************************************************************************/
   uint16_t  TFT_eSPI::readcommand16(uint8_t cmd_function, uint8_t index)
 {
-  uint32_t reg;
+  uint32_t reg = 0;
   reg |= (readcommand8(cmd_function, index + 0) <<  8);
   reg |= (readcommand8(cmd_function, index + 1) <<  0);
 
@@ -340,6 +455,7 @@ void TFT_eSPI::writedata(uint8_t c)
 }
 
 
+
 /***************************************************************************************
 ** Function name:           read pixel (for SPI Interface II i.e. IM [3:0] = "1101")
 ** Description:             Read 565 pixel colours from a pixel
@@ -348,21 +464,21 @@ uint16_t TFT_eSPI::readPixel(int32_t x0, int32_t y0)
 {
   spi_begin();
 
-  setAddrWindow(x0, y0, x0, y0); // Sets CS low, don't care it sent RAMWR
+  writeAddrWindow(x0, y0, x0, y0); // Don't care it sent RAMWR
 
   DC_C;
-  _SPI->transfer(TFT_RAMRD); // Read CGRAM command
+  tft_Write_8(TFT_RAMRD); // Read CGRAM command
   DC_D;
 
   // Dummy read to throw away don't care value
-  _SPI->transfer(0);
+  tft_Read_8();
 	
   // Read window pixel 24 bit RGB values
-  uint8_t r = _SPI->transfer(0);
-  uint8_t g = _SPI->transfer(0);
-  uint8_t b = _SPI->transfer(0);
+  uint8_t r = tft_Read_8();
+  uint8_t g = tft_Read_8();
+  uint8_t b = tft_Read_8();
 
-  CS_H;
+  readEnd();
 
   spi_end();
 	
@@ -380,23 +496,23 @@ uint16_t TFT_eSPI::readPixel(int32_t x0, int32_t y0)
   
   spi_begin();
 
-  setAddrWindow(x, y, x + w - 1, y + h - 1); // Sets CS low, don't care it sent RAMWR
+  writeAddrWindow(x, y, x + w - 1, y + h - 1); // Don't care it sent RAMWR
 
   DC_C;
-  _SPI->transfer(TFT_RAMRD); // Read CGRAM command
+  tft_Write_8(TFT_RAMRD); // Read CGRAM command
   DC_D;
 
   // Dummy read to throw away don't care value
-  _SPI->transfer(0);
+  tft_Read_8();
 
   // Read window pixel 24 bit RGB values
   uint32_t len = w * h;
   while (len--) {
     // Read the 3 RGB bytes, colour is actually only in the top 6 bits of each byte
 	// as the TFT stores colours as 18 bits
-    uint8_t r = _SPI->transfer(0);
-    uint8_t g = _SPI->transfer(0);
-    uint8_t b = _SPI->transfer(0);
+    uint8_t r = tft_Read_8();
+    uint8_t g = tft_Read_8();
+    uint8_t b = tft_Read_8();
     // Swapped colour byte order for compatibility with pushRect()
     *data++ = (r & 0xF8) | (g & 0xE0) >> 5 | (b & 0xF8) << 5 | (g & 0x1C) << 11;
   }
@@ -406,7 +522,7 @@ uint16_t TFT_eSPI::readPixel(int32_t x0, int32_t y0)
   //_SPI->transfer(TFT_NOP);
   //DC_D;
 
-  CS_H;
+  readEnd();
 
   spi_end();
 }
@@ -422,14 +538,12 @@ uint16_t TFT_eSPI::readPixel(int32_t x0, int32_t y0)
   
 	spi_begin();
 
-    setAddrWindow(x, y, x + w - 1, y + h - 1); // Sets CS low and sent RAMWR
+    writeAddrWindow(x, y, x + w - 1, y + h - 1); // Sends RAMWR
 
 	uint32_t len = w * h * 2;
 	// Push pixels into window rectangle, data is a 16 bit pointer thus increment is halved
-	while ( len >=32 ) {_SPI->writeBytes((uint8_t*)data, 32); data += 16; len -= 32; }
-    if (len) _SPI->writeBytes((uint8_t*)data, len);
-    
-	CS_H;
+	while ( len >=32 ) {tft_Write_Bytes((uint8_t*)data, 32); data += 16; len -= 32; }
+    if (len) tft_Write_Bytes((uint8_t*)data, len);
 
 	spi_end();
 }
@@ -444,25 +558,25 @@ uint16_t TFT_eSPI::readPixel(int32_t x0, int32_t y0)
 {
 	spi_begin();
 
-    setAddrWindow(x0, y0, x0 + w - 1, y0 + h - 1); // Sets CS low,, don't care it sent RAMWR
+    writeAddrWindow(x0, y0, x0 + w - 1, y0 + h - 1); // Don't care it sent RAMWR
 
 	DC_C;
-    _SPI->transfer(TFT_RAMRD); // Read CGRAM command
+    tft_Write_8(TFT_RAMRD); // Read CGRAM command
 	DC_D;
 
     // Dummy read to throw away don't care value
-    _SPI->transfer(0);
+    tft_Read_8();
 	
 	// Read window pixel 24 bit RGB values, buffer must be set in sketch to 3 * w * h
 	uint32_t len = w * h;
     while (len--) {
 		// Read the 3 RGB bytes, colour is actually only in the top 6 bits of each byte
 		// as the TFT stores colours as 18 bits
-        *data++ = _SPI->transfer(0);
-        *data++ = _SPI->transfer(0);
-        *data++ = _SPI->transfer(0);
+        *data++ = tft_Read_8();
+        *data++ = tft_Read_8();
+        *data++ = tft_Read_8();
     }
-    CS_H;
+    readEnd();
 
 	spi_end();
 }
@@ -510,21 +624,20 @@ void TFT_eSPI::drawCircle(int32_t x0, int32_t y0, int32_t radius, uint32_t color
 // Optimised midpoint circle algorithm
 void TFT_eSPI::drawCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color)
 {
+  startWrite();
+
   int32_t  x  = 0;
   int32_t  dx = 1;
   int32_t  dy = r+r;
   int32_t  p  = -(r>>1);
-
-  // These are ordered to minimise coordinate changes in x or y
-  // drawPixel can then send fewer bounding box commands
-  drawPixel(x0 + r, y0, color);
-  drawPixel(x0 - r, y0, color);
-  drawPixel(x0, y0 - r, color);
-  drawPixel(x0, y0 + r, color);
+  int32_t  xs = 0; // First x of the points on the current r, from the axis point
 
   while(x<r){
 
     if(p>=0) {
+      circleRuns(x0, y0, xs, x, r, 0xF, color);
+      xs = x + 1;
+
       dy-=2;
       p-=dy;
       r--;
@@ -534,19 +647,42 @@ void TFT_eSPI::drawCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color)
     p+=dx;
 
     x++;
+  }
 
-    // These are ordered to minimise coordinate changes in x or y
-    // drawPixel can then send fewer bounding box commands
-    drawPixel(x0 + x, y0 + r, color);
-    drawPixel(x0 - x, y0 + r, color);
-    drawPixel(x0 - x, y0 - r, color);
-    drawPixel(x0 + x, y0 - r, color);
+  circleRuns(x0, y0, xs, x, r, 0xF, color);
 
-    drawPixel(x0 + r, y0 + x, color);
-    drawPixel(x0 - r, y0 + x, color);
-    drawPixel(x0 - r, y0 - x, color);
-    drawPixel(x0 + r, y0 - x, color);
-    }
+  endWrite();
+}
+
+
+/***************************************************************************************
+** Function name:           circleRuns
+** Description:             draw the points of a circle outline that share a row offset
+***************************************************************************************/
+// The points xa to xb at row offset r of each octant selected by corners (the bits as
+// for drawCircleHelper()) are drawn as a horizontal line and its mirror image, a
+// vertical line. Must be called between startWrite() and endWrite().
+void TFT_eSPI::circleRuns(int32_t x0, int32_t y0, int32_t xa, int32_t xb, int32_t r, uint8_t corners, uint32_t color)
+{
+  int32_t len = xb - xa + 1;
+  if (len < 1) return;
+
+  if (corners & 0x4) {
+    writeFastHLine(x0 + xa, y0 + r, len, color);
+    writeFastVLine(x0 + r, y0 + xa, len, color);
+  }
+  if (corners & 0x2) {
+    writeFastHLine(x0 + xa, y0 - r, len, color);
+    writeFastVLine(x0 + r, y0 - xb, len, color);
+  }
+  if (corners & 0x8) {
+    writeFastVLine(x0 - r, y0 + xa, len, color);
+    writeFastHLine(x0 - xb, y0 + r, len, color);
+  }
+  if (corners & 0x1) {
+    writeFastVLine(x0 - r, y0 - xb, len, color);
+    writeFastHLine(x0 - xb, y0 - r, len, color);
+  }
 }
 
 
@@ -554,15 +690,23 @@ void TFT_eSPI::drawCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color)
 ** Function name:           drawCircleHelper
 ** Description:             Support function for circle drawing
 ***************************************************************************************/
+// The points of each octant are found one column or row at a time, the points on the
+// same row (or column) are drawn as one line
 void TFT_eSPI::drawCircleHelper( int32_t x0, int32_t y0, int32_t r, uint8_t cornername, uint32_t color)
 {
+  startWrite();
+
   int32_t f     = 1 - r;
   int32_t ddF_x = 1;
   int32_t ddF_y = -2 * r;
   int32_t x     = 0;
+  int32_t xs    = 1; // First x of the points on the current r
 
   while (x < r) {
     if (f >= 0) {
+      circleRuns(x0, y0, xs, x, r, cornername, color);
+      xs = x + 1;
+
       r--;
       ddF_y += 2;
       f     += ddF_y;
@@ -570,23 +714,11 @@ void TFT_eSPI::drawCircleHelper( int32_t x0, int32_t y0, int32_t r, uint8_t corn
     x++;
     ddF_x += 2;
     f     += ddF_x;
-    if (cornername & 0x4) {
-      drawPixel(x0 + x, y0 + r, color);
-      drawPixel(x0 + r, y0 + x, color);
-    }
-    if (cornername & 0x2) {
-      drawPixel(x0 + x, y0 - r, color);
-      drawPixel(x0 + r, y0 - x, color);
-    }
-    if (cornername & 0x8) {
-      drawPixel(x0 - r, y0 + x, color);
-      drawPixel(x0 - x, y0 + r, color);
-    }
-    if (cornername & 0x1) {
-      drawPixel(x0 - r, y0 - x, color);
-      drawPixel(x0 - x, y0 - r, color);
-    }
   }
+
+  circleRuns(x0, y0, xs, x, r, cornername, color);
+
+  endWrite();
 }
 
 
@@ -606,12 +738,14 @@ void TFT_eSPI::fillCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color)
 void TFT_eSPI::fillCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color)
 
 {
+  startWrite();
+
   int32_t  x  = 0;
   int32_t  dx = 1;
   int32_t  dy = r+r;
   int32_t  p  = -(r>>1);
 
-  drawFastVLine(x0, y0 - r, dy+1, color);
+  writeFastVLine(x0, y0 - r, dy+1, color);
 
   while(x<r){
 
@@ -626,12 +760,14 @@ void TFT_eSPI::fillCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color)
 
     x++;
 
-    drawFastVLine(x0 + x, y0 - r, 2 * r+1, color);
-    drawFastVLine(x0 - x, y0 - r, 2 * r+1, color);
-    drawFastVLine(x0 + r, y0 - x, 2 * x+1, color);
-    drawFastVLine(x0 - r, y0 - x, 2 * x+1, color);
+    writeFastVLine(x0 + x, y0 - r, 2 * r+1, color);
+    writeFastVLine(x0 - x, y0 - r, 2 * r+1, color);
+    writeFastVLine(x0 + r, y0 - x, 2 * x+1, color);
+    writeFastVLine(x0 - r, y0 - x, 2 * x+1, color);
 
   }
+
+  endWrite();
 }
 
 
@@ -658,6 +794,8 @@ void TFT_eSPI::fillCircle(int32_t x, int32_t y, int32_t r, uint32_t color)
 // Used to support drawing roundrects
 void TFT_eSPI::fillCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t cornername, int32_t delta, uint32_t color)
 {
+  startWrite();
+
   int32_t f     = 1 - r;
   int32_t ddF_x = 1;
   int32_t ddF_y = -r - r;
@@ -675,14 +813,16 @@ void TFT_eSPI::fillCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t corne
     f     += ddF_x;
 
     if (cornername & 0x1) {
-      drawFastVLine(x0 + x, y0 - r, r + r + delta, color);
-      drawFastVLine(x0 + r, y0 - x, x + x + delta, color);
+      writeFastVLine(x0 + x, y0 - r, r + r + delta, color);
+      writeFastVLine(x0 + r, y0 - x, x + x + delta, color);
     }
     if (cornername & 0x2) {
-      drawFastVLine(x0 - x, y0 - r, r + r + delta, color);
-      drawFastVLine(x0 - r, y0 - x, x + x + delta, color);
+      writeFastVLine(x0 - x, y0 - r, r + r + delta, color);
+      writeFastVLine(x0 - r, y0 - x, x + x + delta, color);
     }
   }
+
+  endWrite();
 }
 
 
@@ -694,6 +834,9 @@ void TFT_eSPI::drawEllipse(int16_t x0, int16_t y0, int16_t rx, int16_t ry, uint1
 {
   if (rx<2) return;
   if (ry<2) return;
+
+  startWrite();
+
   int32_t x, y;
   int32_t rx2 = rx * rx;
   int32_t ry2 = ry * ry;
@@ -705,10 +848,10 @@ void TFT_eSPI::drawEllipse(int16_t x0, int16_t y0, int16_t rx, int16_t ry, uint1
   {
 	// These are ordered to minimise coordinate changes in x or y
     // drawPixel can then send fewer bounding box commands
-    drawPixel(x0 + x, y0 + y, color);
-    drawPixel(x0 - x, y0 + y, color);
-    drawPixel(x0 - x, y0 - y, color);
-    drawPixel(x0 + x, y0 - y, color);
+    writePixel(x0 + x, y0 + y, color);
+    writePixel(x0 - x, y0 + y, color);
+    writePixel(x0 - x, y0 - y, color);
+    writePixel(x0 + x, y0 - y, color);
     if (s >= 0)
     {
       s += fx2 * (1 - y);
@@ -721,10 +864,10 @@ void TFT_eSPI::drawEllipse(int16_t x0, int16_t y0, int16_t rx, int16_t ry, uint1
   {
 	// These are ordered to minimise coordinate changes in x or y
     // drawPixel can then send fewer bounding box commands
-    drawPixel(x0 + x, y0 + y, color);
-    drawPixel(x0 - x, y0 + y, color);
-    drawPixel(x0 - x, y0 - y, color);
-    drawPixel(x0 + x, y0 - y, color);
+    writePixel(x0 + x, y0 + y, color);
+    writePixel(x0 - x, y0 + y, color);
+    writePixel(x0 - x, y0 - y, color);
+    writePixel(x0 + x, y0 - y, color);
     if (s >= 0)
     {
       s += fy2 * (1 - x);
@@ -732,6 +875,8 @@ void TFT_eSPI::drawEllipse(int16_t x0, int16_t y0, int16_t rx, int16_t ry, uint1
     }
     s += rx2 * ((4 * y) + 6);
   }
+
+  endWrite();
 }
 
 
@@ -743,6 +888,9 @@ void TFT_eSPI::fillEllipse(int16_t x0, int16_t y0, int16_t rx, int16_t ry, uint1
 {
   if (rx<2) return;
   if (ry<2) return;
+
+  startWrite();
+
   int32_t x, y;
   int32_t rx2 = rx * rx;
   int32_t ry2 = ry * ry;
@@ -752,8 +900,8 @@ void TFT_eSPI::fillEllipse(int16_t x0, int16_t y0, int16_t rx, int16_t ry, uint1
 
   for (x = 0, y = ry, s = 2*ry2+rx2*(1-2*ry); ry2*x <= rx2*y; x++)
   {
-    drawFastHLine(x0 - x, y0 - y, x + x + 1, color);
-    drawFastHLine(x0 - x, y0 + y, x + x + 1, color);
+    writeFastHLine(x0 - x, y0 - y, x + x + 1, color);
+    writeFastHLine(x0 - x, y0 + y, x + x + 1, color);
 
     if (s >= 0)
     {
@@ -765,8 +913,8 @@ void TFT_eSPI::fillEllipse(int16_t x0, int16_t y0, int16_t rx, int16_t ry, uint1
 
   for (x = rx, y = 0, s = 2*rx2+ry2*(1-2*rx); rx2*y <= ry2*x; y++)
   {
-    drawFastHLine(x0 - x, y0 - y, x + x + 1, color);
-    drawFastHLine(x0 - x, y0 + y, x + x + 1, color);
+    writeFastHLine(x0 - x, y0 - y, x + x + 1, color);
+    writeFastHLine(x0 - x, y0 + y, x + x + 1, color);
 
     if (s >= 0)
     {
@@ -776,6 +924,7 @@ void TFT_eSPI::fillEllipse(int16_t x0, int16_t y0, int16_t rx, int16_t ry, uint1
     s += rx2 * ((4 * y) + 6);
   }
 
+  endWrite();
 }
 
 
@@ -796,10 +945,14 @@ void TFT_eSPI::fillScreen(uint32_t color)
 // Draw a rectangle
 void TFT_eSPI::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
 {
-  drawFastHLine(x, y, w, color);
-  drawFastHLine(x, y + h - 1, w, color);
-  drawFastVLine(x, y, h, color);
-  drawFastVLine(x + w - 1, y, h, color);
+  startWrite();
+
+  writeFastHLine(x, y, w, color);
+  writeFastHLine(x, y + h - 1, w, color);
+  writeFastVLine(x, y, h, color);
+  writeFastVLine(x + w - 1, y, h, color);
+
+  endWrite();
 }
 
 
@@ -810,16 +963,20 @@ void TFT_eSPI::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t col
 // Draw a rounded rectangle
 void TFT_eSPI::drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color)
 {
+  startWrite();
+
   // smarter version
-  drawFastHLine(x + r  , y    , w - r - r, color); // Top
-  drawFastHLine(x + r  , y + h - 1, w - r - r, color); // Bottom
-  drawFastVLine(x    , y + r  , h - r - r, color); // Left
-  drawFastVLine(x + w - 1, y + r  , h - r - r, color); // Right
+  writeFastHLine(x + r  , y    , w - r - r, color); // Top
+  writeFastHLine(x + r  , y + h - 1, w - r - r, color); // Bottom
+  writeFastVLine(x    , y + r  , h - r - r, color); // Left
+  writeFastVLine(x + w - 1, y + r  , h - r - r, color); // Right
   // draw four corners
   drawCircleHelper(x + r    , y + r    , r, 1, color);
   drawCircleHelper(x + w - r - 1, y + r    , r, 2, color);
   drawCircleHelper(x + w - r - 1, y + h - r - 1, r, 4, color);
   drawCircleHelper(x + r    , y + h - r - 1, r, 8, color);
+
+  endWrite();
 }
 
 
@@ -830,12 +987,16 @@ void TFT_eSPI::drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t
 // Fill a rounded rectangle
 void TFT_eSPI::fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color)
 {
+  startWrite();
+
   // smarter version
-  fillRect(x + r, y, w - r - r, h, color);
+  writeFillRect(x + r, y, w - r - r, h, color);
 
   // draw four corners
   fillCircleHelper(x + w - r - 1, y + r, r, 1, h - r - r - 1, color);
   fillCircleHelper(x + r    , y + r, r, 2, h - r - r - 1, color);
+
+  endWrite();
 }
 
 
@@ -846,9 +1007,13 @@ void TFT_eSPI::fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t
 // Draw a triangle
 void TFT_eSPI::drawTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color)
 {
+  startWrite();
+
   drawLine(x0, y0, x1, y1, color);
   drawLine(x1, y1, x2, y2, color);
   drawLine(x2, y2, x0, y0, color);
+
+  endWrite();
 }
 
 
@@ -856,74 +1021,243 @@ void TFT_eSPI::drawTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int3
 ** Function name:           fillTriangle
 ** Description:             Draw a filled triangle using 3 arbitrary points
 ***************************************************************************************/
-// Fill a triangle - original Adafruit function works well and code footprint is small
+// Filled as a polygon, the pixels are the same as the original Adafruit function but
+// the edges are stepped without a divide for each row. The corners are 16 bit, so a
+// triangle with a corner outside that range is not drawn rather than drawn wrapped.
 void TFT_eSPI::fillTriangle ( int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color)
 {
-  int32_t a, b, y, last;
+  if ((x0 != (int16_t)x0) || (y0 != (int16_t)y0) || (x1 != (int16_t)x1) ||
+      (y1 != (int16_t)y1) || (x2 != (int16_t)x2) || (y2 != (int16_t)y2)) return;
 
-  // Sort coordinates by Y order (y2 >= y1 >= y0)
-  if (y0 > y1) {
-    swap(y0, y1); swap(x0, x1);
-  }
-  if (y1 > y2) {
-    swap(y2, y1); swap(x2, x1);
-  }
-  if (y0 > y1) {
-    swap(y0, y1); swap(x0, x1);
+  TFT_Point p[3] = { { (int16_t)x0, (int16_t)y0 }, { (int16_t)x1, (int16_t)y1 }, { (int16_t)x2, (int16_t)y2 } };
+
+  // Edge table for 3 corners only, fillPolygon() has room for TFT_POLY_MAX_POINTS
+  TFT_PolyEdge  edge[3];
+  TFT_PolyEdge *active[3];
+  int32_t       spanX0[3], spanX1[3];
+
+  polygonRows(p, 3, color, FILL_EVEN_ODD, edge, active, spanX0, spanX1);
+}
+
+
+/***************************************************************************************
+** Function name:           fillPolygon
+** Description:             fill a polygon, convex or not, a row at a time
+***************************************************************************************/
+// The edges are sorted by their first row and join the active edge list at that row,
+// the active edges are sorted by x and each row is filled between them by the rule.
+// x is stepped by a whole part and a remainder, so there is no divide for each row and
+// x is x0 + dx * (y - y0) / dy rounded towards x0, as in fillTriangle().
+//
+// The outline is included. An edge covers its first row and covers its last row only
+// if the outline turns back up there, so a corner where the outline carries on down
+// is not counted twice. Horizontal edges are added to their row as spans, then the
+// spans of the row are sorted and joined so no pixel is drawn twice.
+void TFT_eSPI::fillPolygon(const TFT_Point *points, uint16_t n, uint32_t color, uint8_t rule)
+{
+  if (!points || !n || (n > TFT_POLY_MAX_POINTS)) return;
+
+  // Sized for the most corners, a row has at most one span per edge
+  TFT_PolyEdge  edge[TFT_POLY_MAX_POINTS];
+  TFT_PolyEdge *active[TFT_POLY_MAX_POINTS];
+  int32_t       spanX0[TFT_POLY_MAX_POINTS], spanX1[TFT_POLY_MAX_POINTS];
+
+  polygonRows(points, n, color, rule, edge, active, spanX0, spanX1);
+}
+
+
+/***************************************************************************************
+** Function name:           polygonRows
+** Description:             fill a polygon using edge and span arrays of n entries
+***************************************************************************************/
+// The arrays are passed in so each caller only has the stack it needs
+void TFT_eSPI::polygonRows(const TFT_Point *points, uint16_t n, uint32_t color, uint8_t rule,
+                           TFT_PolyEdge *edge, TFT_PolyEdge **active, int32_t *spanX0, int32_t *spanX1)
+{
+  // The edge table
+  int32_t ymin = points[0].y, ymax = ymin;
+  for (uint16_t i = 0; i < n; i++) {
+    const TFT_Point *a = &points[i], *b = &points[(i + 1) % n];
+    TFT_PolyEdge *e = &edge[i];
+
+    if (a->y < ymin) ymin = a->y;
+    if (a->y > ymax) ymax = a->y;
+
+    if (a->y == b->y) {
+      e->wind = 0;
+      e->y0 = e->y1 = a->y;
+      e->x  = (a->x < b->x) ? a->x : b->x;
+      e->x1 = (a->x < b->x) ? b->x : a->x;
+      continue;
+    }
+
+    // Step from the top corner t to the bottom corner u
+    const TFT_Point *t = a, *u = b;
+    uint16_t v = (i + 1) % n, k = v, d = 1; // Bottom corner and the way to the next
+    e->wind = 1;
+    if (a->y > b->y) {
+      t = b; u = a;
+      v = k = i;
+      d = n - 1;
+      e->wind = -1;
+    }
+
+    e->y0 = t->y;
+    e->y1 = u->y;
+
+    // Find where the outline goes after the bottom corner, past any horizontal edges
+    do k = (k + d) % n; while (points[k].y == points[v].y);
+    if (points[k].y > points[v].y) e->y1--; // Carries on down, the next edge has the row
+
+    int32_t dx = u->x - t->x;
+    e->sign = (dx < 0) ? -1 : 1;
+    dx = abs(dx);
+    e->dy   = u->y - t->y;
+    e->step = e->sign * (dx / e->dy);
+    e->frac = dx % e->dy;
+    e->x    = t->x;
+    e->err  = 0;
   }
 
-  if (y0 == y2) { // Handle awkward all-on-same-line case as its own thing
-    a = b = x0;
-    if (x1 < a)      a = x1;
-    else if (x1 > b) b = x1;
-    if (x2 < a)      a = x2;
-    else if (x2 > b) b = x2;
-    drawFastHLine(a, y0, b - a + 1, color);
-    return;
+  // Sort the edge table by first row
+  for (uint16_t i = 1; i < n; i++) {
+    TFT_PolyEdge e = edge[i];
+    uint16_t j = i;
+    for (; j && (edge[j - 1].y0 > e.y0); j--) edge[j] = edge[j - 1];
+    edge[j] = e;
   }
 
-  int32_t
-  dx01 = x1 - x0,
-  dy01 = y1 - y0,
-  dx02 = x2 - x0,
-  dy02 = y2 - y0,
-  dx12 = x2 - x1,
-  dy12 = y2 - y1,
-  sa   = 0,
-  sb   = 0;
+  int32_t y  = (ymin < 0) ? 0 : ymin;
+  if (ymax >= (int32_t)_height) ymax = _height - 1;
+
+  uint16_t next = 0, count = 0;
+
+  startWrite();
+
+  for (; y <= ymax; y++) {
+    uint16_t spans = 0;
+
+    // Edges that start on this row, or above the screen
+    while ((next < n) && (edge[next].y0 <= y)) {
+      TFT_PolyEdge *e = &edge[next++];
+      if (e->y1 < y) continue;
+
+      if (!e->wind) { // Only reached on its own row
+        spanX0[spans]   = e->x;
+        spanX1[spans++] = e->x1;
+        continue;
+      }
+
+      if (e->y0 < y) { // Step to the top of the screen, the only divide
+        uint32_t rows = y - e->y0, r = (uint32_t)e->frac * rows;
+        e->x  += e->step * (int32_t)rows + e->sign * (int32_t)(r / e->dy);
+        e->err = r % e->dy;
+      }
+
+      active[count++] = e;
+    }
+
+    // Keep the active edges in x order, they only swap where edges cross
+    for (uint16_t i = 1; i < count; i++) {
+      TFT_PolyEdge *e = active[i];
+      uint16_t j = i;
+      for (; j && (active[j - 1]->x > e->x); j--) active[j] = active[j - 1];
+      active[j] = e;
+    }
+
+    // Spans between the edges
+    if (rule == FILL_NONZERO) {
+      int32_t wind = 0, x0 = 0;
+      for (uint16_t i = 0; i < count; i++) {
+        if (!wind) x0 = active[i]->x;
+        wind += active[i]->wind;
+        if (!wind) {
+          spanX0[spans]   = x0;
+          spanX1[spans++] = active[i]->x;
+        }
+      }
+    }
+    else {
+      for (uint16_t i = 1; i < count; i += 2) {
+        spanX0[spans]   = active[i - 1]->x;
+        spanX1[spans++] = active[i]->x;
+      }
+    }
 
-  // For upper part of triangle, find scanline crossings for segments
-  // 0-1 and 0-2.  If y1=y2 (flat-bottomed triangle), the scanline y1
-  // is included here (and second loop will be skipped, avoiding a /0
-  // error there), otherwise scanline y1 is skipped here and handled
-  // in the second loop...which also avoids a /0 error here if y0=y1
-  // (flat-topped triangle).
-  if (y1 == y2) last = y1;  // Include y1 scanline
-  else         last = y1 - 1; // Skip it
+    // Sort the spans by their left end, then draw them joining any that touch
+    for (uint16_t i = 1; i < spans; i++) {
+      int32_t x0 = spanX0[i], x1 = spanX1[i];
+      uint16_t j = i;
+      for (; j && (spanX0[j - 1] > x0); j--) {
+        spanX0[j] = spanX0[j - 1];
+        spanX1[j] = spanX1[j - 1];
+      }
+      spanX0[j] = x0;
+      spanX1[j] = x1;
+    }
 
-  for (y = y0; y <= last; y++) {
-    a   = x0 + sa / dy01;
-    b   = x0 + sb / dy02;
-    sa += dx01;
-    sb += dx02;
+    for (uint16_t i = 0; i < spans; ) {
+      int32_t x0 = spanX0[i], x1 = spanX1[i];
+      for (i++; (i < spans) && (spanX0[i] <= x1 + 1); i++)
+        if (spanX1[i] > x1) x1 = spanX1[i];
+      writeFastHLine(x0, y, x1 - x0 + 1, color);
+    }
 
-    if (a > b) swap(a, b);
-    drawFastHLine(a, y, b - a + 1, color);
+    // Drop the edges that end on this row and step the others to the next
+    uint16_t kept = 0;
+    for (uint16_t i = 0; i < count; i++) {
+      TFT_PolyEdge *e = active[i];
+      if (e->y1 <= y) continue;
+
+      e->x   += e->step;
+      e->err += e->frac;
+      if (e->err >= e->dy) {
+        e->err -= e->dy;
+        e->x   += e->sign;
+      }
+      active[kept++] = e;
+    }
+    count = kept;
   }
 
-  // For lower part of triangle, find scanline crossings for segments
-  // 0-2 and 1-2.  This loop is skipped if y1=y2.
-  sa = dx12 * (y - y1);
-  sb = dx02 * (y - y0);
-  for (; y <= y2; y++) {
-    a   = x1 + sa / dy12;
-    b   = x0 + sb / dy02;
-    sa += dx12;
-    sb += dx02;
+  endWrite();
+}
+
 
-    if (a > b) swap(a, b);
-    drawFastHLine(a, y, b - a + 1, color);
+/***************************************************************************************
+** Function name:           bitRun
+** Description:             find the length of a run of equal bits in a bitmap row
+***************************************************************************************/
+// row holds 1 bit per pixel, first pixel in bit 7. The run starts at column c and stops
+// at column end, *set is the value of its bits. Bytes that are all the same are stepped
+// over 8 bits at a time, otherwise the run is found with a leading bit count.
+static inline int32_t bitRun(const uint8_t *row, int32_t c, int32_t end, boolean *set)
+{
+  int32_t  i = c >> 3, left = 8 - (c & 7), len = 0;
+  uint32_t bits = (uint32_t)pgm_read_byte(row + i) << (24 + (c & 7));
+  boolean  s = bits & 0x80000000;
+  uint8_t  same = s ? 0xFF : 0x00;
+
+  *set = s;
+
+  while (1) {
+    uint32_t v = s ? ~bits : bits; // Leading zeros are the run, padding bits end it
+    int32_t  k = v ? __builtin_clz(v) : 32;
+    if (k < left) { len += k; break; }
+    len += left;
+
+    if (c + len >= end) break;
+    uint8_t b = pgm_read_byte(row + ++i);
+    while ((b == same) && (c + len + 8 < end)) {
+      len += 8;
+      b = pgm_read_byte(row + ++i);
+    }
+    bits = (uint32_t)b << 24;
+    left = 8;
   }
+
+  if (c + len > end) len = end - c;
+  return len;
 }
 
 
@@ -931,17 +1265,60 @@ void TFT_eSPI::fillTriangle ( int32_t x0, int32_t y0, int32_t x1, int32_t y1, in
 ** Function name:           drawBitmap
 ** Description:             Draw an image stored in an array on the TFT
 ***************************************************************************************/
+// The set bits are drawn as runs of horizontal lines, the clear bits are left as they
+// are. The bitmap is clipped to the screen before it is scanned.
 void TFT_eSPI::drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color) {
+  int32_t byteWidth = (w + 7) / 8;
+  int32_t c0 = (x < 0) ? -x : 0, c1 = w,
+          r0 = (y < 0) ? -y : 0, r1 = h;
+  if (x + c1 > (int32_t)_width)  c1 = _width - x;
+  if (y + r1 > (int32_t)_height) r1 = _height - y;
+  if ((c0 >= c1) || (r0 >= r1)) return;
+
+  startWrite();
+
+  for (int32_t j = r0; j < r1; j++) {
+    const uint8_t *row = bitmap + j * byteWidth;
+    for (int32_t i = c0; i < c1; ) {
+      boolean set;
+      int32_t n = bitRun(row, i, c1, &set);
+      if (set) writeFastHLine(x + i, y + j, n, color);
+      i += n;
+    }
+  }
+
+  endWrite();
+}
 
-  int32_t i, j, byteWidth = (w + 7) / 8;
 
-  for (j = 0; j < h; j++) {
-    for (i = 0; i < w; i++ ) {
-      if (pgm_read_byte(bitmap + j * byteWidth + i / 8) & (128 >> (i & 7))) {
-        drawPixel(x + i, y + j, color);
-      }
+/***************************************************************************************
+** Function name:           drawBitmap
+** Description:             Draw an image stored in an array with its background
+***************************************************************************************/
+// The part of the bitmap on the screen is sent in one window as runs of the two colours
+void TFT_eSPI::drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t fgcolor, uint16_t bgcolor) {
+  int32_t byteWidth = (w + 7) / 8;
+  int32_t c0 = (x < 0) ? -x : 0, c1 = w,
+          r0 = (y < 0) ? -y : 0, r1 = h;
+  if (x + c1 > (int32_t)_width)  c1 = _width - x;
+  if (y + r1 > (int32_t)_height) r1 = _height - y;
+  if ((c0 >= c1) || (r0 >= r1)) return;
+
+  startWrite();
+
+  setWindow(x + c0, y + r0, x + c1 - 1, y + r1 - 1);
+
+  for (int32_t j = r0; j < r1; j++) {
+    const uint8_t *row = bitmap + j * byteWidth;
+    for (int32_t i = c0; i < c1; ) {
+      boolean set;
+      int32_t n = bitRun(row, i, c1, &set);
+      pushColor(set ? fgcolor : bgcolor, n);
+      i += n;
     }
   }
+
+  endWrite();
 }
 
 
@@ -953,6 +1330,9 @@ void TFT_eSPI::setCursor(int16_t x, int16_t y)
 {
   cursor_x = x;
   cursor_y = y;
+#ifdef LOAD_GFXFF
+  kernLast = 0; // Not next to the last character printed
+#endif
 }
 
 
@@ -965,6 +1345,9 @@ void TFT_eSPI::setCursor(int16_t x, int16_t y, uint8_t font)
   textfont = font;
   cursor_x = x;
   cursor_y = y;
+#ifdef LOAD_GFXFF
+  kernLast = 0;
+#endif
 }
 
 
@@ -1063,92 +1446,296 @@ int16_t TFT_eSPI::height(void)
 }
 
 
+#ifdef LOAD_UNICODE
 /***************************************************************************************
-** Function name:           textWidth
-** Description:             Return the width in pixels of a string in a given font
+** Function name:           decodeUTF8
+** Description:             decode the UTF-8 character at the start of a string
 ***************************************************************************************/
-int16_t TFT_eSPI::textWidth(const String& string)
+// *string is moved past the character. A byte that does not start a valid sequence is
+// returned unchanged and only that byte is skipped. Characters above 0xFFFF are not
+// supported by the fonts and are returned as 0xFFFD, the replacement character.
+uint16_t TFT_eSPI::decodeUTF8(const char **string)
 {
-	int16_t len = string.length() + 2;
-	char buffer[len];
-	string.toCharArray(buffer, len);
-	return textWidth(buffer, textfont);
-}
+  const uint8_t *s = (const uint8_t *)*string;
+  uint32_t code = *s;
+  uint8_t  n    = 0; // Continuation bytes
+
+  if      ((code & 0xE0) == 0xC0) { code &= 0x1F; n = 1; }
+  else if ((code & 0xF0) == 0xE0) { code &= 0x0F; n = 2; }
+  else if ((code & 0xF8) == 0xF0) { code &= 0x07; n = 3; }
+
+  for (uint8_t i = 1; i <= n; i++) {
+    if ((s[i] & 0xC0) != 0x80) { // Not a sequence, e.g. Latin-1 text
+      *string += 1;
+      return *s;
+    }
+    code = (code << 6) | (s[i] & 0x3F);
+  }
 
-int16_t TFT_eSPI::textWidth(const String& string, int font)
-{
-	int16_t len = string.length() + 2;
-	char buffer[len];
-	string.toCharArray(buffer, len);
-	return textWidth(buffer, font);
+  *string += n + 1;
+  return (code > 0xFFFF) ? 0xFFFD : code;
 }
 
-int16_t TFT_eSPI::textWidth(const char *string)
-{
-	return textWidth(string, textfont);
-}
 
-int16_t TFT_eSPI::textWidth(const char *string, int font)
+/***************************************************************************************
+** Function name:           decodeUTF8
+** Description:             decode a UTF-8 byte stream one byte at a time
+***************************************************************************************/
+// Returns 0 while a character is incomplete. A character that is cut short by a byte
+// that does not continue it is dropped, stray bytes are returned unchanged.
+uint16_t TFT_eSPI::decodeUTF8(uint8_t c)
 {
-  unsigned int str_width  = 0;
-  char uniCode;
-  char *widthtable;
+  if (utf8Count && ((c & 0xC0) == 0x80)) {
+    utf8Code = (utf8Code << 6) | (c & 0x3F);
+    if (--utf8Count) return 0;
+    return (utf8Code > 0xFFFF) ? 0xFFFD : utf8Code;
+  }
 
-  if (font>1 && font<9)
-  {
-    widthtable = (char *)pgm_read_dword( &(fontdata[font].widthtbl ) ) - 32; //subtract the 32 outside the loop
+  utf8Count = 0;
+  if      ((c & 0xE0) == 0xC0) { utf8Code = c & 0x1F; utf8Count = 1; }
+  else if ((c & 0xF0) == 0xE0) { utf8Code = c & 0x0F; utf8Count = 2; }
+  else if ((c & 0xF8) == 0xF0) { utf8Code = c & 0x07; utf8Count = 3; }
+  else return c;
 
-    while (*string)
-    {
-      uniCode = *(string++);
+  return 0;
+}
+#endif
 
-      str_width += pgm_read_byte( widthtable + uniCode); // Normally we need to subract 32 from uniCode
-    }
-  }
-  else
-  {
 
 #ifdef LOAD_GFXFF
-    if(gfxFont) // New font
-    {
-      while (*string)
-      {
-        uniCode = *(string++);
-		if (uniCode > (uint8_t)pgm_read_byte(&gfxFont->last)) uniCode = pgm_read_byte(&gfxFont->first);
-        uniCode -= pgm_read_byte(&gfxFont->first);
-        GFXglyph *glyph  = &(((GFXglyph *)pgm_read_dword(&gfxFont->glyph))[uniCode]);
-        // If this is not the  last character then use xAdvance
-        if (*string) str_width += pgm_read_byte(&glyph->xAdvance);
-        // Else use the offset plus width since this can be bigger than xAdvance
-        else str_width += ((int8_t)pgm_read_byte(&glyph->xOffset) + pgm_read_byte(&glyph->width));
-      }
-    }
-    else
-#endif
-    {
-#ifdef LOAD_GLCD
-      while (*string++) str_width += 6;
+/***************************************************************************************
+** Function name:           nextChar
+** Description:             return the next character code of a free font string
+***************************************************************************************/
+// *string is moved past the character, UTF-8 is only decoded if LOAD_UNICODE is defined
+inline uint16_t TFT_eSPI::nextChar(const char **string)
+{
+#ifdef LOAD_UNICODE
+  return decodeUTF8(string);
+#else
+  return (uint8_t)*((*string)++);
 #endif
-    }
-  }
-  return str_width * textsize;
 }
 
 
 /***************************************************************************************
-** Function name:           fontsLoaded
-** Description:             return an encoded 16 bit value showing the fonts loaded
+** Function name:           glyphIndex
+** Description:             find the glyph of a character code in the free font
 ***************************************************************************************/
-// Returns a value showing which fonts are loaded (bit N set =  Font N loaded)
-
-uint16_t TFT_eSPI::fontsLoaded(void)
+// Codes above the font range, or in no range of a font with ranges, use the first glyph
+// (normally the space). Returns -1 for codes below the first in a font without ranges.
+inline int32_t TFT_eSPI::glyphIndex(uint16_t c)
 {
-  return fontsloaded;
+#ifdef LOAD_UNICODE
+  GFXrange *range = (GFXrange *)pgm_read_dword(&gfxFont->range);
+  if (range) {
+    // Binary search of the ranges, they are in code order
+    uint16_t lo = 0, hi = pgm_read_word(&gfxFont->ranges);
+    while (lo < hi) {
+      uint16_t mid = (lo + hi) >> 1;
+      if (c < pgm_read_word(&range[mid].first)) hi = mid;
+      else if (c > pgm_read_word(&range[mid].last)) lo = mid + 1;
+      else return pgm_read_word(&range[mid].glyph) + c - pgm_read_word(&range[mid].first);
+    }
+    return 0;
+  }
+#endif
+  if (c > pgm_read_byte(&gfxFont->last)) c = pgm_read_byte(&gfxFont->first);
+  return (int32_t)c - pgm_read_byte(&gfxFont->first);
 }
+#endif
 
 
+#ifdef LOAD_GFXFF
 /***************************************************************************************
-** Function name:           fontHeight
+** Function name:           setKerning
+** Description:             set the kerning pairs of the current free font
+***************************************************************************************/
+void TFT_eSPI::setKerning(const GFXkern *pairs, uint16_t count)
+{
+  kernPairs = pairs;
+  kernCount = pairs ? count : 0;
+}
+
+
+/***************************************************************************************
+** Function name:           kerning
+** Description:             return the kerning of a character pair, 0 if none
+***************************************************************************************/
+// Binary search of the pairs, they are in left then right character code order
+int8_t TFT_eSPI::kerning(uint16_t left, uint16_t right)
+{
+  uint32_t key = ((uint32_t)left << 16) | right;
+  uint16_t lo = 0, hi = kernCount;
+  while (lo < hi) {
+    uint16_t mid = (lo + hi) >> 1;
+    uint32_t pair = ((uint32_t)pgm_read_word(&kernPairs[mid].left) << 16) | pgm_read_word(&kernPairs[mid].right);
+    if (key < pair) hi = mid;
+    else if (key > pair) lo = mid + 1;
+    else return (int8_t)pgm_read_byte(&kernPairs[mid].xAdjust);
+  }
+  return 0;
+}
+
+
+/***************************************************************************************
+** Function name:           layoutString
+** Description:             find the glyphs of a free font string and their positions
+***************************************************************************************/
+// Returns the width of the string at textsize 1, the x advances (with kerning) up to the
+// last glyph plus the extent of the last glyph. If pos is not NULL the glyphs are stored
+// there and *count is set, pos[*count].x is then the total x advance. pos needs room
+// for max + 1 entries, if there are more than max glyphs they are counted but only the
+// first max are stored.
+int32_t TFT_eSPI::layoutString(const char *string, TFT_GlyphPos *pos, uint16_t *count, uint16_t max)
+{
+  GFXglyph *glyphs = (GFXglyph *)pgm_read_dword(&gfxFont->glyph);
+  int32_t  x = 0, width = 0;
+  uint16_t n = 0, last = 0;
+
+  while (*string) {
+    uint16_t c  = nextChar(&string);
+    int32_t  gi = glyphIndex(c);
+    if (gi < 0) continue; // No glyph
+
+    if (kernPairs && last) x += kerning(last, c);
+    last = c;
+
+    GFXglyph *glyph = &glyphs[gi];
+    if (pos && (n < max)) {
+      pos[n].code  = c;
+      pos[n].glyph = gi;
+      pos[n].x     = x;
+    }
+    n++;
+
+    // The last glyph can reach beyond its xAdvance
+    width = x + (int8_t)pgm_read_byte(&glyph->xOffset) + pgm_read_byte(&glyph->width);
+    x += pgm_read_byte(&glyph->xAdvance);
+  }
+
+  if (pos) {
+    if (n <= max) pos[n].x = x;
+    *count = n;
+  }
+  return n ? width : 0;
+}
+#endif
+
+
+/***************************************************************************************
+** Function name:           charMetrics
+** Description:             find the x advance and the columns drawn by a character
+***************************************************************************************/
+// The values are at textsize 1 for the current font (font 1 is the free font if one is
+// set), ink0 and ink1 are the first and last + 1 columns drawn from the origin of the
+// character, with the background if it is drawn. Returns false if there is no glyph.
+boolean TFT_eSPI::charMetrics(uint16_t c, uint8_t font, int16_t *xAdvance, int16_t *ink0, int16_t *ink1)
+{
+#ifdef LOAD_GFXFF
+  if ((font == 1) && gfxFont) {
+    int32_t gi = glyphIndex(c);
+    if (gi < 0) return false;
+    GFXglyph *glyph = &(((GFXglyph *)pgm_read_dword(&gfxFont->glyph))[gi]);
+    *xAdvance = pgm_read_byte(&glyph->xAdvance);
+    *ink0     = (int8_t)pgm_read_byte(&glyph->xOffset);
+    *ink1     = *ink0 + pgm_read_byte(&glyph->width);
+    return true;
+  }
+#endif
+
+  if (font == 1) { // GLCD
+    *xAdvance = 6;
+    *ink0 = 0;
+    *ink1 = 6;
+    return true;
+  }
+
+  if ((c < 32) || (c > 127)) return false; // Not in the numbered fonts
+  *xAdvance = pgm_read_byte(pgm_read_dword(&(fontdata[font].widthtbl)) + c - 32);
+  *ink0 = 0;
+  // The font 2 block write sends whole bytes of the glyph bitmap
+  *ink1 = ((font == 2) && (textsize == 1)) ? ((*xAdvance + 6) >> 3) << 3 : *xAdvance;
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           textWidth
+** Description:             Return the width in pixels of a string in a given font
+***************************************************************************************/
+int16_t TFT_eSPI::textWidth(const String& string)
+{
+	int16_t len = string.length() + 2;
+	char buffer[len];
+	string.toCharArray(buffer, len);
+	return textWidth(buffer, textfont);
+}
+
+int16_t TFT_eSPI::textWidth(const String& string, int font)
+{
+	int16_t len = string.length() + 2;
+	char buffer[len];
+	string.toCharArray(buffer, len);
+	return textWidth(buffer, font);
+}
+
+int16_t TFT_eSPI::textWidth(const char *string)
+{
+	return textWidth(string, textfont);
+}
+
+int16_t TFT_eSPI::textWidth(const char *string, int font)
+{
+  unsigned int str_width  = 0;
+  char uniCode;
+  char *widthtable;
+
+  if (font>1 && font<9)
+  {
+    widthtable = (char *)pgm_read_dword( &(fontdata[font].widthtbl ) ) - 32; //subtract the 32 outside the loop
+
+    while (*string)
+    {
+      uniCode = *(string++);
+
+      str_width += pgm_read_byte( widthtable + uniCode); // Normally we need to subract 32 from uniCode
+    }
+  }
+  else
+  {
+
+#ifdef LOAD_GFXFF
+    if(gfxFont) // New font
+    {
+      str_width = layoutString(string, NULL, NULL);
+    }
+    else
+#endif
+    {
+#ifdef LOAD_GLCD
+      while (*string++) str_width += 6;
+#endif
+    }
+  }
+  return str_width * textsize;
+}
+
+
+/***************************************************************************************
+** Function name:           fontsLoaded
+** Description:             return an encoded 16 bit value showing the fonts loaded
+***************************************************************************************/
+// Returns a value showing which fonts are loaded (bit N set =  Font N loaded)
+
+uint16_t TFT_eSPI::fontsLoaded(void)
+{
+  return fontsloaded;
+}
+
+
+/***************************************************************************************
+** Function name:           fontHeight
 ** Description:             return the height of a font (yAdvance for free fonts)
 ***************************************************************************************/
 int16_t TFT_eSPI::fontHeight(int16_t font)
@@ -1170,7 +1757,7 @@ int16_t TFT_eSPI::fontHeight(int16_t font)
 ** Function name:           drawChar
 ** Description:             draw a single character in the Adafruit GLCD font
 ***************************************************************************************/
-void TFT_eSPI::drawChar(int32_t x, int32_t y, unsigned char c, uint32_t color, uint32_t bg, uint8_t size)
+void TFT_eSPI::drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size)
 {
   if ((x >= (int16_t)_width)            || // Clip right
       (y >= (int16_t)_height)           || // Clip bottom
@@ -1178,6 +1765,8 @@ void TFT_eSPI::drawChar(int32_t x, int32_t y, unsigned char c, uint32_t color, u
       ((y + 8 * size - 1) < 0))   // Clip top
     return;
 
+  startWrite();
+
 #ifdef LOAD_GLCD
 //>>>>>>>>>>>>>>>>>>
 #ifdef LOAD_GFXFF
@@ -1187,13 +1776,11 @@ void TFT_eSPI::drawChar(int32_t x, int32_t y, unsigned char c, uint32_t color, u
 
   boolean fillbg = (bg != color);
 
-spi_begin();
-
   if ((size==1) && fillbg)
   {
     byte column[6];
     byte mask = 0x1;
-    setAddrWindow(x, y, x+5, y+8);
+    writeAddrWindow(x, y, x+5, y+8);
     for (int8_t i = 0; i < 5; i++ ) column[i] = pgm_read_byte(font + (c * 5) + i);
     column[5] = 0;
 
@@ -1201,19 +1788,18 @@ spi_begin();
       for (int8_t k = 0; k < 5; k++ ) {
         if (column[k] & mask) {
           //_SPI->transfer(color >> 8);
-          _SPI->write16(color);
+          tft_Write_16(color);
         }
         else {
           //_SPI->transfer(bg >> 8);
-          _SPI->write16(bg);
+          tft_Write_16(bg);
         }
       }
 
       mask <<= 1;
       //_SPI->transfer(bg >> 8);
-      _SPI->write16(bg);
+      tft_Write_16(bg);
     }
-    CS_H;
   }
   else
   {
@@ -1227,14 +1813,14 @@ spi_begin();
       if (size == 1) // default size
       {
         for (int8_t j = 0; j < 8; j++) {
-          if (line & 0x1) drawPixel(x + i, y + j, color);
+          if (line & 0x1) writePixel(x + i, y + j, color);
           line >>= 1;
         }
       }
       else {  // big size
         for (int8_t j = 0; j < 8; j++) {
-          if (line & 0x1) fillRect(x + (i * size), y + (j * size), size, size, color);
-          else if (fillbg) fillRect(x + i * size, y + j * size, size, size, bg);
+          if (line & 0x1) writeFillRect(x + (i * size), y + (j * size), size, size, color);
+          else if (fillbg) writeFillRect(x + i * size, y + j * size, size, size, bg);
           line >>= 1;
         }
       }
@@ -1253,24 +1839,18 @@ spi_begin();
     // Character is assumed previously filtered by write() to eliminate
     // newlines, returns, non-printable characters, etc.  Calling drawChar()
     // directly with 'bad' characters of font may cause mayhem!
-    if (c > pgm_read_byte(&gfxFont->last)) c = pgm_read_byte(&gfxFont->first);;
-    c -= pgm_read_byte(&gfxFont->first);
-    GFXglyph *glyph  = &(((GFXglyph *)pgm_read_dword(&gfxFont->glyph))[c]);
+    int32_t gi = glyphIndex(c);
+    if (gi < 0) { endWrite(); return; } // No glyph
+    GFXglyph *glyph  = &(((GFXglyph *)pgm_read_dword(&gfxFont->glyph))[gi]);
     uint8_t  *bitmap = (uint8_t *)pgm_read_dword(&gfxFont->bitmap);
 
     uint16_t bo = pgm_read_word(&glyph->bitmapOffset);
     uint8_t  w  = pgm_read_byte(&glyph->width),
-             h  = pgm_read_byte(&glyph->height),
-             xa = pgm_read_byte(&glyph->xAdvance);
+             h  = pgm_read_byte(&glyph->height);
     int8_t   xo = pgm_read_byte(&glyph->xOffset),
              yo = pgm_read_byte(&glyph->yOffset);
     uint8_t  xx, yy, bits, bit=0;
-    int16_t  xo16, yo16;
-
-    if(size > 1) {
-      xo16 = xo;
-      yo16 = yo;
-    }
+    int16_t  xo16 = xo, yo16 = yo; // Used if size > 1
 
     // Todo: Add character clipping here
 
@@ -1282,7 +1862,7 @@ spi_begin();
     // proportionally-spaced fonts with glyphs of varying sizes (and that
     // may overlap).  To replace previously-drawn text when using a custom
     // font, use the getTextBounds() function to determine the smallest
-    // rectangle encompassing a string, erase the area with fillRect(),
+    // rectangle encompassing a string, erase the area with writeFillRect(),
     // then draw new text.  This WILL infortunately 'blink' the text, but
     // is unavoidable.  Drawing 'background' pixels will NOT fix this,
     // only creates a new set of problems.  Have an idea to work around
@@ -1290,6 +1870,9 @@ spi_begin();
     // displays supporting setAddrWindow() and pushColors()), but haven't
     // implemented this yet.
 
+    // drawString() does this without the blink when the text has a background
+    // colour, see drawFreeFontOpaque().
+
 // Here we have 3 versions of the same function just for evaluation purposes
 // Comment out the next two #defines to revert to the slower Adafruit implementation
 
@@ -1308,6 +1891,27 @@ spi_begin();
 #define FAST_SHIFT
 //FIXED_SIZE is an option in User_Setup.h that only works with FAST_LINE enabled
 
+    if (smoothFont) {
+      drawSmoothGlyph(x + xo * size, y + yo * size, bitmap + bo, w, h, color, bg, size);
+      endWrite();
+      return;
+    }
+
+    // Draw the runs from the glyph cache if it is enabled, the glyph is decoded into
+    // the cache the first time it is drawn
+    if (glyphCache) {
+      TFT_GlyphEntry *entry = glyphCacheGet(gfxFont, gi);
+      if (entry) {
+        uint8_t *run = (uint8_t *)(entry + 1);
+        for (uint16_t n = entry->runs; n > 0; n--, run += 3) {
+          if(size == 1) writeFastHLine(x+xo+run[1], y+yo+run[0], run[2], color);
+          else writeFillRect(x+(xo16+run[1])*size, y+(yo16+run[0])*size, size*run[2], size, color);
+        }
+        endWrite();
+        return;
+      }
+    }
+
 #ifdef FIXED_SIZE
     x+=xo; // Save 88 bytes of FLASH
     y+=yo;
@@ -1327,10 +1931,10 @@ spi_begin();
         else {
           if (hpc) {
 #ifndef FIXED_SIZE
-            if(size == 1) drawFastHLine(x+xo+xx-hpc, y+yo+yy, hpc, color);
-            else fillRect(x+(xo16+xx-hpc)*size, y+(yo16+yy)*size, size*hpc, size, color);
+            if(size == 1) writeFastHLine(x+xo+xx-hpc, y+yo+yy, hpc, color);
+            else writeFillRect(x+(xo16+xx-hpc)*size, y+(yo16+yy)*size, size*hpc, size, color);
 #else
-            drawFastHLine(x+xx-hpc, y+yy, hpc, color);
+            writeFastHLine(x+xx-hpc, y+yy, hpc, color);
 #endif
             hpc=0;
           }
@@ -1340,10 +1944,10 @@ spi_begin();
       // Draw pixels for this line as we are about to increment yy
           if (hpc) {
 #ifndef FIXED_SIZE
-            if(size == 1) drawFastHLine(x+xo+xx-hpc, y+yo+yy, hpc, color);
-            else fillRect(x+(xo16+xx-hpc)*size, y+(yo16+yy)*size, size*hpc, size, color);
+            if(size == 1) writeFastHLine(x+xo+xx-hpc, y+yo+yy, hpc, color);
+            else writeFillRect(x+(xo16+xx-hpc)*size, y+(yo16+yy)*size, size*hpc, size, color);
 #else
-            drawFastHLine(x+xx-hpc, y+yy, hpc, color);
+            writeFastHLine(x+xx-hpc, y+yy, hpc, color);
 #endif
             hpc=0;
           }
@@ -1358,8 +1962,8 @@ spi_begin();
         if(bits & 0x80) hpc++;
         else {
           if (hpc) {
-            if(size == 1) drawFastHLine(x+xo+xx-hpc, y+yo+yy, hpc, color);
-            else fillRect(x+(xo16+xx-hpc)*size, y+(yo16+yy)*size, size*hpc, size, color);
+            if(size == 1) writeFastHLine(x+xo+xx-hpc, y+yo+yy, hpc, color);
+            else writeFillRect(x+(xo16+xx-hpc)*size, y+(yo16+yy)*size, size*hpc, size, color);
             hpc=0;
           }
         }
@@ -1367,8 +1971,8 @@ spi_begin();
       }
       // Draw pixels for this line as we are about to increment yy
       if (hpc) {
-        if(size == 1) drawFastHLine(x+xo+xx-hpc, y+yo+yy, hpc, color);
-        else fillRect(x+(xo16+xx-hpc)*size, y+(yo16+yy)*size, size*hpc, size, color);
+        if(size == 1) writeFastHLine(x+xo+xx-hpc, y+yo+yy, hpc, color);
+        else writeFillRect(x+(xo16+xx-hpc)*size, y+(yo16+yy)*size, size*hpc, size, color);
         hpc=0;
       }
     }
@@ -1382,9 +1986,9 @@ spi_begin();
         }
         if(bits & 0x80) {
           if(size == 1) {
-            drawPixel(x+xo+xx, y+yo+yy, color);
+            writePixel(x+xo+xx, y+yo+yy, color);
           } else {
-            fillRect(x+(xo16+xx)*size, y+(yo16+yy)*size, size, size, color);
+            writeFillRect(x+(xo16+xx)*size, y+(yo16+yy)*size, size, size, color);
           }
         }
         bits <<= 1;
@@ -1400,7 +2004,7 @@ spi_begin();
   #endif
 #endif
 
-spi_end();
+  endWrite();
 }
 
 
@@ -1408,13 +2012,12 @@ spi_end();
 ** Function name:           setWindow
 ** Description:             define an area to receive a stream of pixels
 ***************************************************************************************/
-// Chip select is high at the end of this function
+// Chip select is high at the end of this function unless a startWrite() session is open
 
 void TFT_eSPI::setWindow(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
 {
   spi_begin();
-  setAddrWindow(x0, y0, x1, y1);
-  CS_H;
+  writeAddrWindow(x0, y0, x1, y1);
   spi_end();
 }
 
@@ -1423,16 +2026,28 @@ void TFT_eSPI::setWindow(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
 ** Function name:           setAddrWindow
 ** Description:             define an area to receive a stream of pixels
 ***************************************************************************************/
-// Chip select stays low, use setWindow() from sketches
+// Same as setWindow(), retained for compatibility with existing sketches
 
-#ifdef ESP8266
-inline void TFT_eSPI::setAddrWindow(int32_t xs, int32_t ys, int32_t xe, int32_t ye)
+void TFT_eSPI::setAddrWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1)
 {
   spi_begin();
+  writeAddrWindow(x0, y0, x1, y1);
+  spi_end();
+}
 
-  addr_col = 0xFFFF;
-  addr_row = 0xFFFF;
-  
+
+/***************************************************************************************
+** Function name:           writeAddrWindow
+** Description:             define an area to receive a stream of pixels
+***************************************************************************************/
+// For use inside startWrite()/endWrite(), the RAMWR command is sent so pixels can follow
+
+#ifdef ESP8266
+void TFT_eSPI::writeAddrWindow(int32_t xs, int32_t ys, int32_t xe, int32_t ye)
+{
+#ifdef TFT_DMA
+  if (dmaQueued) dmaWait(); // Queued pixels go to the old window
+#endif
 #if defined (ST7735_DRIVER) && (defined (ST7735_GREENTAB) || defined (GREENTAB2))
   xs+=colstart;
   xe+=colstart;
@@ -1440,26 +2055,32 @@ inline void TFT_eSPI::setAddrWindow(int32_t xs, int32_t ys, int32_t xe, int32_t
   ye+=rowstart;
 #endif
 
-  // Column addr set
-  DC_C;
-  CS_L;
-
   uint32_t mask = ~((SPIMMOSI << SPILMOSI) | (SPIMMISO << SPILMISO));
   mask = SPI1U1 & mask;
 
-  SPI1U1 = mask | (7 << SPILMOSI) | (7 << SPILMISO);
+  // No need to send the columns if they have not changed (speeds things up)
+  if (((int32_t)addr_col != xs) || (win_xe != xe)) {
 
-  SPI1W0 = TFT_CASET;
-  SPI1CMD |= SPIBUSY;
-  while(SPI1CMD & SPIBUSY) {}
+    // Column addr set
+    DC_C;
 
-  DC_D;
+    SPI1U1 = mask | (7 << SPILMOSI) | (7 << SPILMISO);
 
-  SPI1U1 = mask | (31 << SPILMOSI) | (31 << SPILMISO);
-  // Load the two coords as a 32 bit value and shift in one go
-  SPI1W0 = (xs >> 8) | (uint16_t)(xs << 8) | ((uint8_t)(xe >> 8)<<16 | (xe << 24));
-  SPI1CMD |= SPIBUSY;
-  while(SPI1CMD & SPIBUSY) {}
+    SPI1W0 = TFT_CASET;
+    SPI1CMD |= SPIBUSY;
+    while(SPI1CMD & SPIBUSY) {}
+
+    DC_D;
+
+    SPI1U1 = mask | (31 << SPILMOSI) | (31 << SPILMISO);
+    // Load the two coords as a 32 bit value and shift in one go
+    SPI1W0 = (xs >> 8) | (uint16_t)(xs << 8) | ((uint8_t)(xe >> 8)<<16 | (xe << 24));
+    SPI1CMD |= SPIBUSY;
+    while(SPI1CMD & SPIBUSY) {}
+
+    addr_col = xs;
+    win_xe   = xe;
+  }
 
   // This proves we can only change the byte level bit SPI register read-out order, not the actual byte order
   // So we can't use this method to avoid coordinate byte order swapping! 
@@ -1476,22 +2097,29 @@ inline void TFT_eSPI::setAddrWindow(int32_t xs, int32_t ys, int32_t xe, int32_t
   //while(SPI1CMD & SPIBUSY) {}
   //SPI1C &= ~(SPICWBO | SPICRBO); // MSB first = default
 
-  // Row addr set
-  DC_C;
+  // No need to send the rows if they have not changed (speeds things up)
+  if (((int32_t)addr_row != ys) || (win_ye != ye)) {
 
-  SPI1U1 = mask | (7 << SPILMOSI) | (7 << SPILMISO);
+    // Row addr set
+    DC_C;
 
-  SPI1W0 = TFT_PASET;
-  SPI1CMD |= SPIBUSY;
-  while(SPI1CMD & SPIBUSY) {}
+    SPI1U1 = mask | (7 << SPILMOSI) | (7 << SPILMISO);
 
-  DC_D;
+    SPI1W0 = TFT_PASET;
+    SPI1CMD |= SPIBUSY;
+    while(SPI1CMD & SPIBUSY) {}
 
-  SPI1U1 = mask | (31 << SPILMOSI) | (31 << SPILMISO);
-  // Load the two coords as a 32 bit value and shift in one go
-  SPI1W0 = (ys >> 8) | (uint16_t)(ys << 8) | ((uint8_t)(ye >> 8)<<16 | (ye << 24));
-  SPI1CMD |= SPIBUSY;
-  while(SPI1CMD & SPIBUSY) {}
+    DC_D;
+
+    SPI1U1 = mask | (31 << SPILMOSI) | (31 << SPILMISO);
+    // Load the two coords as a 32 bit value and shift in one go
+    SPI1W0 = (ys >> 8) | (uint16_t)(ys << 8) | ((uint8_t)(ye >> 8)<<16 | (ye << 24));
+    SPI1CMD |= SPIBUSY;
+    while(SPI1CMD & SPIBUSY) {}
+
+    addr_row = ys;
+    win_ye   = ye;
+  }
 
   // write to RAM
   DC_C;
@@ -1502,18 +2130,14 @@ inline void TFT_eSPI::setAddrWindow(int32_t xs, int32_t ys, int32_t xe, int32_t
   while(SPI1CMD & SPIBUSY) {}
 
   DC_D;
-
-  spi_end();
 }
 #else
 
-inline void TFT_eSPI::setAddrWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+void TFT_eSPI::writeAddrWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1)
 {
-  spi_begin();
-
-  addr_col = 0xFFFF;
-  addr_row = 0xFFFF;
-
+#ifdef TFT_DMA
+  if (dmaQueued) dmaWait(); // Queued pixels go to the old window
+#endif
 #if defined (ST7735_DRIVER) && (defined (ST7735_GREENTAB) || defined (GREENTAB2))
   x0+=colstart;
   x1+=colstart;
@@ -1521,37 +2145,48 @@ inline void TFT_eSPI::setAddrWindow(int32_t x0, int32_t y0, int32_t x1, int32_t
   y1+=rowstart;
 #endif
 
-  // Column addr set
-  DC_C;
-  CS_L;
+  // No need to send the columns if they have not changed (speeds things up)
+  if (((int32_t)addr_col != x0) || (win_xe != x1)) {
 
-  _SPI->write(TFT_CASET);
+    // Column addr set
+    DC_C;
 
-  DC_D;
+    tft_Write_8(TFT_CASET);
 
-  _SPI->write16((x0 >> 8) | (x0 << 8));
+    DC_D;
 
-  _SPI->write16((x1 >> 8) | (x1 << 8));
+    tft_Write_16(x0);
 
-  // Row addr set
-  DC_C;
+    tft_Write_16(x1);
 
-  _SPI->write(TFT_PASET);
+    addr_col = x0;
+    win_xe   = x1;
+  }
 
-  DC_D;
+  // No need to send the rows if they have not changed (speeds things up)
+  if (((int32_t)addr_row != y0) || (win_ye != y1)) {
+
+    // Row addr set
+    DC_C;
+
+    tft_Write_8(TFT_PASET);
+
+    DC_D;
 
-  _SPI->write16((y0 >> 8) | (y0 << 8));
+    tft_Write_16(y0);
 
-  _SPI->write16((y1 >> 8) | (y1 << 8));
+    tft_Write_16(y1);
+
+    addr_row = y0;
+    win_ye   = y1;
+  }
 
   // write to RAM
   DC_C;
 
-  _SPI->write(TFT_RAMWR);
+  tft_Write_8(TFT_RAMWR);
 
   DC_D;
-
-  spi_end();
 }
 
 #endif
@@ -1561,25 +2196,39 @@ inline void TFT_eSPI::setAddrWindow(int32_t x0, int32_t y0, int32_t x1, int32_t
 ** Function name:           drawPixel
 ** Description:             push a single pixel at an arbitrary position
 ***************************************************************************************/
-#ifdef ESP8266
 void TFT_eSPI::drawPixel(uint32_t x, uint32_t y, uint32_t color)
 {
   // Faster range checking, possible because x and y are unsigned
   if ((x >= _width) || (y >= _height)) return;
+
+  spi_begin();
+  writePixel(x, y, color);
+  spi_end();
+}
+
+
+/***************************************************************************************
+** Function name:           writePixel
+** Description:             push a single pixel, for use inside startWrite()/endWrite()
+***************************************************************************************/
+#ifdef ESP8266
+void TFT_eSPI::writePixel(uint32_t x, uint32_t y, uint32_t color)
+{
+  // Faster range checking, possible because x and y are unsigned
+  if ((x >= _width) || (y >= _height)) return;
+#ifdef TFT_DMA
+  if (dmaQueued) dmaWait(); // Queued pixels go to the old window
+#endif
   
 #if defined (ST7735_DRIVER) && (defined (ST7735_GREENTAB) || defined (GREENTAB2))
   x+=colstart;
   y+=rowstart;
 #endif
 
-  spi_begin();
-
-  CS_L;
-
   uint32_t mask = ~((SPIMMOSI << SPILMOSI) | (SPIMMISO << SPILMISO));
   mask = SPI1U1 & mask;
   // No need to send x if it has not changed (speeds things up)
-  if (addr_col != x) {
+  if ((addr_col != x) || (win_xe != (int32_t)x)) {
 
     DC_C;
 
@@ -1598,10 +2247,11 @@ void TFT_eSPI::drawPixel(uint32_t x, uint32_t y, uint32_t color)
     while(SPI1CMD & SPIBUSY) {}
 
     addr_col = x;
+    win_xe   = x;
   }
 
   // No need to send y if it has not changed (speeds things up)
-  if (addr_row != y) {
+  if ((addr_row != y) || (win_ye != (int32_t)y)) {
 
     DC_C;
 
@@ -1620,6 +2270,7 @@ void TFT_eSPI::drawPixel(uint32_t x, uint32_t y, uint32_t color)
     while(SPI1CMD & SPIBUSY) {}
 
     addr_row = y;
+    win_ye   = y;
   }
 
   DC_C;
@@ -1637,72 +2288,66 @@ void TFT_eSPI::drawPixel(uint32_t x, uint32_t y, uint32_t color)
   SPI1W0 = (color >> 8) | (color << 8);
   SPI1CMD |= SPIBUSY;
   while(SPI1CMD & SPIBUSY) {}
-
-  CS_H;
-
-  spi_end();
 }
 
 #else
 
-	void TFT_eSPI::drawPixel(uint32_t x, uint32_t y, uint32_t color)
+void TFT_eSPI::writePixel(uint32_t x, uint32_t y, uint32_t color)
 {
   // Faster range checking, possible because x and y are unsigned
   if ((x >= _width) || (y >= _height)) return;
-  spi_begin();
+#ifdef TFT_DMA
+  if (dmaQueued) dmaWait(); // Queued pixels go to the old window
+#endif
 
 #if defined (ST7735_DRIVER) && (defined (ST7735_GREENTAB) || defined (GREENTAB2))
   x+=colstart;
   y+=rowstart;
 #endif
 
-  CS_L;
-
   // No need to send x if it has not changed (speeds things up)
-  if (addr_col != x) {
+  if ((addr_col != x) || (win_xe != (int32_t)x)) {
 
     DC_C;
 
-    _SPI->write(TFT_CASET);
+    tft_Write_8(TFT_CASET);
 
     DC_D;
 
-    _SPI->write16((x >> 8) | (x << 8));
+    tft_Write_16(x);
 
     // Send same x value again
-    _SPI->write16((x >> 8) | (x << 8));
+    tft_Write_16(x);
 
     addr_col = x;
+    win_xe   = x;
   }
 
   // No need to send y if it has not changed (speeds things up)
-  if (addr_row != y) {
+  if ((addr_row != y) || (win_ye != (int32_t)y)) {
 
     DC_C;
 
-    _SPI->write(TFT_PASET);
+    tft_Write_8(TFT_PASET);
 
     DC_D;
 
-    _SPI->write16((y >> 8) | (y << 8));
+    tft_Write_16(y);
 
     // Send same y value again
-    _SPI->write16((y >> 8) | (y << 8));
+    tft_Write_16(y);
 
     addr_row = y;
+    win_ye   = y;
   }
 
   DC_C;
 
-  _SPI->write(TFT_RAMWR);
+  tft_Write_8(TFT_RAMWR);
 
   DC_D;
 
-  _SPI->write16((color >> 8) | (color << 8));
-
-  CS_H;
-
-  spi_end();
+  tft_Write_16(color);
 }
 
 #endif
@@ -1716,11 +2361,7 @@ void TFT_eSPI::pushColor(uint16_t color)
 {
   spi_begin();
 
-  CS_L;
-
-  _SPI->write16(color);
-
-  CS_H;
+  tft_Write_16(color);
 
   spi_end();
 }
@@ -1734,13 +2375,9 @@ void TFT_eSPI::pushColor(uint16_t color, uint16_t len)
 {
   spi_begin();
 
-  CS_L;
-
   uint8_t colorBin[] = { (uint8_t) (color >> 8), (uint8_t) color };
-  while(len>32) { _SPI->writePattern(&colorBin[0], 2, 32); len-=32;}
-  _SPI->writePattern(&colorBin[0], 2, len);
-
-  CS_H;
+  while(len>32) { tft_Write_Pattern(&colorBin[0], 2, 32); len-=32;}
+  tft_Write_Pattern(&colorBin[0], 2, len);
 
   spi_end();
 }
@@ -1759,11 +2396,7 @@ void TFT_eSPI::pushColors(uint16_t *data, uint8_t len)
 {
   spi_begin();
 
-  CS_L;
-
-  while (len--) _SPI->write16(*(data++));
-
-  CS_H;
+  while (len--) tft_Write_16(*(data++));
 
   spi_end();
 }
@@ -1779,14 +2412,161 @@ void TFT_eSPI::pushColors(uint8_t *data, uint32_t len)
 {
   spi_begin();
 
-  CS_L;
+      while ( len >=64 ) {tft_Write_Pattern(data, 64, 1); data += 64; len -= 64; }
+      if (len) tft_Write_Pattern(data, len, 1);
+
+  spi_end();
+}
+
+
+/***************************************************************************************
+** Function name:           initDMA
+** Description:             Set up background pixel transfers, returns true if available
+***************************************************************************************/
+bool TFT_eSPI::initDMA(void)
+{
+#if defined (TFT_HOST_BACKEND)
 
-      while ( len >=64 ) {_SPI->writePattern(data, 64, 1); data += 64; len -= 64; }
-      if (len) _SPI->writePattern(data, len, 1);
+  dmaEnabled = true;
 
-	  CS_H;
+#elif defined (ESP32) && defined (ESP32_DMA)
 
-  spi_end();
+  if (dmaEnabled) return true;
+
+  spi_bus_config_t buscfg;
+  memset(&buscfg, 0, sizeof(buscfg));
+  buscfg.mosi_io_num     = TFT_MOSI;
+  buscfg.miso_io_num     = TFT_MISO;
+  buscfg.sclk_io_num     = TFT_SCLK;
+  buscfg.quadwp_io_num   = -1;
+  buscfg.quadhd_io_num   = -1;
+  buscfg.max_transfer_sz = TFT_WIDTH * TFT_HEIGHT * 2;
+
+  spi_device_interface_config_t devcfg;
+  memset(&devcfg, 0, sizeof(devcfg));
+  devcfg.mode           = 0;
+  devcfg.clock_speed_hz = SPI_FREQUENCY;
+  devcfg.spics_io_num   = -1; // CS is controlled by the library
+  devcfg.flags          = SPI_DEVICE_NO_DUMMY;
+  devcfg.queue_size     = 2;  // Ping-pong, one transfer active and one queued
+
+  if (spi_bus_initialize(VSPI_HOST, &buscfg, 1) != ESP_OK) return false;
+  if (spi_bus_add_device(VSPI_HOST, &devcfg, &dmaDevice) != ESP_OK) return false;
+
+  dmaEnabled = true;
+
+#endif
+
+  return dmaEnabled;
+}
+
+
+/***************************************************************************************
+** Function name:           pushColorsDMA
+** Description:             push an array of pixels in the background
+***************************************************************************************/
+// Assumes that setWindow() has previously been called
+
+void TFT_eSPI::pushColorsDMA(uint16_t *data, uint32_t len)
+{
+  if (len == 0) return;
+
+  // Without DMA or a session to hold CS low the pixels are sent before returning
+  if (!dmaEnabled || !writeDepth) {
+    pushColors((uint8_t*)data, len << 1);
+    return;
+  }
+
+  dmaQueue((uint8_t*)data, len << 1);
+}
+
+
+/***************************************************************************************
+** Function name:           pushRectDMA
+** Description:             push 565 pixel colours into a defined area in the background
+***************************************************************************************/
+void TFT_eSPI::pushRectDMA(uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint16_t *data)
+{
+  if ((x > _width) || (y > _height) || (w == 0) || (h == 0)) return;
+
+  if (!dmaEnabled || !writeDepth) {
+    pushRect(x, y, w, h, data);
+    return;
+  }
+
+  writeAddrWindow(x, y, x + w - 1, y + h - 1); // Waits for the last pixels to be sent
+
+  dmaQueue((uint8_t*)data, (w * h) << 1);
+}
+
+
+/***************************************************************************************
+** Function name:           dmaWait
+** Description:             wait until all queued pixels have been sent
+***************************************************************************************/
+void TFT_eSPI::dmaWait(void)
+{
+  while (dmaQueued) dmaRetire();
+}
+
+
+/***************************************************************************************
+** Function name:           dmaBusy
+** Description:             return true if pixels are still being sent
+***************************************************************************************/
+bool TFT_eSPI::dmaBusy(void)
+{
+#if defined (TFT_HOST_BACKEND)
+  while (dmaQueued && TFT_Host::dmaDone()) dmaRetire();
+#elif defined (ESP32) && defined (ESP32_DMA)
+  spi_transaction_t *rtrans;
+  while (dmaQueued && (spi_device_get_trans_result(dmaDevice, &rtrans, 0) == ESP_OK)) dmaQueued--;
+#endif
+  return dmaQueued;
+}
+
+
+/***************************************************************************************
+** Function name:           dmaQueue
+** Description:             start a background transfer, returns when the previous one ends
+***************************************************************************************/
+// Only the newest buffer is in use when this returns, so the caller can render into
+// the other one of a pair of buffers while this one is sent
+
+void TFT_eSPI::dmaQueue(const uint8_t *data, uint32_t len)
+{
+#if defined (TFT_HOST_BACKEND)
+  TFT_Host::dmaQueue(data, len);
+#elif defined (ESP32) && defined (ESP32_DMA)
+  spi_transaction_t *trans = &dmaTrans[dmaNext];
+  dmaNext ^= 1;
+  memset(trans, 0, sizeof(spi_transaction_t));
+  trans->tx_buffer = data;
+  trans->length    = len * 8; // Length is in bits
+  spi_device_queue_trans(dmaDevice, trans, portMAX_DELAY);
+#else
+  (void)data; (void)len; // Not reached, initDMA() returns false
+#endif
+  dmaQueued++;
+
+  if (dmaQueued > 1) dmaRetire();
+}
+
+
+/***************************************************************************************
+** Function name:           dmaRetire
+** Description:             wait for the oldest queued transfer to finish
+***************************************************************************************/
+void TFT_eSPI::dmaRetire(void)
+{
+  if (!dmaQueued) return;
+#if defined (TFT_HOST_BACKEND)
+  TFT_Host::dmaComplete();
+#elif defined (ESP32) && defined (ESP32_DMA)
+  spi_transaction_t *rtrans;
+  spi_device_get_trans_result(dmaDevice, &rtrans, portMAX_DELAY);
+#endif
+  dmaQueued--;
 }
 
 
@@ -1797,10 +2577,12 @@ void TFT_eSPI::pushColors(uint8_t *data, uint32_t len)
 // Bresenham's algorithm - thx wikipedia - speed enhanced by Bodmer to use
 // an eficient FastH/V Line draw routine for line segments of 2 pixels or more
 
-#ifdef ESP32
+#ifndef ESP8266
 
 void TFT_eSPI::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color)
 {
+  startWrite();
+
   boolean steep = abs(y1 - y0) > abs(x1 - x0);
   if (steep) {
     swap(x0, y0);
@@ -1826,12 +2608,12 @@ void TFT_eSPI::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t
       err -= dy;
       if (err < 0) {
         err += dx;
-        if (dlen == 1) drawPixel(y0, xs, color);
-        else drawFastVLine(y0, xs, dlen, color);
+        if (dlen == 1) writePixel(y0, xs, color);
+        else writeFastVLine(y0, xs, dlen, color);
         dlen = 0; y0 += ystep; xs = x0 + 1;
       }
     }
-    if (dlen) drawFastVLine(y0, xs, dlen, color);
+    if (dlen) writeFastVLine(y0, xs, dlen, color);
   }
   else
   {
@@ -1840,13 +2622,15 @@ void TFT_eSPI::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t
       err -= dy;
       if (err < 0) {
         err += dx;
-        if (dlen == 1) drawPixel(xs, y0, color);
-        else drawFastHLine(xs, y0, dlen, color);
+        if (dlen == 1) writePixel(xs, y0, color);
+        else writeFastHLine(xs, y0, dlen, color);
         dlen = 0; y0 += ystep; xs = x0 + 1;
       }
     }
-    if (dlen) drawFastHLine(xs, y0, dlen, color);
+    if (dlen) writeFastHLine(xs, y0, dlen, color);
   }
+
+  endWrite();
 }
 
 #else
@@ -1854,8 +2638,6 @@ void TFT_eSPI::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t
 // This is a weeny bit faster
 void TFT_eSPI::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color)
 {
-  spi_begin();
-
   boolean steep = abs(y1 - y0) > abs(x1 - x0);
 
 	if (steep) {
@@ -1897,7 +2679,8 @@ void TFT_eSPI::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t
 
 	  if (x0 > x1) return;
 
-           setAddrWindow(y0, x0, y0, _height);
+           spi_begin();
+           writeAddrWindow(y0, x0, y0, _height);
            SPI1U1 = mask;
 		for (; x0 <= x1; x0++) {
             while(SPI1CMD & SPIBUSY) {}
@@ -1910,7 +2693,7 @@ void TFT_eSPI::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t
 				if ((y0 < 0) || (y0 >= _width)) break;
 				err += dx;
 				while(SPI1CMD & SPIBUSY) {}
-				setAddrWindow(y0, x0+1, y0, _height);
+				writeAddrWindow(y0, x0+1, y0, _height);
 				SPI1U1 = mask;
 			}
 		}
@@ -1930,7 +2713,8 @@ void TFT_eSPI::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t
 
 	  if (x0 > x1) return;
 
-           setAddrWindow(x0, y0, _width, y0);
+           spi_begin();
+           writeAddrWindow(x0, y0, _width, y0);
            SPI1U1 = mask;
 
 		for (; x0 <= x1; x0++) {
@@ -1944,17 +2728,470 @@ void TFT_eSPI::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t
 				if ((y0 < 0) || (y0 >= _height)) break;
 				err += dx;
 				while(SPI1CMD & SPIBUSY) {}
-                     setAddrWindow(x0+1, y0, _width, y0);
+                     writeAddrWindow(x0+1, y0, _width, y0);
 				SPI1U1 = mask;
 			}
 		}
 	}
 
-     while(SPI1CMD & SPIBUSY) {}
-     CS_H;
-  spi_end();
+     while(SPI1CMD & SPIBUSY) {}
+  spi_end();
+}
+#endif
+
+
+/***************************************************************************************
+** Function name:           alphaBlend
+** Description:             blend fgc over bgc, alpha 0 is all bgc and 255 all fgc
+***************************************************************************************/
+// The colours are split so green is in the top half word and red and blue in the bottom
+// half with gaps between them, then the channels are all blended by one multiply of each
+// colour. alpha is rounded to 32 levels.
+uint16_t TFT_eSPI::alphaBlend(uint8_t alpha, uint16_t fgc, uint16_t bgc)
+{
+  uint32_t a  = (alpha + 4) >> 3; // 0 to 32
+  uint32_t fg = (fgc | ((uint32_t)fgc << 16)) & 0x07E0F81F;
+  uint32_t bg = (bgc | ((uint32_t)bgc << 16)) & 0x07E0F81F;
+
+  uint32_t c = ((fg * a + bg * (32 - a)) >> 5) & 0x07E0F81F;
+  return c | (c >> 16);
+}
+
+
+/***************************************************************************************
+** Function name:           blendPair
+** Description:             draw two pixels next to each other blended with the background
+***************************************************************************************/
+// The first pixel at x,y has coverage a0 and the one below it, or to the right if across
+// is true, has coverage a1. bg < 0 reads back the pixels to blend with. A pixel with no
+// coverage is not drawn, two pixels are sent in one window. Must be called between
+// startWrite() and endWrite().
+void TFT_eSPI::blendPair(int32_t x, int32_t y, boolean across, uint8_t a0, uint8_t a1, uint32_t color, int32_t bg)
+{
+  int32_t x1 = x + across, y1 = y + !across;
+
+  // Coverage that alphaBlend() rounds to 0 leaves the pixel as it is
+  boolean p0 = (a0 > 3) && ((uint32_t)x  < _width) && ((uint32_t)y  < _height);
+  boolean p1 = (a1 > 3) && ((uint32_t)x1 < _width) && ((uint32_t)y1 < _height);
+
+  uint16_t c0 = 0, c1 = 0;
+  if (p0) c0 = alphaBlend(a0, color, (bg < 0) ? readPixel(x, y) : bg);
+  if (p1) c1 = alphaBlend(a1, color, (bg < 0) ? readPixel(x1, y1) : bg);
+
+  if (p0 && p1) {
+    setWindow(x, y, x1, y1);
+    pushColor(c0);
+    pushColor(c1);
+  }
+  else if (p0) drawPixel(x, y, c0);
+  else if (p1) drawPixel(x1, y1, c1);
+}
+
+
+/***************************************************************************************
+** Function name:           drawSmoothLine
+** Description:             draw an anti-aliased line blended with the pixels under it
+***************************************************************************************/
+void TFT_eSPI::drawSmoothLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color)
+{
+  smoothLine(x0, y0, x1, y1, color, -1);
+}
+
+
+/***************************************************************************************
+** Function name:           drawSmoothLine
+** Description:             draw an anti-aliased line blended with bgcolor
+***************************************************************************************/
+void TFT_eSPI::drawSmoothLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color, uint32_t bgcolor)
+{
+  smoothLine(x0, y0, x1, y1, color, (uint16_t)bgcolor);
+}
+
+
+/***************************************************************************************
+** Function name:           smoothLine
+** Description:             draw an anti-aliased line, bg < 0 reads back the background
+***************************************************************************************/
+// Xiaolin Wu's algorithm, for each step along the line the two pixels either side of it
+// share the colour by how close the line passes to each. y is kept in 16.16 fixed point.
+void TFT_eSPI::smoothLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color, int32_t bg)
+{
+  boolean steep = abs(y1 - y0) > abs(x1 - x0);
+  if (steep) {
+    swap(x0, y0);
+    swap(x1, y1);
+  }
+
+  if (x0 > x1) {
+    swap(x0, x1);
+    swap(y0, y1);
+  }
+
+  int32_t dx   = x1 - x0;
+  int32_t grad = dx ? ((y1 - y0) << 16) / dx : 0;
+  int32_t y    = (y0 << 16) + 0x80; // Rounded to the coverage step
+
+  startWrite();
+
+  for (; x0 <= x1; x0++, y += grad) {
+    uint8_t a = y >> 8; // Fraction of the way to the next row
+    if (steep) blendPair(y >> 16, x0, true,  255 - a, a, color, bg);
+    else       blendPair(x0, y >> 16, false, 255 - a, a, color, bg);
+  }
+
+  endWrite();
+}
+
+
+/***************************************************************************************
+** Function name:           drawSmoothCircle
+** Description:             draw an anti-aliased circle outline blended with the pixels under it
+***************************************************************************************/
+void TFT_eSPI::drawSmoothCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color)
+{
+  smoothArc(x0, y0, r, 0, 360, color, -1);
+}
+
+
+/***************************************************************************************
+** Function name:           drawSmoothCircle
+** Description:             draw an anti-aliased circle outline blended with bgcolor
+***************************************************************************************/
+void TFT_eSPI::drawSmoothCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color, uint32_t bgcolor)
+{
+  smoothArc(x0, y0, r, 0, 360, color, (uint16_t)bgcolor);
+}
+
+
+/***************************************************************************************
+** Function name:           drawSmoothArc
+** Description:             draw an anti-aliased arc of a circle blended with the pixels under it
+***************************************************************************************/
+void TFT_eSPI::drawSmoothArc(int32_t x0, int32_t y0, int32_t r, int32_t startAngle, int32_t endAngle, uint32_t color)
+{
+  smoothArc(x0, y0, r, startAngle, endAngle, color, -1);
+}
+
+
+/***************************************************************************************
+** Function name:           drawSmoothArc
+** Description:             draw an anti-aliased arc of a circle blended with bgcolor
+***************************************************************************************/
+void TFT_eSPI::drawSmoothArc(int32_t x0, int32_t y0, int32_t r, int32_t startAngle, int32_t endAngle, uint32_t color, uint32_t bgcolor)
+{
+  smoothArc(x0, y0, r, startAngle, endAngle, color, (uint16_t)bgcolor);
+}
+
+
+/***************************************************************************************
+** Function name:           isin, icos
+** Description:             sine and cosine of whole degrees in 2.14 fixed point
+***************************************************************************************/
+// sin() of 0 to 90 degrees times 16384, the other quadrants are mirror images
+static const uint16_t sinTable[91] PROGMEM = {
+      0,   286,   572,   857,  1143,  1428,  1713,  1997,  2280,  2563,
+   2845,  3126,  3406,  3686,  3964,  4240,  4516,  4790,  5063,  5334,
+   5604,  5872,  6138,  6402,  6664,  6924,  7182,  7438,  7692,  7943,
+   8192,  8438,  8682,  8923,  9162,  9397,  9630,  9860, 10087, 10311,
+  10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+  12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+  14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+  15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+  16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+  16384
+};
+
+static int32_t isin(int32_t deg)
+{
+  deg %= 360;
+  if (deg < 0) deg += 360;
+
+  if (deg <=  90) return  pgm_read_word(&sinTable[deg]);
+  if (deg <= 180) return  pgm_read_word(&sinTable[180 - deg]);
+  if (deg <= 270) return -(int32_t)pgm_read_word(&sinTable[deg - 180]);
+  return -(int32_t)pgm_read_word(&sinTable[360 - deg]);
+}
+
+static int32_t icos(int32_t deg)
+{
+  return isin(deg + 90);
+}
+
+
+/***************************************************************************************
+** Function name:           isqrt
+** Description:             integer square root, rounded down
+***************************************************************************************/
+static uint32_t isqrt(uint32_t n)
+{
+  uint32_t root = 0, bit = 1UL << 30;
+
+  while (bit > n) bit >>= 2;
+
+  while (bit) {
+    if (n >= root + bit) {
+      n   -= root + bit;
+      root = (root >> 1) + bit;
+    }
+    else root >>= 1;
+    bit >>= 2;
+  }
+
+  return root;
+}
+
+
+/***************************************************************************************
+** Function name:           inArc
+** Description:             test if the point x,y from the centre is in the arc
+***************************************************************************************/
+// sx,sy and ex,ey point at the start and end of the arc, which runs clockwise from start
+// to end. A cross product >= 0 means the second vector is clockwise of the first (the y
+// axis points down) by up to 180 degrees.
+static boolean inArc(int32_t x, int32_t y, int32_t sx, int32_t sy, int32_t ex, int32_t ey, boolean major)
+{
+  int32_t s = sx * y - sy * x; // Start to point
+  int32_t e = x * ey - y * ex; // Point to end
+
+  if (major) return (s >= 0) || (e >= 0); // Not in the gap from end to start
+  return (s >= 0) && (e >= 0);
+}
+
+
+/***************************************************************************************
+** Function name:           smoothArc
+** Description:             draw an anti-aliased arc, bg < 0 reads back the background
+***************************************************************************************/
+// Angles are in degrees clockwise from 12 o'clock, 0 to 360 is the whole circle. For
+// each column x of an octant the circle passes sqrt(r*r - x*x) from the centre, the
+// two pixels either side of that share the colour. The fraction is worked out from the
+// remainder of the integer square root. The ends of an arc are not anti-aliased.
+void TFT_eSPI::smoothArc(int32_t x0, int32_t y0, int32_t r, int32_t start, int32_t end, uint32_t color, int32_t bg)
+{
+  if (r < 1) return;
+
+  int32_t sweep = end - start;
+  boolean whole = (sweep >= 360) || (sweep <= -360);
+  sweep = ((sweep % 360) + 360) % 360;
+  if (!whole && !sweep) return;
+
+  // Start and end vectors
+  int32_t sx = isin(start), sy = -icos(start);
+  int32_t ex = isin(end),   ey = -icos(end);
+  boolean major = (sweep > 180);
+
+  startWrite();
+
+  for (int32_t x = 0; ; x++) {
+    uint32_t n = r * r - x * x;
+    int32_t  i = isqrt(n);
+    if (x > i) break; // Past 45 degrees, the rest of the octant is the transposed one
+
+    uint8_t a  = ((n - i * i) << 8) / (2 * i + 1); // Coverage of the pixel outside
+    uint8_t a0 = 255 - a;
+
+    // The eight octants, each pair is drawn from the top or left pixel. The points on
+    // the axes (x == 0) and the diagonals (x == i) are not drawn twice.
+    for (uint8_t oct = 0; oct < 8; oct++) {
+      if ((x == 0) && (oct & 1)) continue;   // Mirror of x
+      if ((x == i) && (oct & 4)) a0 = 0;     // The inner pixel is in the other octant
+
+      int32_t px = (oct & 1) ? -x : x;       // Along the octant
+      int32_t py = (oct & 2) ? -i : i;       // Out from the centre
+      if (oct & 4) swap(px, py);
+
+      if (!whole && !inArc(px, py, sx, sy, ex, ey, major)) continue;
+
+      boolean across = oct & 4;
+      if (oct & 2) blendPair(x0 + (across ? px - 1 : px), y0 + (across ? py : py - 1), across, a, a0, color, bg);
+      else         blendPair(x0 + px, y0 + py, across, a0, a, color, bg);
+    }
+  }
+
+  endWrite();
+}
+
+
+/***************************************************************************************
+** Function name:           floorDiv, clipSpan
+** Description:             narrow a span to the x where m * x + c >= 0
+***************************************************************************************/
+// The filled shapes are rows of spans cut by straight edges, each edge is a half plane
+// that limits one end of the span. Integer maths so neighbouring shapes that share an
+// edge neither overlap nor leave a gap.
+static int32_t floorDiv(int32_t a, int32_t b) // b > 0
+{
+  return (a >= 0) ? a / b : -((b - 1 - a) / b);
+}
+
+static void clipSpan(int32_t m, int32_t c, int32_t *lo, int32_t *hi)
+{
+  if (m > 0) {
+    int32_t x = -floorDiv(c, m); // Rounded up
+    if (x > *lo) *lo = x;
+  }
+  else if (m < 0) {
+    int32_t x = floorDiv(c, -m);
+    if (x < *hi) *hi = x;
+  }
+  else if (c < 0) *hi = *lo - 1; // Nothing on this row
+}
+
+
+/***************************************************************************************
+** Function name:           fillArc
+** Description:             fill the part of a ring between two angles
+***************************************************************************************/
+// Each row of the ring is one span, or two either side of the hole, cut by the start
+// and end edges. A pixel is filled if its centre is more than rInner - 0.5 and no more
+// than rOuter + 0.5 from the centre, rInner == rOuter gives a ring 1 pixel wide. For an
+// arc of more than 180 degrees the part of the span after the start edge is drawn, then
+// the part before it that is also before the end edge, so no pixel is drawn twice.
+// Pixels on the start edge are filled and those on the end edge are not, so arcs that
+// meet tile the ring. Only the arc that includes 0 degrees fills the centre pixel.
+void TFT_eSPI::fillArc(int32_t x, int32_t y, int32_t rInner, int32_t rOuter, int32_t startAngle, int32_t endAngle, uint32_t color)
+{
+  if (rInner < 0) rInner = 0;
+  if (rOuter < rInner) return;
+
+  int32_t sweep = endAngle - startAngle;
+  boolean whole = (sweep >= 360) || (sweep <= -360);
+  sweep = ((sweep % 360) + 360) % 360;
+  if (!whole && !sweep) return;
+
+  // Start and end edge directions, the y axis points down
+  int32_t sx = isin(startAngle), sy = -icos(startAngle);
+  int32_t ex = isin(endAngle),   ey = -icos(endAngle);
+  boolean major = (sweep > 180);
+
+  // The centre pixel is on every edge, it is filled if the arc includes 0 degrees
+  boolean centre;
+  if (sweep == 180) centre = (sx < 0) || ((sx == 0) && (sy <= 0));
+  else if (major)   centre = (sx <= 0) || (ex > 0);
+  else              centre = (sx <= 0) && (ex > 0);
+
+  int32_t ro = rOuter * rOuter + rOuter;           // Limits of dx*dx + dy*dy
+  int32_t ri = rInner * rInner - rInner;
+
+  int32_t ys = (y - rOuter < 0) ? -y : -rOuter;    // Rows on the screen
+  int32_t ye = (y + rOuter >= (int32_t)_height) ? _height - 1 - y : rOuter;
+
+  startWrite();
+
+  for (int32_t dy = ys; dy <= ye; dy++) {
+    int32_t xo = isqrt(ro - dy * dy);
+    int32_t h  = ri - dy * dy;
+    int32_t xi = (rInner && (h >= 0)) ? isqrt(h) : -1; // Hole is -xi to xi
+    if (!dy && !rInner && !whole) {
+      xi = 0; // The centre is drawn on its own
+      if (centre) writePixel(x, y, color);
+    }
+
+    for (uint8_t side = 0; side < 2; side++) {
+      int32_t lo = -xo, hi = xo;
+      if (xi >= 0) {
+        if (side) lo = xi + 1;
+        else hi = -xi - 1;
+      }
+      else if (side) break;
+
+      if (whole) {
+        writeFastHLine(x + lo, y + dy, hi - lo + 1, color);
+        continue;
+      }
+
+      // The start edge, then the end edge or for a major arc the rest of the span
+      int32_t l = lo, r = hi;
+      clipSpan(-sy, sx * dy, &l, &r);
+      if (major) {
+        if (l <= r) writeFastHLine(x + l, y + dy, r - l + 1, color);
+        l = lo; r = hi;
+        clipSpan(sy, -sx * dy - 1, &l, &r); // Before the start edge
+      }
+      if (sweep == 180) {
+        // The end edge continues the start edge through the centre, only leave out the
+        // pixels on it that are on the end side of the centre
+        if (sy) {
+          int32_t px = (sx * dy) / sy;
+          if ((px * sy == sx * dy) && (sx * px + sy * dy < 0)) {
+            if (px == l) l++;
+            else if (px == r) r--;
+          }
+        }
+        else if (!dy) clipSpan(sx, 0, &l, &r);
+      }
+      else clipSpan(ey, -ex * dy - 1, &l, &r); // Pixels on the end edge are left for the next arc
+      if (l <= r) writeFastHLine(x + l, y + dy, r - l + 1, color);
+    }
+  }
+
+  endWrite();
+}
+
+
+/***************************************************************************************
+** Function name:           drawWideLine
+** Description:             draw a line width pixels wide with round or square ends
+***************************************************************************************/
+// Each row is one span, the line is a rectangle cut by four straight edges and with
+// round ends two circles of diameter width are added. The sides are width / 2 either
+// side of the line between the pixel centres, with butt ends the line stops at x0,y0
+// and x1,y1. A line of zero length is drawn as a circle.
+void TFT_eSPI::drawWideLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t width, uint32_t color, boolean roundEnds)
+{
+  if (width < 1) return;
+
+  int32_t dx = x1 - x0, dy = y1 - y0;
+  int32_t len2 = dx * dx + dy * dy;
+  int32_t len16 = isqrt(len2);      // Length in 12.4 fixed point, the 4 fraction bits
+  int32_t rem = len2 - len16 * len16; // are found without overflow for long lines
+  int32_t frac = 15;
+  while (32 * len16 * frac + frac * frac > 256 * rem) frac--;
+  len16 = 16 * len16 + frac;
+  int32_t side = width * len16;     // Distance of the sides times 32 * length
+  int32_t r2 = width * width;       // Square of the end circle diameter
+  if (!len2) roundEnds = true;
+
+  int32_t ys = ((y0 < y1) ? y0 : y1) - (width >> 1) - 1;
+  int32_t ye = ((y0 > y1) ? y0 : y1) + (width >> 1) + 1;
+  if (ys < 0) ys = 0;
+  if (ye >= (int32_t)_height) ye = _height - 1;
+
+  startWrite();
+
+  for (int32_t y = ys; y <= ye; y++) {
+    int32_t qy = y - y0;           // Row from the start point
+    int32_t lo = 0x7FFF, hi = -0x7FFF;
+
+    if (len2) { // Between the ends and the sides, relative to x0
+      int32_t l = -0x7FFF, r = 0x7FFF;
+      clipSpan( dx,  dy * qy, &l, &r);
+      clipSpan(-dx,  len2 - dy * qy, &l, &r);
+      clipSpan(-32 * dy,  32 * dx * qy + side - 1, &l, &r);
+      clipSpan( 32 * dy, -32 * dx * qy + side, &l, &r);
+      if (l <= r) { lo = x0 + l; hi = x0 + r; }
+    }
+
+    if (roundEnds) { // The end circles
+      int32_t h = r2 - 4 * qy * qy;
+      if (h >= 0) {
+        int32_t w = isqrt(h >> 2);
+        if (x0 - w < lo) lo = x0 - w;
+        if (x0 + w > hi) hi = x0 + w;
+      }
+      h = r2 - 4 * (y - y1) * (y - y1);
+      if (h >= 0) {
+        int32_t w = isqrt(h >> 2);
+        if (x1 - w < lo) lo = x1 - w;
+        if (x1 + w > hi) hi = x1 + w;
+      }
+    }
+
+    if (lo <= hi) writeFastHLine(lo, y, hi - lo + 1, color);
+  }
+
+  endWrite();
 }
-#endif
 
 
 /***************************************************************************************
@@ -1963,20 +3200,27 @@ void TFT_eSPI::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t
 ***************************************************************************************/
 void TFT_eSPI::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color)
 {
-  // Rudimentary clipping
-  if ((x >= _width) || (y >= _height) || (h < 1)) return;
-  if ((y + h - 1) >= _height) h = _height - y;
-
   spi_begin();
+  writeFastVLine(x, y, h, color);
+  spi_end();
+}
 
-  setAddrWindow(x, y, x, y + h - 1);
 
-  uint8_t colorBin[] = { (uint8_t) (color >> 8), (uint8_t) color};
-  _SPI->writePattern(&colorBin[0], 2, h);
+/***************************************************************************************
+** Function name:           writeFastVLine
+** Description:             draw a vertical line, for use inside startWrite()/endWrite()
+***************************************************************************************/
+void TFT_eSPI::writeFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color)
+{
+  // Clip to the screen
+  if (y < 0) { h += y; y = 0; }
+  if ((x < 0) || (x >= (int32_t)_width) || (y >= (int32_t)_height) || (h < 1)) return;
+  if ((y + h - 1) >= (int32_t)_height) h = _height - y;
 
-  CS_H;
+  writeAddrWindow(x, y, x, y + h - 1);
 
-  spi_end();
+  uint8_t colorBin[] = { (uint8_t) (color >> 8), (uint8_t) color};
+  tft_Write_Pattern(&colorBin[0], 2, h);
 }
 
 //Done! Total = 1028742
@@ -1987,20 +3231,27 @@ void TFT_eSPI::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color)
 ***************************************************************************************/
 void TFT_eSPI::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color)
 {
-  // Rudimentary clipping
-  if ((x >= _width) || (y >= _height) || (w < 1)) return;
-  if ((x + w - 1) >= _width)  w = _width - x;
-
   spi_begin();
+  writeFastHLine(x, y, w, color);
+  spi_end();
+}
 
-  setAddrWindow(x, y, x + w - 1, y);
 
-  uint8_t colorBin[] = { (uint8_t) (color >> 8), (uint8_t) color};
-  _SPI->writePattern(&colorBin[0], 2, w);
+/***************************************************************************************
+** Function name:           writeFastHLine
+** Description:             draw a horizontal line, for use inside startWrite()/endWrite()
+***************************************************************************************/
+void TFT_eSPI::writeFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color)
+{
+  // Clip to the screen
+  if (x < 0) { w += x; x = 0; }
+  if ((y < 0) || (x >= (int32_t)_width) || (y >= (int32_t)_height) || (w < 1)) return;
+  if ((x + w - 1) >= (int32_t)_width)  w = _width - x;
 
-  CS_H;
+  writeAddrWindow(x, y, x + w - 1, y);
 
-  spi_end();
+  uint8_t colorBin[] = { (uint8_t) (color >> 8), (uint8_t) color};
+  tft_Write_Pattern(&colorBin[0], 2, w);
 }
 
 
@@ -2010,21 +3261,30 @@ void TFT_eSPI::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color)
 ***************************************************************************************/
 void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
 {
-  // rudimentary clipping (drawChar w/big text requires this)
-  if ((x > _width) || (y > _height) || (w < 1) || (h < 1)) return;
-  if ((x + w - 1) > _width)  w = _width  - x;
-  if ((y + h - 1) > _height) h = _height - y;
-
   spi_begin();
-  setAddrWindow(x, y, x + w - 1, y + h - 1);
+  writeFillRect(x, y, w, h, color);
+  spi_end();
+}
 
-  uint8_t colorBin[] = { (uint8_t) (color >> 8), (uint8_t) color};
-  uint32_t n = (uint32_t)w * (uint32_t)h;
-  _SPI->writePattern(&colorBin[0], 2, n);
 
-  CS_H;
+/***************************************************************************************
+** Function name:           writeFillRect
+** Description:             draw a filled rectangle, for use inside startWrite()/endWrite()
+***************************************************************************************/
+void TFT_eSPI::writeFillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+  // Clip to the screen (drawChar w/big text requires this)
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  if ((x >= (int32_t)_width) || (y >= (int32_t)_height) || (w < 1) || (h < 1)) return;
+  if ((x + w - 1) >= (int32_t)_width)  w = _width  - x;
+  if ((y + h - 1) >= (int32_t)_height) h = _height - y;
 
-  spi_end();
+  writeAddrWindow(x, y, x + w - 1, y + h - 1);
+
+  uint8_t colorBin[] = { (uint8_t) (color >> 8), (uint8_t) color};
+  uint32_t n = (uint32_t)w * (uint32_t)h;
+  tft_Write_Pattern(&colorBin[0], 2, n);
 }
 
 
@@ -2044,11 +3304,11 @@ uint16_t TFT_eSPI::color565(uint8_t r, uint8_t g, uint8_t b)
 ***************************************************************************************/
 void TFT_eSPI::invertDisplay(boolean i)
 {
-  spi_begin();
+  startWrite();
   // Send the command twice as otherwise it does not always work!
   writecommand(i ? TFT_INVON : TFT_INVOFF);
   writecommand(i ? TFT_INVON : TFT_INVOFF);
-  spi_end();
+  endWrite();
 }
 
 
@@ -2060,9 +3320,16 @@ size_t TFT_eSPI::write(uint8_t utf8)
 {
   if (utf8 == '\r') return 1;
 
-  uint8_t uniCode = utf8;        // Work with a copy
+  uint16_t uniCode = utf8;       // Work with a copy
   if (utf8 == '\n') uniCode+=22; // Make it a valid space character to stop errors
 
+#ifdef LOAD_UNICODE
+  if (gfxFont && (utf8 != '\n')) {
+    uniCode = decodeUTF8(utf8);
+    if (!uniCode) return 1; // Part of a multi-byte character
+  }
+#endif
+
   uint16_t width = 0;
   uint16_t height = 0;
 
@@ -2123,7 +3390,7 @@ size_t TFT_eSPI::write(uint8_t utf8)
   }
   else
   {
-    if (textwrap && (cursor_x + width * textsize >= _width))
+    if (textwrap && (cursor_x + width * textsize >= (int32_t)_width))
     {
       cursor_y += height;
       cursor_x = 0;
@@ -2141,17 +3408,20 @@ size_t TFT_eSPI::write(uint8_t utf8)
       cursor_x  = 0;
       cursor_y += (int16_t)textsize *
                   (uint8_t)pgm_read_byte(&gfxFont->yAdvance);
+      kernLast  = 0;
     } else if(uniCode != '\r') {
-	  if (uniCode > (uint8_t)pgm_read_byte(&gfxFont->last)) uniCode = pgm_read_byte(&gfxFont->first);
+      int32_t gi = glyphIndex(uniCode);
+
+      if(gi >= 0) {
+        if (kernPairs && kernLast) cursor_x += kerning(kernLast, uniCode) * (int16_t)textsize;
+        kernLast = uniCode;
 
-      if(uniCode >= pgm_read_byte(&gfxFont->first)) {
-        uint8_t   c2    = uniCode - pgm_read_byte(&gfxFont->first);
-        GFXglyph *glyph = &(((GFXglyph *)pgm_read_dword(&gfxFont->glyph))[c2]);
+        GFXglyph *glyph = &(((GFXglyph *)pgm_read_dword(&gfxFont->glyph))[gi]);
         uint8_t   w     = pgm_read_byte(&glyph->width),
                   h     = pgm_read_byte(&glyph->height);
         if((w > 0) && (h > 0)) { // Is there an associated bitmap?
           int16_t xo = (int8_t)pgm_read_byte(&glyph->xOffset);
-          if(textwrap && ((cursor_x + textsize * (xo + w)) >= _width)) {
+          if(textwrap && ((cursor_x + textsize * (xo + w)) >= (int32_t)_width)) {
             // Drawing character would go off right edge; wrap to new line
             cursor_x  = 0;
             cursor_y += (int16_t)textsize *
@@ -2207,12 +3477,11 @@ int16_t TFT_eSPI::drawChar(unsigned int uniCode, int x, int y, int font)
       }
       else
       {
-		if (uniCode > pgm_read_byte(&gfxFont->last)) uniCode = pgm_read_byte(&gfxFont->first);
+        int32_t gi = glyphIndex(uniCode);
 
-        if(uniCode >= pgm_read_byte(&gfxFont->first))
+        if(gi >= 0)
         {
-          uint8_t   c2    = uniCode - pgm_read_byte(&gfxFont->first);
-          GFXglyph *glyph = &(((GFXglyph *)pgm_read_dword(&gfxFont->glyph))[c2]);
+          GFXglyph *glyph = &(((GFXglyph *)pgm_read_dword(&gfxFont->glyph))[gi]);
           return pgm_read_byte(&glyph->xAdvance) * textsize;
         }
         else
@@ -2225,7 +3494,7 @@ int16_t TFT_eSPI::drawChar(unsigned int uniCode, int x, int y, int font)
 
   int width  = 0;
   int height = 0;
-  uint32_t flash_address = 0;
+  uintptr_t flash_address = 0;
   uniCode -= 32;
 
 #ifdef LOAD_FONT2
@@ -2264,11 +3533,47 @@ int16_t TFT_eSPI::drawChar(unsigned int uniCode, int x, int y, int font)
     w = w / 8;
     if (x + width * textsize >= (int16_t)_width) return width * textsize ;
 
-    if (textcolor == textbgcolor || textsize != 1) {
+    if ((textcolor != textbgcolor) && (textsize > 1) && (x >= 0) && (y >= 0) &&
+        (y + height * textsize <= (int32_t)_height)) {
+      // Opaque and scaled, send the whole character block in one window. Each bitmap
+      // row is sent textsize times as runs of the text and background colours, found
+      // with a leading bit count and stretched by textsize. setWindow() and pushColor()
+      // are used so a sprite draws the character in its RAM.
+      uint8_t ts = textsize;
+
+      startWrite();
+      setWindow(x, y, x + width * ts - 1, y + height * ts - 1);
+
+      for (int i = 0; i < height; i++)
+      {
+        // Row bits with the first pixel in bit 31, the font is at most 16 pixels wide
+        uint32_t bits = 0;
+        for (int k = 0; k < w; k++) bits |= (uint32_t)pgm_read_byte(flash_address + w * i + k) << (24 - 8 * k);
+
+        for (uint8_t rep = 0; rep < ts; rep++) {
+          uint32_t row = bits;
+          int px = 0;
+          while (px < width) {
+            boolean fg = row & 0x80000000;
+            int run = fg ? __builtin_clz(~row) : (row ? __builtin_clz(row) : 32);
+            if (run > width - px) run = width - px;
+            row <<= run;
+            px += run;
+
+            pushColor(fg ? textcolor : textbgcolor, run * ts);
+          }
+        }
+      }
+
+      endWrite();
+    }
+    else if (textcolor == textbgcolor || textsize != 1) {
+
+      startWrite();
 
       for (int i = 0; i < height; i++)
       {
-        if (textcolor != textbgcolor) fillRect(x, pY, width * textsize, textsize, textbgcolor);
+        if (textcolor != textbgcolor) writeFillRect(x, pY, width * textsize, textsize, textbgcolor);
 
         for (int k = 0; k < w; k++)
         {
@@ -2276,36 +3581,38 @@ int16_t TFT_eSPI::drawChar(unsigned int uniCode, int x, int y, int font)
           if (line) {
             if (textsize == 1) {
               pX = x + k * 8;
-              if (line & 0x80) drawPixel(pX, pY, textcolor);
-              if (line & 0x40) drawPixel(pX + 1, pY, textcolor);
-              if (line & 0x20) drawPixel(pX + 2, pY, textcolor);
-              if (line & 0x10) drawPixel(pX + 3, pY, textcolor);
-              if (line & 0x08) drawPixel(pX + 4, pY, textcolor);
-              if (line & 0x04) drawPixel(pX + 5, pY, textcolor);
-              if (line & 0x02) drawPixel(pX + 6, pY, textcolor);
-              if (line & 0x01) drawPixel(pX + 7, pY, textcolor);
+              if (line & 0x80) writePixel(pX, pY, textcolor);
+              if (line & 0x40) writePixel(pX + 1, pY, textcolor);
+              if (line & 0x20) writePixel(pX + 2, pY, textcolor);
+              if (line & 0x10) writePixel(pX + 3, pY, textcolor);
+              if (line & 0x08) writePixel(pX + 4, pY, textcolor);
+              if (line & 0x04) writePixel(pX + 5, pY, textcolor);
+              if (line & 0x02) writePixel(pX + 6, pY, textcolor);
+              if (line & 0x01) writePixel(pX + 7, pY, textcolor);
             }
             else {
               pX = x + k * 8 * textsize;
-              if (line & 0x80) fillRect(pX, pY, textsize, textsize, textcolor);
-              if (line & 0x40) fillRect(pX + textsize, pY, textsize, textsize, textcolor);
-              if (line & 0x20) fillRect(pX + 2 * textsize, pY, textsize, textsize, textcolor);
-              if (line & 0x10) fillRect(pX + 3 * textsize, pY, textsize, textsize, textcolor);
-              if (line & 0x08) fillRect(pX + 4 * textsize, pY, textsize, textsize, textcolor);
-              if (line & 0x04) fillRect(pX + 5 * textsize, pY, textsize, textsize, textcolor);
-              if (line & 0x02) fillRect(pX + 6 * textsize, pY, textsize, textsize, textcolor);
-              if (line & 0x01) fillRect(pX + 7 * textsize, pY, textsize, textsize, textcolor);
+              if (line & 0x80) writeFillRect(pX, pY, textsize, textsize, textcolor);
+              if (line & 0x40) writeFillRect(pX + textsize, pY, textsize, textsize, textcolor);
+              if (line & 0x20) writeFillRect(pX + 2 * textsize, pY, textsize, textsize, textcolor);
+              if (line & 0x10) writeFillRect(pX + 3 * textsize, pY, textsize, textsize, textcolor);
+              if (line & 0x08) writeFillRect(pX + 4 * textsize, pY, textsize, textsize, textcolor);
+              if (line & 0x04) writeFillRect(pX + 5 * textsize, pY, textsize, textsize, textcolor);
+              if (line & 0x02) writeFillRect(pX + 6 * textsize, pY, textsize, textsize, textcolor);
+              if (line & 0x01) writeFillRect(pX + 7 * textsize, pY, textsize, textsize, textcolor);
             }
           }
         }
         pY += textsize;
       }
+
+      endWrite();
     }
     else
       // Faster drawing of characters and background using block write
     {
       spi_begin();
-      setAddrWindow(x, y, (x + w * 8) - 1, y + height - 1);
+      writeAddrWindow(x, y, (x + w * 8) - 1, y + height - 1);
 
       byte mask;
       for (int i = 0; i < height; i++)
@@ -2317,10 +3624,10 @@ int16_t TFT_eSPI::drawChar(unsigned int uniCode, int x, int y, int font)
           mask = 0x80;
           while (mask) {
             if (line & mask) {
-              _SPI->write16(textcolor);
+              tft_Write_16(textcolor);
             }
             else {
-              _SPI->write16(textbgcolor);
+              tft_Write_16(textbgcolor);
             }
             mask = mask >> 1;
           }
@@ -2328,7 +3635,6 @@ int16_t TFT_eSPI::drawChar(unsigned int uniCode, int x, int y, int font)
         pY += textsize;
       }
 
-      CS_H;
       spi_end();
     }
   }
@@ -2341,70 +3647,81 @@ int16_t TFT_eSPI::drawChar(unsigned int uniCode, int x, int y, int font)
 #ifdef LOAD_RLE  //674 bytes of code
   // Font is not 2 and hence is RLE encoded
   {
-    spi_begin();
+    startWrite();
 
     w *= height; // Now w is total number of pixels in the character
     if ((textsize != 1) || (textcolor == textbgcolor)) {
-      if (textcolor != textbgcolor) fillRect(x, pY, width * textsize, textsize * height, textbgcolor);
-      int px = 0, py = pY; // To hold character block start and end column and row values
-      int pc = 0; // Pixel count
-      byte np = textsize * textsize; // Number of pixels in a drawn pixel
-
-      byte tnp = 0; // Temporary copy of np for while loop
-      byte ts = textsize - 1; // Temporary copy of textsize
-      // 16 bit pixel count so maximum font size is equivalent to 180x180 pixels in area
-      // w is total number of pixels to plot to fill character block
-      while (pc < w)
-      {
-        line = pgm_read_byte(flash_address);
-        flash_address++; // 20 bytes smaller by incrementing here
-        if (line & 0x80) {
-          line &= 0x7F;
-          line++;
-          if (ts) {
-            px = x + textsize * (pc % width); // Keep these px and py calculations outside the loop as they are slow
-            py = y + textsize * (pc / width);
-          }
-          else {
-            px = x + pc % width; // Keep these px and py calculations outside the loop as they are slow
-            py = y + pc / width;
-          }
-          while (line--) { // In this case the while(line--) is faster
-            pc++; // This is faster than putting pc+=line before while()?
-            setAddrWindow(px, py, px + ts, py + ts);
-
-            if (ts) {
-              tnp = np;
-              while (tnp--) {
-                _SPI->write16(textcolor);
+      // Each RLE byte is a run of up to 128 foreground (bit 7 set) or background pixels.
+      // The runs are split at the end of each character row so they can be drawn as
+      // scaled horizontal spans.
+      boolean fillbg = (textcolor != textbgcolor);
+      uint8_t ts = textsize;
+      uint8_t left = 0;     // Pixels left in the current run
+      boolean fg = false;   // Current run is foreground
+
+      if (fillbg && (x >= 0) && (y >= 0) && (x + width * ts <= (int32_t)_width) && (y + height * ts <= (int32_t)_height)) {
+        // Opaque and on screen, send the whole character block in one window. Each
+        // character row is decoded textsize times, the runs are stretched by textsize.
+        uint8_t textcolorBin[] = { (uint8_t) (textcolor >> 8), (uint8_t) textcolor };
+        uint8_t textbgcolorBin[] = { (uint8_t) (textbgcolor >> 8), (uint8_t) textbgcolor };
+
+        writeAddrWindow(x, y, x + width * ts - 1, y + height * ts - 1);
+
+        for (int row = 0; row < height; row++) {
+          // Decoder state at the start of the row
+          uintptr_t rowAddress = flash_address;
+          uint8_t   rowLeft = left;
+          boolean   rowFg   = fg;
+
+          for (uint8_t rep = 0; rep < ts; rep++) {
+            flash_address = rowAddress; left = rowLeft; fg = rowFg;
+            int px = 0;
+            while (px < width) {
+              if (!left) {
+                line = pgm_read_byte(flash_address++);
+                fg   = line & 0x80;
+                left = (line & 0x7F) + 1;
               }
-            }
-            else {
-              _SPI->write16(textcolor);
-            }
-            px += textsize;
-
-            if (px >= (x + width * textsize))
-            {
-              px = x;
-              py += textsize;
+              int run = width - px;
+              if (run > left) run = left;
+              left -= run;
+              px   += run;
+
+              uint32_t n = run * ts;
+              uint8_t *color = fg ? textcolorBin : textbgcolorBin;
+              while (n > 32) { tft_Write_Pattern(color, 2, 32); n -= 32; }
+              tft_Write_Pattern(color, 2, n);
             }
           }
         }
-        else {
-          line++;
-          pc += line;
+      }
+      else {
+        // Draw each run as one filled rectangle, textsize high, background runs are
+        // only drawn if the background is filled. writeFillRect() clips to the screen.
+        int px = 0, py = 0;
+        int pc = 0; // Pixel count
+        while (pc < w)
+        {
+          line = pgm_read_byte(flash_address++);
+          fg   = line & 0x80;
+          int len = (line & 0x7F) + 1;
+          pc += len;
+
+          while (len > 0) {
+            int run = width - px;
+            if (run > len) run = len;
+            if (fg || fillbg) writeFillRect(x + px * ts, y + py * ts, run * ts, ts, fg ? textcolor : textbgcolor);
+            len -= run;
+            px  += run;
+            if (px >= width) { px = 0; py++; }
+          }
         }
       }
-
-      CS_H;
-      spi_end();
     }
     else // Text colour != background && textsize = 1
          // so use faster drawing of characters and background using block write
     {
-      spi_begin();
-      setAddrWindow(x, y, x + width - 1, y + height - 1);
+      writeAddrWindow(x, y, x + width - 1, y + height - 1);
 
       uint8_t textcolorBin[] = { (uint8_t) (textcolor >> 8), (uint8_t) textcolor };
       uint8_t textbgcolorBin[] = { (uint8_t) (textbgcolor >> 8), (uint8_t) textbgcolor };
@@ -2416,18 +3733,18 @@ int16_t TFT_eSPI::drawChar(unsigned int uniCode, int x, int y, int font)
         if (line & 0x80) {
           line &= 0x7F;
           line++; w -= line;
-          while(line>32) { _SPI->writePattern(&textcolorBin[0], 2, 32); line-=32;}
-          _SPI->writePattern(&textcolorBin[0], 2, line);
+          while(line>32) { tft_Write_Pattern(&textcolorBin[0], 2, 32); line-=32;}
+          tft_Write_Pattern(&textcolorBin[0], 2, line);
         }
         else {
           line++; w -= line;
-          while(line>32) { _SPI->writePattern(&textbgcolorBin[0], 2, 32); line-=32;}
-          _SPI->writePattern(&textbgcolorBin[0], 2, line);
+          while(line>32) { tft_Write_Pattern(&textbgcolorBin[0], 2, 32); line-=32;}
+          tft_Write_Pattern(&textbgcolorBin[0], 2, line);
         }
       }
-      CS_H;
-      spi_end();
     }
+
+    endWrite();
   }
   // End of RLE font rendering
 #endif
@@ -2466,9 +3783,21 @@ int16_t TFT_eSPI::drawString(const char *string, int poX, int poY, int font)
 {
   int16_t sumX = 0;
   uint8_t padding = 1, baseline = 0;
-  uint16_t cwidth = textWidth(string, font); // Find the pixel width of the string in the font
+  uint16_t cwidth;
   uint16_t cheight = 0;
 
+#ifdef LOAD_GFXFF
+  // A free font string is laid out once, the glyph positions found while measuring it
+  // are then used to draw it. A string of more than TFT_LAYOUT_GLYPHS glyphs is drawn
+  // a character at a time over its background.
+  boolean  freeFont = (font == 1) && (gfxFont);
+  uint16_t glyphs = 0;
+  TFT_GlyphPos pos[TFT_LAYOUT_GLYPHS + 1];
+  if (freeFont) cwidth = layoutString(string, pos, &glyphs, TFT_LAYOUT_GLYPHS) * textsize;
+  else
+#endif
+  cwidth = textWidth(string, font); // Find the pixel width of the string in the font
+
 #ifdef LOAD_GFXFF
   if (font == 1) {
     if(gfxFont) {
@@ -2548,21 +3877,57 @@ int16_t TFT_eSPI::drawString(const char *string, int poX, int poY, int font)
     }
     // Check coordinates are OK, adjust if not
     if (poX < 0) poX = 0;
-    if (poX+cwidth>_width)   poX = _width - cwidth;
+    if (poX+cwidth>(int32_t)_width)   poX = _width - cwidth;
     if (poY < 0) poY = 0;
-    if (poY+cheight-baseline>_height) poY = _height - cheight;
+    if (poY+cheight-baseline>(int32_t)_height) poY = _height - cheight;
   }
 
+  startWrite(); // Characters and padding are sent in one transaction
+
+  boolean drawn = false; // Set if the characters have been drawn with the background
+
 #ifdef LOAD_GFXFF
   if ((font == 1) && (gfxFont) && (textcolor!=textbgcolor))
     {
       cheight = (glyph_ab + glyph_bb) * textsize;
-      fillRect(poX, poY - glyph_ab * textsize, cwidth, cheight, textbgcolor);
+      if (glyphs > TFT_LAYOUT_GLYPHS) sumX = -1; // Not laid out
+      else if (smoothFont) sumX = drawSmoothString(pos, glyphs, poX, poY, cwidth);
+      else sumX = drawFreeFontOpaque(pos, glyphs, poX, poY, cwidth);
+      if (sumX >= 0) drawn = true;
+      else { // Not enough RAM or too long, fill the background and draw the characters over it
+        sumX = 0;
+        writeFillRect(poX, poY - glyph_ab * textsize, cwidth, cheight, textbgcolor);
+      }
       padding -=100;
     }
 #endif
 
-  while (*string) sumX += drawChar(*(string++), poX+sumX, poY, font);
+#ifdef LOAD_GFXFF
+  if (!drawn && freeFont) {
+    if (glyphs <= TFT_LAYOUT_GLYPHS) {
+      for (uint16_t i = 0; i < glyphs; i++)
+        drawChar(poX + pos[i].x * textsize, poY, pos[i].code, textcolor, textbgcolor, textsize);
+      sumX = pos[glyphs].x * textsize;
+    }
+    else { // The glyphs are found again as they are drawn, as layoutString() does
+      int32_t  x = 0;
+      uint16_t last = 0;
+      while (*string) {
+        uint16_t c = nextChar(&string);
+        int16_t  adv, ink0, ink1;
+        if (!charMetrics(c, 1, &adv, &ink0, &ink1)) continue; // No glyph
+        if (kernPairs && last) x += kerning(last, c);
+        last = c;
+        drawChar(poX + x * textsize, poY, c, textcolor, textbgcolor, textsize);
+        x += adv;
+      }
+      sumX = x * textsize;
+    }
+    drawn = true;
+  }
+#endif
+
+  if (!drawn) while (*string) sumX += drawChar(*(string++), poX+sumX, poY, font);
 
 //vvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvv DEBUG vvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvv
 // Switch on debugging for the padding areas
@@ -2582,17 +3947,17 @@ int16_t TFT_eSPI::drawString(const char *string, int poX, int poY, int font)
 #endif
     switch(padding) {
       case 1:
-        fillRect(padXc,poY,padX-cwidth,cheight, textbgcolor);
+        writeFillRect(padXc,poY,padX-cwidth,cheight, textbgcolor);
         break;
       case 2:
-        fillRect(padXc,poY,(padX-cwidth)>>1,cheight, textbgcolor);
+        writeFillRect(padXc,poY,(padX-cwidth)>>1,cheight, textbgcolor);
         padXc = (padX-cwidth)>>1;
         if (padXc>poX) padXc = poX;
-        fillRect(poX - padXc,poY,(padX-cwidth)>>1,cheight, textbgcolor);
+        writeFillRect(poX - padXc,poY,(padX-cwidth)>>1,cheight, textbgcolor);
         break;
       case 3:
         if (padXc>padX) padXc = padX;
-        fillRect(poX + cwidth - padXc,poY,padXc-cwidth,cheight, textbgcolor);
+        writeFillRect(poX + cwidth - padXc,poY,padXc-cwidth,cheight, textbgcolor);
         break;
     }
   }
@@ -2630,6 +3995,7 @@ int16_t TFT_eSPI::drawString(const char *string, int poX, int poY, int font)
 #endif
 //^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ DEBUG ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
 
+  endWrite();
 
 return sumX;
 }
@@ -2701,19 +4067,12 @@ int16_t TFT_eSPI::drawNumber(long long_num, int poX, int poY, int font)
 
 
 /***************************************************************************************
-** Function name:           drawFloat
-** Descriptions:            drawFloat, prints 7 non zero digits maximum
+** Function name:           floatString
+** Descriptions:            format a float, 7 non zero digits maximum
 ***************************************************************************************/
-// Assemble and print a string, this permits alignment relative to a datum
-// looks complicated but much more compact and actually faster than using print class
-int16_t TFT_eSPI::drawFloat(float floatNumber, int dp, int poX, int poY)
-{
-	return drawFloat(floatNumber, dp, poX, poY, textfont);
-}
-
-int16_t TFT_eSPI::drawFloat(float floatNumber, int dp, int poX, int poY, int font)
+// str needs room for 14 characters, "..." is put there if the number is too big
+static void floatString(char *str, float floatNumber, int dp)
 {
-  char str[14];               // Array to contain decimal string
   uint8_t ptr = 0;            // Initialise pointer for array
   int8_t  digits = 1;         // Count the digits to avoid array overflow
   float rounding = 0.5;       // Round up down delta
@@ -2733,10 +4092,10 @@ int16_t TFT_eSPI::drawFloat(float floatNumber, int dp, int poX, int poY, int fon
 
   floatNumber += rounding; // Round up or down
 
-  // For error put ... in string and return (all TFT_eSPI library fonts contain . character)
+  // For error put ... in string (all TFT_eSPI library fonts contain . character)
   if (floatNumber >= 2147483647) {
     strcpy(str, "...");
-    return drawString(str, poX, poY, font);
+    return;
   }
   // No chance of overflow from here on
 
@@ -2769,12 +4128,140 @@ int16_t TFT_eSPI::drawFloat(float floatNumber, int dp, int poX, int poY, int fon
     ptr++; digits++;         // Increment pointer and digits count
     floatNumber -= temp;     // Remove that digit
   }
+}
+
+
+/***************************************************************************************
+** Function name:           drawFloat
+** Descriptions:            drawFloat, prints 7 non zero digits maximum
+***************************************************************************************/
+// Assemble and print a string, this permits alignment relative to a datum
+// looks complicated but much more compact and actually faster than using print class
+int16_t TFT_eSPI::drawFloat(float floatNumber, int dp, int poX, int poY)
+{
+	return drawFloat(floatNumber, dp, poX, poY, textfont);
+}
+
+int16_t TFT_eSPI::drawFloat(float floatNumber, int dp, int poX, int poY, int font)
+{
+  char str[14];               // Array to contain decimal string
+
+  floatString(str, floatNumber, dp);
 
   // Finally we can plot the string and return pixel length
   return drawString(str, poX, poY, font);
 }
 
 
+#ifdef LOAD_GFXFF
+/***************************************************************************************
+** Function name:           drawFreeFontOpaque
+** Description:             draw a free font string and its background in one window
+***************************************************************************************/
+// pos holds the count glyphs of the string from layoutString(), x,y is the left end of
+// the baseline and w the pixel width of the string. The glyphs
+// are set in a 1 bit mask of the background box at textsize 1, overlapping glyphs merge
+// there, then the box is sent once as runs of the text and background colours. Glyph
+// pixels outside the box (e.g. a descender below that of 'y') are drawn over it after.
+// Returns the x advance or -1 if there is not enough RAM for the mask.
+int16_t TFT_eSPI::drawFreeFontOpaque(const TFT_GlyphPos *pos, uint16_t count, int32_t x, int32_t y, int32_t w)
+{
+  int32_t ts = textsize;
+  int32_t bw = w / ts, bh = glyph_ab + glyph_bb; // Box size at textsize 1
+  if ((bw <= 0) || (bh <= 0)) return -1;
+
+  uint32_t stride = (bw + 7) >> 3;
+  uint8_t *mask = (uint8_t *)calloc(stride * bh, 1);
+  if (!mask) return -1;
+
+  GFXglyph *glyphs = (GFXglyph *)pgm_read_dword(&gfxFont->glyph);
+  uint8_t  *bitmap = (uint8_t *)pgm_read_dword(&gfxFont->bitmap);
+
+  boolean spill = false; // A glyph has pixels outside the box
+
+  for (uint16_t i = 0; i < count; i++) {
+    uint16_t gi = pos[i].glyph;
+    GFXglyph *glyph = &glyphs[gi];
+    uint16_t bo = pgm_read_word(&glyph->bitmapOffset);
+    uint8_t  gw = pgm_read_byte(&glyph->width),
+             gh = pgm_read_byte(&glyph->height);
+    int32_t  gx = pos[i].x + (int8_t)pgm_read_byte(&glyph->xOffset),
+             gy = glyph_ab + (int8_t)pgm_read_byte(&glyph->yOffset);
+
+    if ((gx < 0) || (gy < 0) || (gx + gw > bw) || (gy + gh > bh)) spill = true;
+
+    // Set the mask bits, from the glyph cache runs if there are any
+    TFT_GlyphEntry *entry = glyphCache ? glyphCacheGet(gfxFont, gi) : NULL;
+    uint8_t bits = 0, bit = 0, *run = entry ? (uint8_t *)(entry + 1) : NULL;
+    uint16_t runs = entry ? entry->runs : 0;
+
+    for (int32_t yy = 0; yy < gh; yy++) {
+      int32_t py = gy + yy;
+      for (int32_t xx = 0; xx < gw; xx++) {
+        boolean set;
+        if (entry) { // Runs are in row and column order
+          while (runs && ((run[0] < yy) || ((run[0] == yy) && (run[1] + run[2] <= xx)))) { run += 3; runs--; }
+          set = runs && (run[0] == yy) && (run[1] <= xx);
+        }
+        else {
+          if (bit == 0) {
+            bits = pgm_read_byte(&bitmap[bo++]);
+            bit  = 0x80;
+          }
+          set = bits & bit;
+          bit >>= 1;
+        }
+        int32_t px = gx + xx;
+        if (set && (px >= 0) && (px < bw) && (py >= 0) && (py < bh))
+          mask[py * stride + (px >> 3)] |= 0x80 >> (px & 7);
+      }
+    }
+  }
+
+  // Send the box clipped to the screen, one window for the whole string
+  int32_t x0 = x, y0 = y - glyph_ab * ts;
+  int32_t xs = (x0 < 0) ? 0 : x0, xe = x0 + bw * ts,
+          ys = (y0 < 0) ? 0 : y0, ye = y0 + bh * ts;
+  if (xe > (int32_t)_width)  xe = _width;
+  if (ye > (int32_t)_height) ye = _height;
+
+  if ((xs < xe) && (ys < ye)) {
+    setWindow(xs, ys, xe - 1, ye - 1);
+    for (int32_t py = ys; py < ye; py++) {
+      uint8_t *row = mask + ((py - y0) / ts) * stride;
+      int32_t px = xs;
+      while (px < xe) {
+        int32_t col = (px - x0) / ts, end;
+        uint8_t set = (row[col >> 3] >> (7 - (col & 7))) & 1;
+        do {
+          col++;
+          end = x0 + col * ts;
+        } while ((end < xe) && (((row[col >> 3] >> (7 - (col & 7))) & 1) == set));
+        if (end > xe) end = xe;
+        pushColor(set ? textcolor : textbgcolor, end - px);
+        px = end;
+      }
+    }
+  }
+
+  free(mask);
+
+  // Draw the glyphs that reach outside the box over it
+  if (spill) {
+    for (uint16_t i = 0; i < count; i++) {
+      GFXglyph *glyph = &glyphs[pos[i].glyph];
+      int32_t gx = pos[i].x + (int8_t)pgm_read_byte(&glyph->xOffset),
+              gy = glyph_ab + (int8_t)pgm_read_byte(&glyph->yOffset);
+      if ((gx < 0) || (gy < 0) || (gx + pgm_read_byte(&glyph->width) > bw) ||
+          (gy + pgm_read_byte(&glyph->height) > bh)) drawChar(x + pos[i].x * ts, y, pos[i].code, textcolor, textbgcolor, ts);
+    }
+  }
+
+  return pos[count].x * ts;
+}
+#endif
+
+
 /***************************************************************************************
 ** Function name:           setFreeFont
 ** Descriptions:            Sets the GFX free font to use
@@ -2786,18 +4273,342 @@ void TFT_eSPI::setFreeFont(const GFXfont *f) {
   //textdatum = L_BASELINE;
   textfont = 1;
   gfxFont = (GFXfont *)f;
+  smoothFont = false;
+  kernPairs = NULL; // The pairs are for one font
+  kernCount = 0;
 
   // Save above baseline (for say H)  and below baseline (for y tail) heights
-  uint16_t uniCode = FF_HEIGHT - pgm_read_byte(&gfxFont->first);
-  GFXglyph *glyph1  = &(((GFXglyph *)pgm_read_dword(&gfxFont->glyph))[uniCode]);
+  int32_t gi = glyphIndex(FF_HEIGHT);
+  if (gi < 0) gi = 0; // Not in the font
+  GFXglyph *glyph1  = &(((GFXglyph *)pgm_read_dword(&gfxFont->glyph))[gi]);
   glyph_ab = -pgm_read_byte(&glyph1->yOffset);
 
-  uniCode = FF_BOTTOM - pgm_read_byte(&gfxFont->first);
-  GFXglyph *glyph2  = &(((GFXglyph *)pgm_read_dword(&gfxFont->glyph))[uniCode]);
+  gi = glyphIndex(FF_BOTTOM);
+  if (gi < 0) gi = 0;
+  GFXglyph *glyph2  = &(((GFXglyph *)pgm_read_dword(&gfxFont->glyph))[gi]);
   glyph_bb = pgm_read_byte(&glyph2->height) + (int8_t)pgm_read_byte(&glyph2->yOffset);
 }
 
 
+/***************************************************************************************
+** Function name:           glyphRuns
+** Description:             Find the runs of foreground pixels in a free font glyph
+***************************************************************************************/
+// Returns the number of runs, they are written to run as row, first column and length
+// unless run is NULL
+static uint16_t glyphRuns(const uint8_t *bitmap, uint16_t bo, uint8_t w, uint8_t h, uint8_t *run)
+{
+  uint16_t runs = 0;
+  uint8_t  bits = 0, bit = 0;
+
+  for (uint8_t yy = 0; yy < h; yy++) {
+    uint8_t hpc = 0; // Horizontal foreground pixel count
+    for (uint8_t xx = 0; xx <= w; xx++) {
+      if (xx < w) {
+        if (bit == 0) {
+          bits = pgm_read_byte(&bitmap[bo++]);
+          bit  = 0x80;
+        }
+        bool set = bits & bit;
+        bit >>= 1;
+        if (set) { hpc++; continue; }
+      }
+      if (hpc) {
+        if (run) { *run++ = yy; *run++ = xx - hpc; *run++ = hpc; }
+        runs++;
+        hpc = 0;
+      }
+    }
+  }
+  return runs;
+}
+
+
+/***************************************************************************************
+** Function name:           setGlyphCache
+** Description:             Allocate bytes of RAM for the glyph cache, 0 frees it
+***************************************************************************************/
+bool TFT_eSPI::setGlyphCache(uint32_t bytes)
+{
+  if (glyphCache) free(glyphCache);
+  glyphCache     = NULL;
+  glyphCacheSize = 0;
+  glyphCacheUsed = 0;
+
+  if (bytes == 0) return true;
+
+  glyphCache = (uint8_t *)malloc(bytes);
+  if (!glyphCache) return false;
+
+  glyphCacheSize = bytes;
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           clearGlyphCacheStats
+** Description:             Zero the glyph cache counters
+***************************************************************************************/
+void TFT_eSPI::clearGlyphCacheStats(void)
+{
+  glyphCacheStats.hits      = 0;
+  glyphCacheStats.misses    = 0;
+  glyphCacheStats.evictions = 0;
+}
+
+
+/***************************************************************************************
+** Function name:           glyphCacheGet
+** Description:             Find a glyph in the cache, decode it into the cache if absent
+***************************************************************************************/
+// Entries are packed from the start of the cache RAM, each rounded up to the alignment
+// of TFT_GlyphEntry (its pointer makes that 8 bytes on a 64 bit host). A new glyph goes
+// at the end, the least recently drawn entries are removed and the ones after them
+// moved down until it fits. Returns NULL if the glyph is larger than the cache.
+#define GLYPH_ENTRY_ALIGN       (alignof(TFT_GlyphEntry))
+#define GLYPH_ENTRY_BYTES(runs) (sizeof(TFT_GlyphEntry) + (((runs) * 3 + GLYPH_ENTRY_ALIGN - 1) & ~(GLYPH_ENTRY_ALIGN - 1)))
+
+TFT_GlyphEntry* TFT_eSPI::glyphCacheGet(const GFXfont *font, uint16_t c)
+{
+  uint8_t *end = glyphCache + glyphCacheUsed;
+  glyphCacheTick++;
+
+  for (uint8_t *p = glyphCache; p < end; p += GLYPH_ENTRY_BYTES(((TFT_GlyphEntry *)p)->runs)) {
+    TFT_GlyphEntry *entry = (TFT_GlyphEntry *)p;
+    if ((entry->code == c) && (entry->font == font)) {
+      entry->used = glyphCacheTick;
+      glyphCacheStats.hits++;
+      return entry;
+    }
+  }
+
+  glyphCacheStats.misses++;
+
+  GFXglyph *glyph  = &(((GFXglyph *)pgm_read_dword(&font->glyph))[c]);
+  uint8_t  *bitmap = (uint8_t *)pgm_read_dword(&font->bitmap);
+  uint16_t bo = pgm_read_word(&glyph->bitmapOffset);
+  uint8_t  w  = pgm_read_byte(&glyph->width),
+           h  = pgm_read_byte(&glyph->height);
+
+  uint16_t runs  = glyphRuns(bitmap, bo, w, h, NULL);
+  uint32_t bytes = GLYPH_ENTRY_BYTES(runs);
+  if (bytes > glyphCacheSize) return NULL;
+
+  // Drop the least recently drawn glyphs until there is room
+  while (glyphCacheSize - glyphCacheUsed < bytes) {
+    uint8_t *oldest = glyphCache;
+    end = glyphCache + glyphCacheUsed;
+    for (uint8_t *p = glyphCache; p < end; p += GLYPH_ENTRY_BYTES(((TFT_GlyphEntry *)p)->runs)) {
+      if (((TFT_GlyphEntry *)p)->used < ((TFT_GlyphEntry *)oldest)->used) oldest = p;
+    }
+    uint32_t size = GLYPH_ENTRY_BYTES(((TFT_GlyphEntry *)oldest)->runs);
+    memmove(oldest, oldest + size, end - oldest - size);
+    glyphCacheUsed -= size;
+    glyphCacheStats.evictions++;
+  }
+
+  TFT_GlyphEntry *entry = (TFT_GlyphEntry *)(glyphCache + glyphCacheUsed);
+  entry->font = font;
+  entry->used = glyphCacheTick;
+  entry->code = c;
+  entry->runs = runs;
+  glyphRuns(bitmap, bo, w, h, (uint8_t *)(entry + 1));
+  glyphCacheUsed += bytes;
+
+  return entry;
+}
+
+
+/***************************************************************************************
+** Function name:           setSmoothFont
+** Description:             Sets the anti-aliased font to use
+***************************************************************************************/
+void TFT_eSPI::setSmoothFont(const SmoothFont *f)
+{
+  setFreeFont((const GFXfont *)f); // Same metrics and layout, only the bitmaps differ
+  smoothFont = true;
+}
+
+
+/***************************************************************************************
+** Function name:           blendTable
+** Description:             Make the table of fg blended with bg at 16 coverage levels
+***************************************************************************************/
+// Smooth font pixels are then a table lookup, the table is only made again when the
+// colours change
+void TFT_eSPI::blendTable(uint16_t fg, uint16_t bg)
+{
+  if ((fg == blendFg) && (bg == blendBg)) return;
+
+  blendFg = fg;
+  blendBg = bg;
+
+  int32_t fr = fg >> 11, fgr = (fg >> 5) & 0x3F, fb = fg & 0x1F;
+  int32_t br = bg >> 11, bgr = (bg >> 5) & 0x3F, bb = bg & 0x1F;
+
+  for (int32_t a = 0; a < 16; a++) {
+    uint16_t r = (fr  * a + br  * (15 - a) + 7) / 15,
+             g = (fgr * a + bgr * (15 - a) + 7) / 15,
+             b = (fb  * a + bb  * (15 - a) + 7) / 15;
+    uint16_t color = (r << 11) | (g << 5) | b;
+    blendLut[a] = (color >> 8) | (color << 8);
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           pushAlphaRow
+** Description:             send screen columns xs to xe - 1 of a row of coverage values
+***************************************************************************************/
+// alpha[0] is the coverage at screen column x and each value covers size columns. The
+// address window must be set, the colours come from blendLut.
+void TFT_eSPI::pushAlphaRow(const uint8_t *alpha, int32_t x, uint8_t size, int32_t xs, int32_t xe)
+{
+  uint16_t line[32];
+  uint8_t  n = 0;
+
+  alpha += (xs - x) / size;
+  uint8_t rep = (xs - x) % size; // Columns of *alpha already sent
+
+  for (int32_t px = xs; px < xe; px++) {
+    line[n++] = blendLut[*alpha];
+    if (++rep == size) { rep = 0; alpha++; }
+    if (n == 32) { pushColors((uint8_t *)line, 64); n = 0; }
+  }
+  if (n) pushColors((uint8_t *)line, n << 1);
+}
+
+
+/***************************************************************************************
+** Function name:           drawSmoothGlyph
+** Description:             draw one smooth font glyph
+***************************************************************************************/
+// x,y is the top left corner of the w x h glyph bitmap, alpha points to its coverage
+// values in FLASH. The bitmap area is blended with bg, or if bg == fg the pixels that
+// are at least half covered are drawn in fg.
+void TFT_eSPI::drawSmoothGlyph(int32_t x, int32_t y, const uint8_t *alpha, uint8_t w, uint8_t h,
+                               uint32_t fg, uint32_t bg, uint8_t size)
+{
+  uint8_t  row[256];
+  int32_t  ys = (y < 0) ? 0 : y, ye = y + h * size,
+           xs = (x < 0) ? 0 : x, xe = x + w * size;
+  if (ye > (int32_t)_height) ye = _height;
+  if (xe > (int32_t)_width)  xe = _width;
+  if ((xs >= xe) || (ys >= ye)) return;
+
+  boolean opaque = (fg != bg);
+  if (opaque) {
+    blendTable(fg, bg);
+    setWindow(xs, ys, xe - 1, ye - 1);
+  }
+
+  int32_t last = -1; // Glyph row in row[]
+  for (int32_t py = ys; py < ye; py++) {
+    int32_t yy = (py - y) / size;
+    if (yy != last) {
+      uint32_t i = yy * w;
+      for (uint8_t xx = 0; xx < w; xx++, i++) {
+        uint8_t b = pgm_read_byte(alpha + (i >> 1));
+        row[xx] = (i & 1) ? (b & 0x0F) : (b >> 4);
+      }
+      last = yy;
+    }
+
+    if (opaque) { pushAlphaRow(row, x, size, xs, xe); continue; }
+
+    // Runs of pixels that are at least half covered
+    for (int32_t xx = 0; xx < w; ) {
+      if (row[xx] < 8) { xx++; continue; }
+      int32_t x0 = xx;
+      while ((xx < w) && (row[xx] >= 8)) xx++;
+      writeFillRect(x + x0 * size, py, (xx - x0) * size, 1, fg);
+    }
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           drawSmoothString
+** Description:             draw a smooth font string blended with its background
+***************************************************************************************/
+// pos holds the count glyphs of the string from layoutString(), x,y is the left end of
+// the baseline and w the pixel width of the string. The box sent covers the background
+// of the string, as for the free fonts, and every glyph. It is sent in one window, each
+// row is made by taking the highest coverage of the glyphs that overlap at each pixel.
+// Returns the x advance or -1 if there is not enough RAM.
+int16_t TFT_eSPI::drawSmoothString(const TFT_GlyphPos *pos, uint16_t count, int32_t x, int32_t y, int32_t w)
+{
+  int32_t ts = textsize;
+  GFXglyph *glyphs = (GFXglyph *)pgm_read_dword(&gfxFont->glyph);
+  uint8_t  *bitmap = (uint8_t *)pgm_read_dword(&gfxFont->bitmap);
+
+  // Box relative to x,y at textsize 1
+  int32_t bx0 = 0, bx1 = w / ts, by0 = -glyph_ab, by1 = glyph_bb;
+  int32_t cx  = pos[count].x;
+
+  for (uint16_t i = 0; i < count; i++) {
+    GFXglyph *glyph = &glyphs[pos[i].glyph];
+    uint8_t gw = pgm_read_byte(&glyph->width),
+            gh = pgm_read_byte(&glyph->height);
+    if (gw && gh) {
+      int32_t gx = pos[i].x + (int8_t)pgm_read_byte(&glyph->xOffset),
+              gy = (int8_t)pgm_read_byte(&glyph->yOffset);
+      if (gx < bx0) bx0 = gx;
+      if (gx + gw > bx1) bx1 = gx + gw;
+      if (gy < by0) by0 = gy;
+      if (gy + gh > by1) by1 = gy + gh;
+    }
+  }
+
+  int32_t bw = bx1 - bx0;
+  if ((bw <= 0) || (by1 <= by0)) return cx * ts;
+
+  uint8_t *alpha = (uint8_t *)malloc(bw);
+  if (!alpha) return -1;
+
+  blendTable(textcolor, textbgcolor);
+
+  int32_t x0 = x + bx0 * ts, y0 = y + by0 * ts;
+  int32_t xs = (x0 < 0) ? 0 : x0, xe = x0 + bw * ts,
+          ys = (y0 < 0) ? 0 : y0, ye = y0 + (by1 - by0) * ts;
+  if (xe > (int32_t)_width)  xe = _width;
+  if (ye > (int32_t)_height) ye = _height;
+
+  if ((xs < xe) && (ys < ye)) {
+    setWindow(xs, ys, xe - 1, ye - 1);
+
+    int32_t made = by0 - 1; // Row in alpha[]
+    for (int32_t py = ys; py < ye; py++) {
+      int32_t r = by0 + (py - y0) / ts; // Row relative to the baseline
+      if (r != made) {
+        memset(alpha, 0, bw);
+        for (uint16_t g = 0; g < count; g++) {
+          GFXglyph *glyph = &glyphs[pos[g].glyph];
+          uint8_t gw = pgm_read_byte(&glyph->width);
+          int32_t yy = r - (int8_t)pgm_read_byte(&glyph->yOffset);
+          if ((yy >= 0) && (yy < pgm_read_byte(&glyph->height))) {
+            const uint8_t *src = bitmap + pgm_read_word(&glyph->bitmapOffset);
+            uint8_t *dst = alpha + pos[g].x - bx0 + (int8_t)pgm_read_byte(&glyph->xOffset);
+            uint32_t i = yy * gw;
+            for (uint8_t xx = 0; xx < gw; xx++, i++) {
+              uint8_t b = pgm_read_byte(src + (i >> 1));
+              b = (i & 1) ? (b & 0x0F) : (b >> 4);
+              if (b > dst[xx]) dst[xx] = b;
+            }
+          }
+        }
+        made = r;
+      }
+      pushAlphaRow(alpha, x0, ts, xs, xe);
+    }
+  }
+
+  free(alpha);
+
+  return cx * ts;
+}
+
+
 /***************************************************************************************
 ** Function name:           setTextFont
 ** Description:             Set the font for the print stream
@@ -2806,6 +4617,7 @@ void TFT_eSPI::setTextFont(uint8_t f)
 {
   textfont = (f > 0) ? f : 1; // Don't allow font 0
   gfxFont = NULL;
+  smoothFont = false;
 }
 
 #else
@@ -2834,6 +4646,19 @@ void TFT_eSPI::setTextFont(uint8_t f)
 #endif
 
 
+// The sprite class functions
+#include "Extensions/Sprite.cpp"
+
+// The display list class functions
+#include "Extensions/DisplayList.cpp"
+
+// The number field class functions
+#include "Extensions/NumberField.cpp"
+
+// The text box class functions
+#include "Extensions/TextBox.cpp"
+
+
 /***************************************************
   The majority of code in this file is "FunWare", the only condition of use of
   those portions is that users have fun!  Most of the effort has been spent on
@@ -2868,7 +4693,7 @@ void TFT_eSPI::setTextFont(uint8_t f)
   issue on GitHub:
 
 
-/***************************************************
+ ***************************************************
   The Adafruit_ILI9341 library has been used as a starting point
   for this library.
 
@@ -22,11 +22,27 @@
 // Include header file that defines the fonts loaded and the pins to be used
 #include <User_Setup_Select.h>
 
+// A host build (see Extensions/Host.h) needs the Arduino API types before the fonts
+#ifdef TFT_HOST_BACKEND
+  #include <Arduino.h>
+  #ifndef PROGMEM
+    #define PROGMEM
+  #endif
+  #ifndef pgm_read_byte
+    #define pgm_read_byte(addr) (*(const uint8_t *)(const void *)(addr))
+    #define pgm_read_word(addr) (*(const uint16_t *)(const void *)(addr))
+  #endif
+  // pgm_read_dword() is only used to fetch table pointers in this library, on a
+  // 64 bit host these must be read at the native pointer width
+  #undef  pgm_read_dword
+  #define pgm_read_dword(addr) (*(const uintptr_t *)(const void *)(addr))
+#endif
+
 // Load the right driver definitions <<<<<<<<<<<<<<<<<<<<< ADD NEW DRIVERS TO THE LIST HERE <<<<<<<<<<<<<<<<<<<<<<<
 #if   defined (ILI9341_DRIVER)
-     #include <TFT_Drivers\ILI9341_Defines.h>
+     #include <TFT_Drivers/ILI9341_Defines.h>
 #elif defined (ST7735_DRIVER)
-     #include <TFT_Drivers\ST7735_Defines.h>
+     #include <TFT_Drivers/ST7735_Defines.h>
 #endif
 
 // If the frequency is not defined, set a default
@@ -73,11 +89,17 @@
 #include <Arduino.h>
 #include <Print.h>
 
-#include <pgmspace.h>
-
-#include <SPI.h>
+#ifdef TFT_HOST_BACKEND
+  #include <Extensions/Host.h>
+#else
+  #include <pgmspace.h>
+  #include <SPI.h>
+#endif
 
-#if defined (ESP32) || defined (D0_USED_FOR_DC)
+#if defined (TFT_HOST_BACKEND)
+  #define DC_C TFT_Host::dcLow()
+  #define DC_D TFT_Host::dcHigh()
+#elif defined (ESP32) || defined (D0_USED_FOR_DC)
   #define DC_C digitalWrite(TFT_DC, LOW)
   #define DC_D digitalWrite(TFT_DC, HIGH)
 #else
@@ -85,7 +107,10 @@
   #define DC_D GPOS=dcpinmask
 #endif
 
-#ifndef TFT_CS
+#if defined (TFT_HOST_BACKEND)
+  #define CS_L TFT_Host::csLow()
+  #define CS_H TFT_Host::csHigh()
+#elif !defined (TFT_CS)
   #define CS_L // No macro allocated so it generates no code
   #define CS_H // No macro allocated so it generates no code
 #else
@@ -98,10 +123,48 @@
   #endif
 #endif
 
+// Bus transport macros. The generic (non ESP8266 register level) code paths send all
+// commands and pixels through these so that an alternative backend can be used.
+// 16 bit values are sent MSB first.
+#if defined (TFT_HOST_BACKEND)
+  #define tft_Write_8(C)           TFT_Host::write8(C)
+  #define tft_Write_16(C)          TFT_Host::write16(C)
+  #define tft_Write_Pattern(P,S,N) TFT_Host::writePattern(P,S,N)
+  #define tft_Write_Bytes(P,N)     TFT_Host::writeBytes(P,N)
+  #define tft_Read_8()             TFT_Host::read8()
+#else
+  #define tft_Write_8(C)           _SPI->write(C)
+  #define tft_Write_16(C)          _SPI->write16(C)
+  #define tft_Write_Pattern(P,S,N) _SPI->writePattern(P,S,N)
+  #define tft_Write_Bytes(P,N)     _SPI->writeBytes(P,N)
+  #define tft_Read_8()             _SPI->transfer(0)
+#endif
+
+// Asynchronous pixel transfers for pushColorsDMA() and pushRectDMA(), the host backend
+// simulates these. Without TFT_DMA those functions send the pixels before returning.
+#if defined (TFT_HOST_BACKEND)
+  #define TFT_DMA
+#elif defined (ESP32) && defined (ESP32_DMA)
+  #define TFT_DMA
+  #include "driver/spi_master.h"
+
+  // VSPI pins as used by the ESP32 Arduino SPI library
+  #ifndef TFT_MOSI
+    #define TFT_MOSI 23
+  #endif
+  #ifndef TFT_MISO
+    #define TFT_MISO 19
+  #endif
+  #ifndef TFT_SCLK
+    #define TFT_SCLK 18
+  #endif
+#endif
+
 // We can include all the free fonts and they will only be built into
 // the sketch if they are used
 
 #include <Fonts/GFXFF/gfxfont.h>
+#include <Fonts/Smooth/smoothfont.h>
 
 // New custom fonts
 #include <Fonts/Custom/Orbitron_Light_24.h> // CF_OL24
@@ -175,6 +238,9 @@
 #include <Fonts/GFXFF/FreeSerifBoldItalic18pt7b.h> // FF47 or FSBI18
 #include <Fonts/GFXFF/FreeSerifBoldItalic24pt7b.h> // FF48 or FSBI24
 
+// Smooth (anti-aliased) fonts
+#include <Fonts/Smooth/FreeSansSmooth16pt7b.h>
+
 // Swap any type
 template <typename T> static inline void
 swap(T& a, T& b) { T t = a; a = b; b = t; }
@@ -196,6 +262,22 @@ swap(T& a, T& b) { T t = a; a = b; b = t; }
 #define C_BASELINE 10 // Centre character baseline
 #define R_BASELINE 11 // Right character baseline
 
+// Fill rules for fillPolygon()
+#define FILL_EVEN_ODD 0 // Areas inside an odd number of edges are filled
+#define FILL_NONZERO  1 // Areas the outline winds around are filled, overlaps stay filled
+
+// The most corners fillPolygon() will fill, its edge table is on the stack and needs
+// about 40 bytes per corner. Define it in User_Setup.h to change it.
+#ifndef TFT_POLY_MAX_POINTS
+  #define TFT_POLY_MAX_POINTS 32
+#endif
+
+// The most free font glyphs drawString() lays out at once, on the stack at 6 bytes each.
+// Longer strings are drawn a character at a time. Define it in User_Setup.h to change it.
+#ifndef TFT_LAYOUT_GLYPHS
+  #define TFT_LAYOUT_GLYPHS 40
+#endif
+
 
 // New color definitions use for all my libraries
 #define TFT_BLACK       0x0000      /*   0,   0,   0 */
@@ -272,21 +354,82 @@ const PROGMEM fontinfo fontdata [] = {
   #endif
 };
 
+#ifdef LOAD_GFXFF
+// A free font glyph in the glyph cache, followed by its runs of foreground pixels,
+// 3 bytes each: row, first column and length
+typedef struct {
+  const GFXfont *font;
+  uint32_t used;  // Tick count when last drawn, the lowest is dropped first
+  uint16_t code;  // Glyph index in the font
+  uint16_t runs;  // Number of runs that follow
+} TFT_GlyphEntry;
+
+// Glyph cache counters, zeroed by clearGlyphCacheStats()
+typedef struct {
+  uint32_t hits;      // Glyphs drawn from the cache
+  uint32_t misses;    // Glyphs decoded from FLASH
+  uint32_t evictions; // Glyphs dropped to make room
+} TFT_GlyphCacheStats;
 
+// A free font glyph of a string laid out by layoutString()
+typedef struct {
+  uint16_t code;  // Character code
+  uint16_t glyph; // Glyph index in the font
+  int16_t  x;     // Origin relative to the start of the string at textsize 1
+} TFT_GlyphPos;
+#endif
 
+
+// A corner of a polygon
+typedef struct {
+  int16_t x, y;
+} TFT_Point;
+
+// An edge of a polygon being filled, x is stepped from row to row without a divide
+typedef struct {
+  int16_t  y0, y1;     // First and last row
+  int32_t  x;          // Column on the current row, or the left end if horizontal
+  int32_t  step;       // Whole columns moved each row
+  int32_t  frac, dy;   // The remainder moved each row is frac / dy
+  int32_t  err;        // Remainder so far
+  int8_t   sign;       // Direction x steps, -1 or 1
+  int8_t   wind;       // 1 if the outline runs down this edge, -1 up, 0 horizontal
+  int16_t  x1;         // Right end of a horizontal edge
+} TFT_PolyEdge;
 // Class functions and variables
 class TFT_eSPI : public Print {
 
+ friend class TFT_eNumberField; // Draws with its own text settings
+ friend class TFT_eTextBox;     // Lays out text with the glyph metrics
+
  public:
 
   TFT_eSPI(int16_t _W = TFT_WIDTH, int16_t _H = TFT_HEIGHT);
+  ~TFT_eSPI(void);
 
   void     init(void), begin(void); // Same - begin included for backwards compatibility
 
-  void     drawPixel(uint32_t x, uint32_t y, uint32_t color);
-
-  void     drawChar(int32_t x, int32_t y, unsigned char c, uint32_t color, uint32_t bg, uint8_t font),
+           // The functions declared virtual are the only ones that access the TFT to draw,
+           // the rest are built on them. A TFT_eSprite overrides them to draw in RAM.
+  virtual void drawPixel(uint32_t x, uint32_t y, uint32_t color),
+
+           // Hold the SPI bus and TFT chip select across several graphics calls, e.g. a
+           // whole screen update. Calls can be nested, the bus is released by the last
+           // endWrite(). Other devices on the same SPI bus must not be used in between.
+           startWrite(void),
+           endWrite(void),
+
+           // Versions of the basic primitives that must only be called between
+           // startWrite() and endWrite(), they do no transaction or chip select handling
+           writePixel(uint32_t x, uint32_t y, uint32_t color),
+           writeFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color),
+           writeFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color),
+           writeFillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color),
+           writeAddrWindow(int32_t xs, int32_t ys, int32_t xe, int32_t ye),
+
+           drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t font),
            setWindow(int16_t x0, int16_t y0, int16_t x1, int16_t y1),
+           setAddrWindow(int32_t xs, int32_t ys, int32_t xe, int32_t ye),
 
            pushColor(uint16_t color),
            pushColor(uint16_t color, uint16_t len),
@@ -294,18 +437,30 @@ class TFT_eSPI : public Print {
            pushColors(uint16_t *data, uint8_t len),
            pushColors(uint8_t  *data, uint32_t len),
 
-           fillScreen(uint32_t color),
+           drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color),
+           drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color),
+           drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color),
+           fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color),
+
+           // Write a block of pixels to the screen
+           pushRect(uint32_t x0, uint32_t y0, uint32_t w, uint32_t h, uint16_t *data),
+
+           // The next functions can be used as a pair to copy screen blocks (or horizontal/vertical lines) to another location
+           // Read a block of pixels to a data buffer, buffer is 16 bit and the array size must be at least w * h
+           readRect(uint32_t x0, uint32_t y0, uint32_t w, uint32_t h, uint16_t *data);
+
+           // Read the colour of a pixel at x,y and return value in 565 format 
+  virtual uint16_t readPixel(int32_t x0, int32_t y0);
+
+  virtual int16_t  drawChar(unsigned int uniCode, int x, int y, int font);
+
+  void     fillScreen(uint32_t color),
 
            writeEnd(void),
            backupSPCR(void),
            restoreSPCR(void),
 
-           drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color),
-           drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color),
-           drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color),
-
            drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color),
-           fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color),
            drawRoundRect(int32_t x0, int32_t y0, int32_t w, int32_t h, int32_t radius, uint32_t color),
            fillRoundRect(int32_t x0, int32_t y0, int32_t w, int32_t h, int32_t radius, uint32_t color),
 
@@ -321,9 +476,35 @@ class TFT_eSPI : public Print {
            fillEllipse(int16_t x0, int16_t y0, int16_t rx, int16_t ry, uint16_t color),
 
            drawTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color),
+
+           // A triangle with a corner outside the int16_t range is not drawn
            fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color),
 
+           // Fill a polygon of n corners, the last corner joins the first. The outline
+           // is included, so shapes that share an edge overlap on it. Each row is one
+           // or more spans, no pixel is drawn twice. Nothing is drawn if n is more
+           // than TFT_POLY_MAX_POINTS.
+           fillPolygon(const TFT_Point *points, uint16_t n, uint32_t color, uint8_t rule = FILL_EVEN_ODD),
+
+           // Anti-aliased lines and circle outlines, the edge pixels are blended with bgcolor
+           // or, without bgcolor, with the pixels already drawn. These are read back so the
+           // TFT must support readPixel(), in a Sprite they are read from its RAM. Arc angles
+           // are in degrees clockwise from 12 o'clock, the arc is drawn from start to end.
+           drawSmoothLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color),
+           drawSmoothLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color, uint32_t bgcolor),
+           drawSmoothCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color),
+           drawSmoothCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color, uint32_t bgcolor),
+           drawSmoothArc(int32_t x0, int32_t y0, int32_t r, int32_t startAngle, int32_t endAngle, uint32_t color),
+           drawSmoothArc(int32_t x0, int32_t y0, int32_t r, int32_t startAngle, int32_t endAngle, uint32_t color, uint32_t bgcolor),
+
+           // Filled shapes drawn as one span per row, no pixel is drawn twice. The arc
+           // angles are as for drawSmoothArc(), the ring is filled from rInner to rOuter.
+           fillArc(int32_t x, int32_t y, int32_t rInner, int32_t rOuter, int32_t startAngle, int32_t endAngle, uint32_t color),
+           drawWideLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t width, uint32_t color, boolean roundEnds = true),
+
            drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color),
+           // Opaque, the clear bits are drawn in bgcolor and the bitmap is sent in one window
+           drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t fgcolor, uint16_t bgcolor),
 
            setCursor(int16_t x, int16_t y),
            setCursor(int16_t x, int16_t y, uint8_t font),
@@ -347,18 +528,55 @@ class TFT_eSPI : public Print {
            writedata(uint8_t d),
            commandList(const uint8_t *addr);
 
+           // Blend two RGB565 colours, alpha 0 gives bgc and 255 gives fgc
+  uint16_t alphaBlend(uint8_t alpha, uint16_t fgc, uint16_t bgc);
+
   uint8_t  readcommand8(uint8_t cmd_function, uint8_t index);
   uint16_t readcommand16(uint8_t cmd_function, uint8_t index);
   uint32_t readcommand32(uint8_t cmd_function, uint8_t index);
 
-           // Read the colour of a pixel at x,y and return value in 565 format 
-  uint16_t readPixel(int32_t x0, int32_t y0);
+           // Pixel pipeline, with TFT_DMA the pixels are clocked out in the background while
+           // the processor carries on, e.g. rendering the next block into a second buffer.
+           // Use inside startWrite()/endWrite(), outside a session they do not return until
+           // the pixels are sent. The data uses the same byte order as pushRect() and the
+           // buffer must not be changed until the next pushColorsDMA() or pushRectDMA() call
+           // returns, or until dmaWait() is called. On ESP32 the buffer must be in DMA
+           // capable RAM (not FLASH). Other functions wait for the transfers to finish.
+  bool     initDMA(void); // Returns true if pixels can be sent in the background
+  void     pushColorsDMA(uint16_t *data, uint32_t len), // len is the pixel count
+           pushRectDMA(uint32_t x0, uint32_t y0, uint32_t w, uint32_t h, uint16_t *data),
+           dmaWait(void); // Fence, returns when all queued pixels have been sent
+  bool     dmaBusy(void); // Returns true if a transfer is still in progress
 
-           // The next functions can be used as a pair to copy screen blocks (or horizontal/vertical lines) to another location
-		   // Read a block of pixels to a data buffer, buffer is 16 bit and the array size must be at least w * h
-  void     readRect(uint32_t x0, uint32_t y0, uint32_t w, uint32_t h, uint16_t *data);
-		   // Write a block of pixels to the screen
-  void     pushRect(uint32_t x0, uint32_t y0, uint32_t w, uint32_t h, uint16_t *data);
+#ifdef LOAD_GFXFF
+           // Free font glyph cache, keeps the runs of pixels of recently drawn glyphs in RAM
+           // so they are not decoded from FLASH each time. bytes is the RAM to use, the glyph
+           // not drawn for longest is dropped to make room. 0 frees the RAM (the default).
+           // Returns false if there is not enough free RAM.
+  bool     setGlyphCache(uint32_t bytes);
+  void     clearGlyphCacheStats(void);
+  TFT_GlyphCacheStats glyphCacheStats;
+
+           // Select an anti-aliased font, it is then used like a free font until setFreeFont()
+           // or setTextFont() is called. The edges are blended with the background colour
+           // of setTextColor(), transparent text is drawn without blending using the pixels
+           // that are at least half covered. Blending needs RGB colours, use transparent
+           // text in 1 and 4 bit Sprites.
+  void     setSmoothFont(const SmoothFont *f);
+
+           // Kerning pairs of the current free or smooth font, in left then right character
+           // code order. They are used by drawString(), textWidth() and print() until the font
+           // is changed. NULL turns kerning off.
+  void     setKerning(const GFXkern *pairs, uint16_t count);
+#endif
+
+#ifdef LOAD_UNICODE
+           // Free font text is UTF-8, the numbered fonts still use one byte per character.
+           // Invalid bytes are returned unchanged, so Latin-1 text mostly still works.
+  uint16_t decodeUTF8(const char **string), // Decode the character at *string and step past it
+           decodeUTF8(uint8_t c);           // Decode a stream a byte at a time, returns 0 until
+                                            // the last byte of a character is received
+#endif
 
 		   // This next function has been used successfully to dump the TFT screen to a PC for documentation purposes
 		   // It reads a screen area and returns the RGB 8 bit colour values of each pixel
@@ -370,8 +588,7 @@ class TFT_eSPI : public Print {
   uint16_t fontsLoaded(void),
            color565(uint8_t r, uint8_t g, uint8_t b);
 
-  int16_t  drawChar(unsigned int uniCode, int x, int y, int font),
-		   drawChar(unsigned int uniCode, int x, int y),
+  int16_t  drawChar(unsigned int uniCode, int x, int y),
            drawNumber(long long_num,int poX, int poY, int font),
 		   drawNumber(long long_num,int poX, int poY),
            drawFloat(float floatNumber,int decimal,int poX, int poY, int font),
@@ -397,15 +614,19 @@ class TFT_eSPI : public Print {
 		   textWidth(const String& string),
            fontHeight(int16_t font);
 
-    void   setAddrWindow(int32_t xs, int32_t ys, int32_t xe, int32_t ye);
-
  virtual   size_t write(uint8_t);
 
  private:
 
+#ifndef TFT_HOST_BACKEND
             SPIClass *_SPI;
+#endif
 inline void spi_begin() __attribute__((always_inline));
 inline void spi_end() __attribute__((always_inline));
+inline void readEnd() __attribute__((always_inline));
+
+void        dmaQueue(const uint8_t *data, uint32_t len),
+            dmaRetire(void);
 
 void        writeBytes_(uint8_t * data, uint8_t size);
 inline void setDataBits(uint16_t bits);
@@ -413,7 +634,57 @@ inline void setDataBits(uint16_t bits);
   uint8_t  tabcolor,
            colstart = 0, rowstart = 0; // some ST7735 displays need this changed
 
-  boolean  hwSPI;
+  boolean  hwSPI,
+           inTransaction; // SPI bus is held and TFT chip select is low
+
+  uint8_t  writeDepth;    // Nesting depth of startWrite() calls
+
+  boolean  charMetrics(uint16_t c, uint8_t font, int16_t *xAdvance, int16_t *ink0, int16_t *ink1);
+  void     circleRuns(int32_t x0, int32_t y0, int32_t xa, int32_t xb, int32_t r, uint8_t corners, uint32_t color);
+  void     polygonRows(const TFT_Point *points, uint16_t n, uint32_t color, uint8_t rule,
+                       TFT_PolyEdge *edge, TFT_PolyEdge **active, int32_t *spanX0, int32_t *spanX1);
+  void     blendPair(int32_t x, int32_t y, boolean across, uint8_t a0, uint8_t a1, uint32_t color, int32_t bg),
+           smoothLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color, int32_t bg),
+           smoothArc(int32_t x0, int32_t y0, int32_t r, int32_t start, int32_t end, uint32_t color, int32_t bg);
+
+#ifdef LOAD_GFXFF
+  int32_t  glyphIndex(uint16_t c);   // Index of the glyph for c in gfxFont, -1 if none
+  uint16_t nextChar(const char **string); // Next free font character code of a string
+  int8_t   kerning(uint16_t left, uint16_t right); // x advance adjustment of a pair
+  int32_t  layoutString(const char *string, TFT_GlyphPos *pos, uint16_t *count, uint16_t max = 0xFFFF);
+  TFT_GlyphEntry* glyphCacheGet(const GFXfont *font, uint16_t c); // NULL if it does not fit
+  int16_t  drawFreeFontOpaque(const TFT_GlyphPos *pos, uint16_t count, int32_t x, int32_t y, int32_t w),
+           drawSmoothString(const TFT_GlyphPos *pos, uint16_t count, int32_t x, int32_t y, int32_t w);
+  void     drawSmoothGlyph(int32_t x, int32_t y, const uint8_t *alpha, uint8_t w, uint8_t h,
+                           uint32_t fg, uint32_t bg, uint8_t size),
+           pushAlphaRow(const uint8_t *alpha, int32_t x, uint8_t size, int32_t xs, int32_t xe),
+           blendTable(uint16_t fg, uint16_t bg);
+
+  boolean  smoothFont;   // gfxFont points to a SmoothFont
+  uint16_t blendFg, blendBg,
+           blendLut[16]; // blendFg over blendBg at each coverage, in pushColors() byte order
+
+  const GFXkern *kernPairs; // Kerning pairs of gfxFont, NULL if none
+  uint16_t kernCount,
+           kernLast;     // Last character printed, for kerning in write()
+
+  uint8_t  *glyphCache;   // Glyph entries, packed from the start
+  uint32_t glyphCacheSize, glyphCacheUsed, glyphCacheTick;
+#endif
+
+#ifdef LOAD_UNICODE
+  uint32_t utf8Code;      // decodeUTF8() stream state, the bits received so far
+  uint8_t  utf8Count;     // and the number of continuation bytes still to come
+#endif
+
+  boolean  dmaEnabled;    // initDMA() succeeded
+  uint8_t  dmaQueued;     // DMA transfers queued and not yet retired
+
+#if defined (ESP32) && defined (ESP32_DMA)
+  spi_device_handle_t dmaDevice;
+  spi_transaction_t   dmaTrans[2]; // Ping-pong transaction descriptors
+  uint8_t             dmaNext;
+#endif
 
   volatile uint32_t *dcport, *csport;//, *mosiport, *clkport, *rsport;
   //int32_t  _cs, _dc, _rst, _mosi, _miso, _sclk;
@@ -427,10 +698,12 @@ inline void setDataBits(uint16_t bits);
 
  protected:
 
-  int32_t  cursor_x, cursor_y, win_xe, win_ye, padX;
+  int32_t  cursor_x, cursor_y, padX,
+           win_xe, win_ye;  // Address window end column and row last sent to the TFT
 
   uint32_t _width, _height, // Display w/h as modified by current rotation
-           textcolor, textbgcolor, fontsloaded, addr_row, addr_col;
+           textcolor, textbgcolor, fontsloaded,
+           addr_row, addr_col; // Address window start row and column, 0xFFFF = not known
 
   uint8_t  glyph_ab,  // glyph height above baseline
            glyph_bb,  // glyph height below baseline
@@ -448,6 +721,18 @@ inline void setDataBits(uint16_t bits);
 
 };
 
+// Sprite class, graphics are drawn into RAM and then pushed to the TFT in one go
+#include <Extensions/Sprite.h>
+
+// Display list class, a scene is recorded and then rendered in strips through a Sprite
+#include <Extensions/DisplayList.h>
+
+// Number field class, a number is updated by redrawing only the characters that change
+#include <Extensions/NumberField.h>
+
+// Text box class, text is broken into lines that fit a box and aligned in it
+#include <Extensions/TextBox.h>
+
 #endif
 
 /***************************************************
@@ -0,0 +1,911 @@
+/***************************************************************************************
+// Font compiler, converts a TrueType (.ttf) or BDF (.bdf) font into the font formats
+// used by the library, subset to the characters that are needed.
+//
+// This is a host (e.g. Linux PC) command line program, it is not part of the Arduino
+// library build. It only needs a C++11 compiler:
+//
+//   g++ -std=gnu++11 -O2 -o font_compiler Tools/Font_Compiler/font_compiler.cpp
+//
+// Usage:
+//
+//   font_compiler [options] font.ttf|font.bdf
+//
+//   -s <pixels>  Em size in pixels for a TrueType font (default 24), BDF fonts are
+//                used at their own size
+//   -c <chars>   Characters to include as UTF-8, e.g. "0123456789:.-" (default ASCII
+//                32 to 126), a-b includes the range a to b, use \- for a minus sign
+//   -f <format>  gfx    free font header for setFreeFont(), 1 bit per pixel
+//                smooth anti-aliased header for setSmoothFont(), 4 bits per pixel
+//                rle    run length encoded .c and .h files in the layout of the
+//                       numbered fonts (Font 4, 6, 7 and 8)
+//                sizes  print the FLASH size of each format and write nothing
+//   -n <name>    Name of the font in the tables (default from the file name), for
+//                the rle format the tables are chrtbl_<name>, widtbl_<name> etc.
+//   -o <file>    Output file name without extension (default the name)
+//
+// TrueType glyphs are rasterised with 16 sub-scanlines per pixel row and exact
+// horizontal coverage. The 1 bit formats use the pixels that are at least half
+// covered. Simple and composite glyphs are supported, hinting is not.
+// The kerning pairs of the 'kern' table (not GPOS) are written with the gfx and
+// smooth fonts, see setKerning().
+//
+// The gfx and smooth fonts cover the character codes from the lowest to the highest
+// subset character, codes in between that are not in the subset have an empty glyph
+// (7 bytes). If there are characters above 0xFF the font has a table of the ranges of
+// consecutive codes instead, and only the subset has glyphs. These fonts need
+// LOAD_UNICODE to be defined in the setup file. In an rle font the characters that are
+// not in the subset are drawn as a space, as in Font 7, so the space is added to the
+// subset if -c does not include it.
+***************************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+// A glyph at the requested size, coverage 0 to 15 per pixel
+struct Glyph {
+  int code;
+  int w, h;           // Bitmap size
+  int xo, yo;         // Top left corner of the bitmap relative to the origin on the baseline
+  int advance;        // x advance in pixels
+  std::vector<uint8_t> alpha;
+};
+
+// A kerning pair, the x advance of left is adjusted by x pixels when right follows it
+struct Kern {
+  int left, right, x;
+  bool operator<(const Kern &k) const { return (left < k.left) || ((left == k.left) && (right < k.right)); }
+};
+
+// The glyphs of the subset and the font metrics in pixels
+struct Font {
+  int ascent, descent, lineHeight; // descent is positive below the baseline
+  std::vector<Glyph> glyphs;       // In code order
+  std::vector<Kern>  kerns;        // In left then right order
+};
+
+static void fail(const char *msg, const char *arg = "")
+{
+  fprintf(stderr, "font_compiler: %s%s\n", msg, arg);
+  exit(1);
+}
+
+
+/***************************************************************************************
+** Function name:           readFile
+** Description:             read a whole file into memory
+***************************************************************************************/
+static std::vector<uint8_t> readFile(const char *path)
+{
+  FILE *f = fopen(path, "rb");
+  if (!f) fail("cannot open ", path);
+  std::vector<uint8_t> data;
+  uint8_t buf[4096];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) data.insert(data.end(), buf, buf + n);
+  fclose(f);
+  return data;
+}
+
+
+/***************************************************************************************
+** Function name:           trim
+** Description:             reduce a glyph bitmap to the bounding box of its pixels
+***************************************************************************************/
+// minAlpha is the lowest coverage that is kept, 8 for the 1 bit formats
+static Glyph trim(const Glyph &g, int minAlpha)
+{
+  int x0 = g.w, y0 = g.h, x1 = -1, y1 = -1;
+  for (int y = 0; y < g.h; y++)
+    for (int x = 0; x < g.w; x++)
+      if (g.alpha[y * g.w + x] >= minAlpha) {
+        x0 = std::min(x0, x); x1 = std::max(x1, x);
+        y0 = std::min(y0, y); y1 = std::max(y1, y);
+      }
+
+  Glyph t = g;
+  if (x1 < 0) { t.w = t.h = 0; t.xo = 0; t.yo = 1; t.alpha.clear(); return t; } // Empty, as fontconvert
+
+  t.w = x1 - x0 + 1; t.h = y1 - y0 + 1;
+  t.xo = g.xo + x0;  t.yo = g.yo + y0;
+  t.alpha.resize(t.w * t.h);
+  for (int y = 0; y < t.h; y++)
+    for (int x = 0; x < t.w; x++) {
+      uint8_t a = g.alpha[(y0 + y) * g.w + x0 + x];
+      t.alpha[y * t.w + x] = (a >= minAlpha) ? a : 0;
+    }
+  return t;
+}
+
+
+/***************************************************************************************
+// TrueType reader and rasteriser
+***************************************************************************************/
+
+struct Point { double x, y; };
+struct Edge  { double x0, y0, x1, y1; int dir; };
+
+struct TrueType {
+  std::vector<uint8_t> d;
+  uint32_t glyf, loca, hmtx, cmap, kern;
+  int unitsPerEm, locaLong, numGlyphs, numHMetrics;
+  int ascender, descender, lineGap;
+
+  uint32_t u32(uint32_t o) const { if (o + 4 > d.size()) fail("truncated TrueType file"); return (d[o] << 24) | (d[o + 1] << 16) | (d[o + 2] << 8) | d[o + 3]; }
+  uint16_t u16(uint32_t o) const { if (o + 2 > d.size()) fail("truncated TrueType file"); return (d[o] << 8) | d[o + 1]; }
+  int16_t  s16(uint32_t o) const { return (int16_t)u16(o); }
+  uint8_t  u8 (uint32_t o) const { if (o >= d.size()) fail("truncated TrueType file"); return d[o]; }
+
+  uint32_t table(const char *tag) const
+  {
+    int n = u16(4);
+    for (int i = 0; i < n; i++) {
+      uint32_t r = 12 + 16 * i;
+      if (memcmp(&d[r], tag, 4) == 0) return u32(r + 8);
+    }
+    return 0;
+  }
+
+  void load(const char *path)
+  {
+    d = readFile(path);
+    uint32_t head = table("head"), maxp = table("maxp"), hhea = table("hhea");
+    glyf = table("glyf"); loca = table("loca"); hmtx = table("hmtx"); cmap = table("cmap");
+    kern = table("kern");
+    if (!head || !maxp || !hhea || !glyf || !loca || !hmtx || !cmap) fail("not a TrueType outline font: ", path);
+
+    unitsPerEm  = u16(head + 18);
+    locaLong    = s16(head + 50);
+    numGlyphs   = u16(maxp + 4);
+    ascender    = s16(hhea + 4);
+    descender   = s16(hhea + 6);
+    lineGap     = s16(hhea + 8);
+    numHMetrics = u16(hhea + 34);
+  }
+
+  // Glyph index of a character code, 0 (missing glyph) if there is none
+  int glyphIndex(uint32_t code) const
+  {
+    int n = u16(cmap + 2);
+    uint32_t sub4 = 0, sub12 = 0;
+    for (int i = 0; i < n; i++) {
+      uint32_t r = cmap + 4 + 8 * i;
+      int platform = u16(r), encoding = u16(r + 2);
+      uint32_t sub = cmap + u32(r + 4);
+      int format = u16(sub);
+      if ((format == 4) && ((platform == 3 && encoding == 1) || platform == 0)) sub4 = sub;
+      if ((format == 12) && ((platform == 3 && encoding == 10) || platform == 0)) sub12 = sub;
+    }
+
+    if (sub12) {
+      uint32_t groups = u32(sub12 + 12);
+      for (uint32_t i = 0; i < groups; i++) {
+        uint32_t g = sub12 + 16 + 12 * i;
+        if ((code >= u32(g)) && (code <= u32(g + 4))) return u32(g + 8) + code - u32(g);
+      }
+      return 0;
+    }
+    if (!sub4 || code > 0xFFFF) return 0;
+
+    int segs = u16(sub4 + 6) / 2;
+    uint32_t ends = sub4 + 14, starts = ends + 2 * segs + 2,
+             deltas = starts + 2 * segs, offsets = deltas + 2 * segs;
+    for (int i = 0; i < segs; i++) {
+      if (code > u16(ends + 2 * i)) continue;
+      if (code < u16(starts + 2 * i)) return 0;
+      int ro = u16(offsets + 2 * i);
+      if (ro == 0) return (code + u16(deltas + 2 * i)) & 0xFFFF;
+      uint32_t p = offsets + 2 * i + ro + 2 * (code - u16(starts + 2 * i));
+      int g = u16(p);
+      return g ? (g + u16(deltas + 2 * i)) & 0xFFFF : 0;
+    }
+    return 0;
+  }
+
+  // Kerning of a glyph pair in font units from a format 0 'kern' table, 0 if none
+  int kerning(int left, int right) const
+  {
+    if (!kern || u16(kern)) return 0; // Only the version 0 (Windows) table is read
+    int value = 0, n = u16(kern + 2);
+    uint32_t sub = kern + 4;
+    for (int t = 0; t < n; t++, sub += u16(sub + 2)) {
+      int coverage = u16(sub + 4);
+      if ((coverage >> 8) || ((coverage & 0x07) != 0x01)) continue; // Horizontal format 0 only
+      uint32_t key = (left << 16) | right;
+      int lo = 0, hi = u16(sub + 6);
+      while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        uint32_t pair = u32(sub + 14 + 6 * mid);
+        if (key < pair) hi = mid;
+        else if (key > pair) lo = mid + 1;
+        else { value += s16(sub + 18 + 6 * mid); break; }
+      }
+    }
+    return value;
+  }
+
+  int advance(int index) const
+  {
+    if (index >= numHMetrics) index = numHMetrics - 1;
+    return u16(hmtx + 4 * index);
+  }
+
+  // Append the contours of a glyph as closed polygons in font units, quadratic curves
+  // are flattened. m is a 2 x 2 transform followed by an offset.
+  void outline(int index, const double *m, std::vector<std::vector<Point> > &contours, int depth = 0) const
+  {
+    if ((index >= numGlyphs) || (depth > 8)) return;
+    uint32_t start = locaLong ? u32(loca + 4 * index) : 2 * u16(loca + 2 * index);
+    uint32_t end   = locaLong ? u32(loca + 4 * index + 4) : 2 * u16(loca + 2 * index + 2);
+    if (start == end) return; // No outline, e.g. space
+    uint32_t g = glyf + start;
+
+    int n = s16(g);
+    if (n < 0) { // Composite glyph
+      uint32_t p = g + 10;
+      uint16_t flags;
+      do {
+        flags = u16(p);
+        int sub = u16(p + 2);
+        p += 4;
+        double dx, dy;
+        if (flags & 0x0001) { dx = s16(p); dy = s16(p + 2); p += 4; }
+        else                { dx = (int8_t)u8(p); dy = (int8_t)u8(p + 1); p += 2; }
+        double a = 1, b = 0, c = 0, dd = 1;
+        if (flags & 0x0008)      { a = dd = s16(p) / 16384.0; p += 2; }
+        else if (flags & 0x0040) { a = s16(p) / 16384.0; dd = s16(p + 2) / 16384.0; p += 4; }
+        else if (flags & 0x0080) { a = s16(p) / 16384.0; b = s16(p + 2) / 16384.0;
+                                   c = s16(p + 4) / 16384.0; dd = s16(p + 6) / 16384.0; p += 8; }
+        if (!(flags & 0x0002)) dx = dy = 0; // Point matching is not supported
+
+        // Combine with the parent transform
+        double mm[6] = { m[0] * a + m[2] * b, m[1] * a + m[3] * b,
+                         m[0] * c + m[2] * dd, m[1] * c + m[3] * dd,
+                         m[0] * dx + m[2] * dy + m[4], m[1] * dx + m[3] * dy + m[5] };
+        outline(sub, mm, contours, depth + 1);
+      } while (flags & 0x0020);
+      return;
+    }
+
+    // Simple glyph
+    std::vector<int> ends(n);
+    for (int i = 0; i < n; i++) ends[i] = u16(g + 10 + 2 * i);
+    int points = n ? ends[n - 1] + 1 : 0;
+    uint32_t p = g + 10 + 2 * n;
+    p += 2 + u16(p); // Skip the instructions
+
+    std::vector<uint8_t> flags(points);
+    for (int i = 0; i < points; ) {
+      uint8_t f = u8(p++);
+      flags[i++] = f;
+      if (f & 0x08) { int r = u8(p++); while (r-- && i < points) flags[i++] = f; }
+    }
+    std::vector<Point> pt(points);
+    int v = 0;
+    for (int i = 0; i < points; i++) {
+      uint8_t f = flags[i];
+      if (f & 0x02)       { v += (f & 0x10) ? u8(p) : -u8(p); p++; }
+      else if (!(f & 0x10)) { v += s16(p); p += 2; }
+      pt[i].x = v;
+    }
+    v = 0;
+    for (int i = 0; i < points; i++) {
+      uint8_t f = flags[i];
+      if (f & 0x04)       { v += (f & 0x20) ? u8(p) : -u8(p); p++; }
+      else if (!(f & 0x20)) { v += s16(p); p += 2; }
+      pt[i].y = v;
+    }
+    for (int i = 0; i < points; i++) {
+      double x = pt[i].x, y = pt[i].y;
+      pt[i].x = m[0] * x + m[2] * y + m[4];
+      pt[i].y = m[1] * x + m[3] * y + m[5];
+    }
+
+    int first = 0;
+    for (int c = 0; c < n; c++) {
+      int last = ends[c], count = last - first + 1;
+      std::vector<Point> poly;
+      if (count < 2) { first = last + 1; continue; }
+
+      // Start on an on-curve point, or the midpoint of two off-curve points
+      int s = 0;
+      while ((s < count) && !(flags[first + s] & 1)) s++;
+      Point start;
+      if (s == count) {
+        start.x = (pt[first].x + pt[first + 1].x) / 2;
+        start.y = (pt[first].y + pt[first + 1].y) / 2;
+        s = 0;
+      }
+      else { start = pt[first + s]; s++; }
+      poly.push_back(start);
+
+      Point ctrl = start;
+      bool haveCtrl = false;
+      for (int k = 0; k <= count; k++) {
+        int i = first + (s + k) % count;
+        Point q = (k == count) ? start : pt[i];
+        bool on = (k == count) || (flags[i] & 1);
+        if (!on) {
+          if (haveCtrl) { // Implied on-curve point between two controls
+            Point mid = { (ctrl.x + q.x) / 2, (ctrl.y + q.y) / 2 };
+            curve(poly, ctrl, mid);
+          }
+          ctrl = q; haveCtrl = true;
+        }
+        else {
+          if (haveCtrl) curve(poly, ctrl, q);
+          else poly.push_back(q);
+          haveCtrl = false;
+        }
+        if (k == count && !on) break;
+      }
+      if (haveCtrl) curve(poly, ctrl, start);
+      contours.push_back(poly);
+      first = last + 1;
+    }
+  }
+
+  // Flatten a quadratic curve from the last point of poly
+  static void curve(std::vector<Point> &poly, Point c, Point e)
+  {
+    Point s = poly.back();
+    const int steps = 16;
+    for (int i = 1; i <= steps; i++) {
+      double t = (double)i / steps, u = 1 - t;
+      Point p = { u * u * s.x + 2 * u * t * c.x + t * t * e.x,
+                  u * u * s.y + 2 * u * t * c.y + t * t * e.y };
+      poly.push_back(p);
+    }
+  }
+};
+
+
+/***************************************************************************************
+** Function name:           rasterise
+** Description:             render polygons in pixel coordinates to 4 bit coverage
+***************************************************************************************/
+// y increases down the screen, the bitmap covers the pixels the polygons touch. The
+// non-zero winding rule is used, as TrueType requires.
+static void rasterise(const std::vector<std::vector<Point> > &contours, Glyph &g)
+{
+  std::vector<Edge> edges;
+  double minX = 1e9, minY = 1e9, maxX = -1e9, maxY = -1e9;
+  for (size_t c = 0; c < contours.size(); c++) {
+    const std::vector<Point> &p = contours[c];
+    for (size_t i = 0; i < p.size(); i++) {
+      const Point &a = p[i], &b = p[(i + 1) % p.size()];
+      minX = std::min(minX, a.x); maxX = std::max(maxX, a.x);
+      minY = std::min(minY, a.y); maxY = std::max(maxY, a.y);
+      if (a.y == b.y) continue;
+      Edge e = { a.x, a.y, b.x, b.y, (b.y > a.y) ? 1 : -1 };
+      edges.push_back(e);
+    }
+  }
+  if (edges.empty()) { g.w = g.h = 0; g.xo = 0; g.yo = 1; return; }
+
+  int x0 = (int)floor(minX), y0 = (int)floor(minY);
+  g.w = (int)ceil(maxX) - x0; g.h = (int)ceil(maxY) - y0;
+  if (g.w < 1) g.w = 1;
+  if (g.h < 1) g.h = 1;
+  g.xo = x0; g.yo = y0;
+
+  std::vector<double> cov(g.w * g.h, 0.0);
+  const int sub = 16;
+  std::vector<std::pair<double, int> > cross;
+
+  for (int row = 0; row < g.h; row++) {
+    for (int s = 0; s < sub; s++) {
+      double y = y0 + row + (s + 0.5) / sub;
+      cross.clear();
+      for (size_t i = 0; i < edges.size(); i++) {
+        const Edge &e = edges[i];
+        double ya = std::min(e.y0, e.y1), yb = std::max(e.y0, e.y1);
+        if ((y < ya) || (y >= yb)) continue;
+        double x = e.x0 + (y - e.y0) * (e.x1 - e.x0) / (e.y1 - e.y0);
+        cross.push_back(std::make_pair(x, e.dir));
+      }
+      std::sort(cross.begin(), cross.end());
+
+      int wind = 0;
+      for (size_t i = 0; i + 1 < cross.size(); i++) {
+        wind += cross[i].second;
+        if (!wind) continue;
+        // Inside from cross[i] to cross[i + 1], add the area of each pixel covered
+        double xa = cross[i].first - x0, xb = cross[i + 1].first - x0;
+        for (int px = std::max(0, (int)floor(xa)); px < g.w && px < xb; px++) {
+          double l = std::max(xa, (double)px), r = std::min(xb, (double)px + 1);
+          if (r > l) cov[row * g.w + px] += (r - l) / sub;
+        }
+      }
+    }
+  }
+
+  g.alpha.resize(g.w * g.h);
+  for (int i = 0; i < g.w * g.h; i++) {
+    int a = (int)floor(cov[i] * 15 + 0.5);
+    g.alpha[i] = (uint8_t)std::min(15, std::max(0, a));
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           loadTrueType
+** Description:             rasterise the subset of a TrueType font at an em size
+***************************************************************************************/
+static Font loadTrueType(const char *path, int pixels, const std::vector<int> &codes)
+{
+  TrueType tt;
+  tt.load(path);
+  double scale = (double)pixels / tt.unitsPerEm;
+
+  Font font;
+  font.ascent     = (int)ceil(tt.ascender * scale);
+  font.descent    = (int)ceil(-tt.descender * scale);
+  font.lineHeight = (int)floor((tt.ascender - tt.descender + tt.lineGap) * scale + 0.5);
+
+  for (size_t i = 0; i < codes.size(); i++) {
+    int index = tt.glyphIndex(codes[i]);
+    if (!index) fprintf(stderr, "font_compiler: no glyph for 0x%02X, the missing glyph is used\n", codes[i]);
+
+    double m[6] = { scale, 0, 0, -scale, 0, 0 }; // Font units to pixels, y down
+    std::vector<std::vector<Point> > contours;
+    tt.outline(index, m, contours);
+
+    Glyph g;
+    g.code    = codes[i];
+    g.advance = (int)floor(tt.advance(index) * scale + 0.5);
+    rasterise(contours, g);
+    font.glyphs.push_back(g);
+  }
+
+  // Kerning pairs of the subset that move a glyph by a pixel or more
+  for (size_t l = 0; tt.kern && (l < codes.size()); l++)
+    for (size_t r = 0; r < codes.size(); r++) {
+      int x = (int)floor(tt.kerning(tt.glyphIndex(codes[l]), tt.glyphIndex(codes[r])) * scale + 0.5);
+      if (x < -128) x = -128;
+      if (x > 127) x = 127;
+      if (x) { Kern k = { codes[l], codes[r], x }; font.kerns.push_back(k); }
+    }
+  return font;
+}
+
+
+/***************************************************************************************
+** Function name:           loadBDF
+** Description:             read the subset of a BDF bitmap font
+***************************************************************************************/
+static Font loadBDF(const char *path, const std::vector<int> &codes)
+{
+  std::vector<uint8_t> data = readFile(path);
+  std::string text(data.begin(), data.end());
+
+  Font font;
+  font.ascent = font.descent = 0;
+  std::vector<Glyph> all;
+  Glyph g;
+  int bbw = 0, bbh = 0, bbx = 0, bby = 0, rows = -1;
+
+  size_t pos = 0;
+  while (pos < text.size()) {
+    size_t eol = text.find('\n', pos);
+    if (eol == std::string::npos) eol = text.size();
+    std::string line = text.substr(pos, eol - pos);
+    pos = eol + 1;
+    if (!line.empty() && line[line.size() - 1] == '\r') line.erase(line.size() - 1);
+    const char *l = line.c_str();
+
+    if (rows >= 0) { // Bitmap row in hex
+      if (strncmp(l, "ENDCHAR", 7) == 0) {
+        rows = -1;
+        if (g.code >= 0) all.push_back(g);
+        continue;
+      }
+      if (rows < bbh) {
+        for (int x = 0; x < bbw; x++) {
+          int nibble = x >> 2;
+          if (nibble >= (int)strlen(l)) break;
+          int v = strtol(std::string(1, l[nibble]).c_str(), NULL, 16);
+          if (v & (8 >> (x & 3))) g.alpha[rows * bbw + x] = 15;
+        }
+      }
+      rows++;
+      continue;
+    }
+
+    if (sscanf(l, "FONT_ASCENT %d", &font.ascent) == 1) continue;
+    if (sscanf(l, "FONT_DESCENT %d", &font.descent) == 1) continue;
+    if (strncmp(l, "STARTCHAR", 9) == 0) { g = Glyph(); g.code = -1; g.advance = 0; continue; }
+    if (sscanf(l, "ENCODING %d", &g.code) == 1) continue;
+    if (sscanf(l, "DWIDTH %d", &g.advance) == 1) continue;
+    if (sscanf(l, "BBX %d %d %d %d", &bbw, &bbh, &bbx, &bby) == 4) {
+      g.w = bbw; g.h = bbh;
+      g.xo = bbx; g.yo = -(bby + bbh); // BDF offsets are to the bottom left corner, y up
+      g.alpha.assign(bbw * bbh, 0);
+      continue;
+    }
+    if (strncmp(l, "BITMAP", 6) == 0) rows = 0;
+  }
+  font.lineHeight = font.ascent + font.descent;
+
+  for (size_t i = 0; i < codes.size(); i++) {
+    size_t j = 0;
+    while ((j < all.size()) && (all[j].code != codes[i])) j++;
+    if (j == all.size()) {
+      fprintf(stderr, "font_compiler: no glyph for 0x%02X, an empty glyph is used\n", codes[i]);
+      Glyph e; e.code = codes[i]; e.w = e.h = 0; e.xo = 0; e.yo = 1; e.advance = 0;
+      font.glyphs.push_back(e);
+    }
+    else font.glyphs.push_back(all[j]);
+  }
+  return font;
+}
+
+
+/***************************************************************************************
+// Output formats
+***************************************************************************************/
+
+// Write bytes as a C array body, 12 per line as in the free font files
+static void writeBytes(FILE *f, const std::vector<uint8_t> &b)
+{
+  for (size_t i = 0; i < b.size(); i++) {
+    fprintf(f, "%s0x%02X%s", (i % 12) ? " " : "  ", b[i],
+            (i + 1 == b.size()) ? " };\n" : ((i % 12 == 11) ? ",\n" : ","));
+  }
+  if (b.empty()) fprintf(f, "  0x00 };\n");
+}
+
+static std::string charComment(int code)
+{
+  char s[24];
+  if ((code >= 32) && (code < 127)) snprintf(s, sizeof(s), "0x%02X '%c'", code, code);
+  else if (code < 0xA0) snprintf(s, sizeof(s), "0x%02X", code);
+  else if (code < 0x800) snprintf(s, sizeof(s), "0x%04X '%c%c'", code, 0xC0 | (code >> 6), 0x80 | (code & 0x3F));
+  else snprintf(s, sizeof(s), "0x%04X '%c%c%c'", code, 0xE0 | (code >> 12), 0x80 | ((code >> 6) & 0x3F), 0x80 | (code & 0x3F));
+  return s;
+}
+
+
+/***************************************************************************************
+** Function name:           buildFree
+** Description:             make the bitmaps and glyph table of a gfx or smooth font
+***************************************************************************************/
+// bpp is 1 or 4. Returns the glyph table rows, the codes from first to last, or only
+// the subset codes if ranged is set.
+static std::vector<Glyph> buildFree(const Font &font, int bpp, bool ranged, std::vector<uint8_t> &bitmap,
+                                    std::vector<uint16_t> &offsets)
+{
+  int first = font.glyphs.front().code, last = font.glyphs.back().code;
+  std::vector<Glyph> table;
+
+  for (int code = first; code <= last; code++) {
+    Glyph g;
+    g.code = code; g.w = g.h = 0; g.xo = 0; g.yo = 1; g.advance = 0;
+    bool found = false;
+    for (size_t i = 0; i < font.glyphs.size(); i++)
+      if (font.glyphs[i].code == code) { g = trim(font.glyphs[i], (bpp == 1) ? 8 : 1); found = true; }
+    if (ranged && !found) continue;
+
+    if (bitmap.size() > 0xFFFF) fail("the bitmaps are larger than 64 kbytes, use fewer characters or a smaller size");
+    if ((g.w > 255) || (g.h > 255) || (g.advance > 255) || (g.xo < -128) || (g.xo > 127) ||
+        (g.yo < -128) || (g.yo > 127)) fail("a glyph is too large for the glyph table: ", charComment(code).c_str());
+
+    offsets.push_back((uint16_t)bitmap.size());
+
+    // Bits or nibbles row after row, the glyph starts on a byte boundary
+    uint32_t acc = 0; int bits = 0;
+    for (int i = 0; i < g.w * g.h; i++) {
+      uint8_t v = (bpp == 1) ? (g.alpha[i] >= 8) : g.alpha[i];
+      acc = (acc << bpp) | v; bits += bpp;
+      if (bits == 8) { bitmap.push_back(acc); acc = 0; bits = 0; }
+    }
+    if (bits) bitmap.push_back(acc << (8 - bits));
+
+    table.push_back(g);
+  }
+  return table;
+}
+
+
+/***************************************************************************************
+** Function name:           writeFree
+** Description:             write a gfx (GFXfont) or smooth (SmoothFont) header
+***************************************************************************************/
+static uint32_t writeFree(const Font &font, int bpp, const std::string &name, const std::string &out, const char *source)
+{
+  std::vector<uint8_t>  bitmap;
+  std::vector<uint16_t> offsets;
+  bool ranged = font.glyphs.back().code > 0xFF;
+  std::vector<Glyph> table = buildFree(font, bpp, ranged, bitmap, offsets);
+
+  // Ranges of consecutive codes as first, last and glyph index
+  std::vector<int> ranges;
+  for (size_t i = 0; ranged && (i < table.size()); i++) {
+    if (!ranges.empty() && (ranges[ranges.size() - 2] + 1 == table[i].code)) ranges[ranges.size() - 2]++;
+    else { ranges.push_back(table[i].code); ranges.push_back(table[i].code); ranges.push_back(i); }
+  }
+
+  uint32_t size = bitmap.size() + 7 * table.size() + (ranged ? 14 : 7) + 2 * ranges.size() + 6 * font.kerns.size();
+  if (out.empty()) return size;
+
+  std::string path = out + ".h";
+  FILE *f = fopen(path.c_str(), "w");
+  if (!f) fail("cannot write ", path.c_str());
+
+  fprintf(f, "// Converted from %s by font_compiler, %s\n\n", source,
+          (bpp == 1) ? "use with setFreeFont()" : "4 bit coverage per pixel, use with setSmoothFont()");
+  if (ranged) fprintf(f, "#ifndef LOAD_UNICODE\n  #error This font has Unicode character ranges, define LOAD_UNICODE in the setup file\n#endif\n\n");
+  fprintf(f, "const uint8_t %sBitmaps[] PROGMEM = {\n", name.c_str());
+  writeBytes(f, bitmap);
+
+  fprintf(f, "\nconst GFXglyph %sGlyphs[] PROGMEM = {\n", name.c_str());
+  for (size_t i = 0; i < table.size(); i++) {
+    const Glyph &g = table[i];
+    fprintf(f, "  { %5d, %3d, %3d, %3d, %4d, %4d }%s   // %s\n", offsets[i], g.w, g.h, g.advance,
+            g.xo, g.yo, (i + 1 == table.size()) ? " };" : ",", charComment(g.code).c_str());
+  }
+
+  if (ranged) {
+    fprintf(f, "\nconst GFXrange %sRanges[] PROGMEM = {\n", name.c_str());
+    for (size_t i = 0; i < ranges.size(); i += 3)
+      fprintf(f, "  { 0x%04X, 0x%04X, %4d }%s\n", ranges[i], ranges[i + 1], ranges[i + 2],
+              (i + 3 == ranges.size()) ? " };" : ",");
+  }
+
+  fprintf(f, "\nconst %s %s PROGMEM = {\n", (bpp == 1) ? "GFXfont" : "SmoothFont", name.c_str());
+  fprintf(f, "  (uint8_t  *)%sBitmaps,\n", name.c_str());
+  fprintf(f, "  (GFXglyph *)%sGlyphs,\n", name.c_str());
+  if (ranged) {
+    fprintf(f, "  0x00, 0x00, %d,\n", font.lineHeight); // first and last are not used
+    fprintf(f, "  (GFXrange *)%sRanges, %u };\n\n", name.c_str(), (unsigned)ranges.size() / 3);
+  }
+  else fprintf(f, "  0x%02X, 0x%02X, %d };\n\n", table.front().code, table.back().code, font.lineHeight);
+
+  if (!font.kerns.empty()) {
+    fprintf(f, "// Kerning pairs, use with setKerning(%sKerning, %sKerningPairs) after selecting the font\n",
+            name.c_str(), name.c_str());
+    fprintf(f, "const GFXkern %sKerning[] PROGMEM = {\n", name.c_str());
+    for (size_t i = 0; i < font.kerns.size(); i++) {
+      const Kern &k = font.kerns[i];
+      fprintf(f, "  { 0x%04X, 0x%04X, %4d }%s   // %s %s\n", k.left, k.right, k.x,
+              (i + 1 == font.kerns.size()) ? " };" : ",", charComment(k.left).c_str(), charComment(k.right).c_str());
+    }
+    fprintf(f, "\nconst uint16_t %sKerningPairs = %u;\n\n", name.c_str(), (unsigned)font.kerns.size());
+  }
+
+  fprintf(f, "// Approx. %u bytes\n", size);
+  fclose(f);
+  return size;
+}
+
+
+/***************************************************************************************
+** Function name:           encodeRLE
+** Description:             run length encode a character cell
+***************************************************************************************/
+// The cell is width x height pixels with the baseline at row baseline. Each byte is a
+// run of 1 to 128 pixels, bit 7 set for foreground, running on across the rows.
+static std::vector<uint8_t> encodeRLE(const Glyph &g, int width, int height, int baseline)
+{
+  std::vector<uint8_t> cell(width * height, 0);
+  for (int y = 0; y < g.h; y++)
+    for (int x = 0; x < g.w; x++) {
+      int cx = g.xo + x, cy = baseline + g.yo + y;
+      if ((cx >= 0) && (cx < width) && (cy >= 0) && (cy < height) && (g.alpha[y * g.w + x] >= 8))
+        cell[cy * width + cx] = 1;
+    }
+
+  std::vector<uint8_t> rle;
+  for (size_t i = 0; i < cell.size(); ) {
+    size_t n = 1;
+    while ((i + n < cell.size()) && (n < 128) && (cell[i + n] == cell[i])) n++;
+    rle.push_back((cell[i] ? 0x80 : 0) | (n - 1));
+    i += n;
+  }
+  return rle;
+}
+
+
+/***************************************************************************************
+** Function name:           writeRLE
+** Description:             write the .c and .h files of an rle font
+***************************************************************************************/
+static uint32_t writeRLE(const Font &font, const std::string &name, const std::string &out, const char *source)
+{
+  int height = font.ascent + font.descent, baseline = font.ascent;
+  if ((height > 255) || (baseline > 255)) fail("the font is too tall for the rle format");
+
+  const Glyph *space = NULL;
+  for (size_t i = 0; i < font.glyphs.size(); i++)
+    if (font.glyphs[i].code == ' ') space = &font.glyphs[i];
+  if (!space) fail("the rle format needs a space and the font has no space glyph");
+
+  // Cells of the subset characters, the others use the space
+  std::vector<std::vector<uint8_t> > data;
+  std::vector<int> codes;
+  uint32_t size = 96 + 96 * 4; // Width table and 32 bit pointer table
+  for (size_t i = 0; i < font.glyphs.size(); i++) {
+    const Glyph &g = font.glyphs[i];
+    if ((g.code < 32) || (g.code > 127)) fail("the rle format only has characters 32 to 127");
+    if (g.advance > 255) fail("a character is too wide for the rle format: ", charComment(g.code).c_str());
+    data.push_back(encodeRLE(g, g.advance, height, baseline));
+    codes.push_back(g.code);
+    size += data.back().size();
+  }
+  if (out.empty()) return size;
+
+  std::string path = out + ".c";
+  FILE *f = fopen(path.c_str(), "w");
+  if (!f) fail("cannot write ", path.c_str());
+
+  fprintf(f, "// Converted from %s by font_compiler\n//\n", source);
+  fprintf(f, "// This font has been 8 bit Run Length Encoded to save FLASH space\n//\n");
+  fprintf(f, "// This font only contains characters");
+  for (size_t i = 0; i < codes.size(); i++) {
+    if (codes[i] == ' ') fprintf(f, " [space]");
+    else fprintf(f, " %c", codes[i]);
+  }
+  fprintf(f, "\n// All other characters print as a space\n\n#include <pgmspace.h>\n\n\n");
+
+  int width[96], index[96];
+  for (int c = 0; c < 96; c++) {
+    index[c] = -1;
+    for (size_t i = 0; i < codes.size(); i++) if (codes[i] == c + 32) index[c] = i;
+    width[c] = (index[c] >= 0) ? font.glyphs[index[c]].advance : space->advance;
+  }
+
+  fprintf(f, "PROGMEM const unsigned char widtbl_%s[96] =          // character width table\n{\n", name.c_str());
+  for (int c = 0; c < 96; c += 8) {
+    fprintf(f, "        ");
+    for (int k = 0; k < 8; k++) fprintf(f, "%d%s", width[c + k], (c + k == 95) ? "" : ", ");
+    fprintf(f, "%s    // char %d - %d\n", (c == 88) ? " " : "", c + 32, c + 39);
+  }
+  fprintf(f, "};\n\n// Row format, MSB left\n");
+
+  for (size_t i = 0; i < codes.size(); i++) {
+    fprintf(f, "\nPROGMEM const unsigned char chr_%s_%02X[] = \n{\n", name.c_str(), codes[i]);
+    const std::vector<uint8_t> &b = data[i];
+    for (size_t k = 0; k < b.size(); k++)
+      fprintf(f, "0x%02X%s", b[k], (k + 1 == b.size()) ? "\n" : ((k % 8 == 7) ? ", \n" : ", "));
+    fprintf(f, "};\n");
+  }
+
+  fprintf(f, "\nPROGMEM const unsigned char* const chrtbl_%s[96] =        // character pointer table\n{\n", name.c_str());
+  for (int c = 0; c < 96; c += 8) {
+    fprintf(f, "        ");
+    for (int k = 0; k < 8; k++)
+      fprintf(f, "chr_%s_%02X%s", name.c_str(), (index[c + k] >= 0) ? c + k + 32 : 0x20, (c + k == 95) ? "\n" : ", ");
+    if (c != 88) fprintf(f, "\n");
+  }
+  fprintf(f, "};\n");
+  fclose(f);
+
+  path = out + ".h";
+  f = fopen(path.c_str(), "w");
+  if (!f) fail("cannot write ", path.c_str());
+  std::string base = out.substr(out.find_last_of('/') + 1);
+  fprintf(f, "#include <Fonts/%s.c>\n\n", base.c_str());
+  fprintf(f, "#define nr_chrs_%s 96\n", name.c_str());
+  fprintf(f, "#define chr_hgt_%s %d\n", name.c_str(), height);
+  fprintf(f, "#define baseline_%s %d\n", name.c_str(), baseline);
+  fprintf(f, "#define data_size_%s 8\n", name.c_str());
+  fprintf(f, "#define firstchr_%s 32\n\n", name.c_str());
+  fprintf(f, "extern const unsigned char widtbl_%s[96];\n", name.c_str());
+  fprintf(f, "extern const unsigned char* const chrtbl_%s[96];\n", name.c_str());
+  fclose(f);
+  return size;
+}
+
+
+/***************************************************************************************
+** Function name:           parseChars
+** Description:             expand the -c character set into sorted character codes
+***************************************************************************************/
+static int decodeUTF8(const char *&s)
+{
+  int c = (uint8_t)*s++, n = 0;
+  if      ((c & 0xE0) == 0xC0) { c &= 0x1F; n = 1; }
+  else if ((c & 0xF0) == 0xE0) { c &= 0x0F; n = 2; }
+  else if ((c & 0xF8) == 0xF0) { c &= 0x07; n = 3; }
+  while (n-- && ((*s & 0xC0) == 0x80)) c = (c << 6) | (*s++ & 0x3F);
+  if (c > 0xFFFF) fail("characters above 0xFFFF are not supported");
+  return c;
+}
+
+static std::vector<int> parseChars(const char *s)
+{
+  std::vector<int> codes;
+  while (*s) {
+    if ((*s == '\\') && s[1]) { s++; codes.push_back(decodeUTF8(s)); continue; }
+    int c = decodeUTF8(s);
+    if ((s[0] == '-') && s[1]) {
+      s++;
+      int e = decodeUTF8(s);
+      for (int k = c; k <= e; k++) codes.push_back(k);
+      continue;
+    }
+    codes.push_back(c);
+  }
+  std::sort(codes.begin(), codes.end());
+  codes.erase(std::unique(codes.begin(), codes.end()), codes.end());
+  return codes;
+}
+
+
+int main(int argc, char **argv)
+{
+  int pixels = 24;
+  std::string chars, format = "gfx", name, out;
+  const char *path = NULL;
+
+  for (int i = 1; i < argc; i++) {
+    std::string a = argv[i];
+    if ((a.size() == 2) && (a[0] == '-') && (i + 1 < argc)) {
+      const char *v = argv[++i];
+      switch (a[1]) {
+        case 's': pixels = atoi(v); break;
+        case 'c': chars  = v; break;
+        case 'f': format = v; break;
+        case 'n': name   = v; break;
+        case 'o': out    = v; break;
+        default: fail("unknown option ", a.c_str());
+      }
+    }
+    else path = argv[i];
+  }
+  if (!path) {
+    fprintf(stderr, "usage: font_compiler [-s pixels] [-c chars] [-f gfx|smooth|rle|sizes] [-n name] [-o file] font.ttf|font.bdf\n");
+    return 1;
+  }
+  if (pixels < 4 || pixels > 200) fail("the size must be 4 to 200 pixels");
+
+  std::vector<int> codes = parseChars(chars.empty() ? " -~" : chars.c_str());
+
+  if (name.empty()) {
+    std::string p = path;
+    size_t s = p.find_last_of('/');
+    name = p.substr(s == std::string::npos ? 0 : s + 1);
+    name = name.substr(0, name.find('.'));
+    for (size_t i = 0; i < name.size(); i++) if (!isalnum((uint8_t)name[i])) name[i] = '_';
+    if (!strstr(path, ".bdf")) name += std::to_string(pixels) + "px";
+  }
+  if (out.empty()) out = name;
+
+  const char *source = strrchr(path, '/') ? strrchr(path, '/') + 1 : path;
+  bool bdf = strstr(path, ".bdf") || strstr(path, ".BDF");
+  // An rle font draws the characters that are not in the subset as a space
+  bool space = std::binary_search(codes.begin(), codes.end(), (int)' ');
+  if ((format == "rle") && !space) {
+    codes.insert(std::lower_bound(codes.begin(), codes.end(), (int)' '), (int)' ');
+    space = true;
+  }
+  Font font = bdf ? loadBDF(path, codes) : loadTrueType(path, pixels, codes);
+
+  if (format == "gfx")         fprintf(stderr, "%s.h: %u bytes\n", out.c_str(), writeFree(font, 1, name, out, source));
+  else if (format == "smooth") fprintf(stderr, "%s.h: %u bytes\n", out.c_str(), writeFree(font, 4, name, out, source));
+  else if (format == "rle")    fprintf(stderr, "%s.c: %u bytes\n", out.c_str(), writeRLE(font, name, out, source));
+  else if (format == "sizes") {
+    printf("%u characters\n", (unsigned)codes.size());
+    printf("gfx    %6u bytes\n", writeFree(font, 1, name, "", source));
+    printf("smooth %6u bytes\n", writeFree(font, 4, name, "", source));
+    bool rle = true;
+    for (size_t i = 0; i < codes.size(); i++) if ((codes[i] < 32) || (codes[i] > 127)) rle = false;
+    if (rle) {
+      if (!space) { // Sized with the space an rle font adds
+        codes.insert(std::lower_bound(codes.begin(), codes.end(), (int)' '), (int)' ');
+        font = bdf ? loadBDF(path, codes) : loadTrueType(path, pixels, codes);
+      }
+      printf("rle    %6u bytes\n", writeRLE(font, name, "", source));
+    }
+    else printf("rle    needs characters 32 to 127 only\n");
+  }
+  else fail("unknown format ", format.c_str());
+
+  return 0;
+}
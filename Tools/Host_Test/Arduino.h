@@ -0,0 +1,87 @@
+/***************************************************************************************
+// Minimal Arduino core API for the host test build, see host_test.cpp
+//
+// Only what the library and the host sketches (see sketch_main.cpp) use with
+// TFT_HOST_BACKEND defined is provided. Pins and delays do nothing and time does not
+// pass, so every run draws the same pixels.
+***************************************************************************************/
+
+#ifndef _TFT_HostTest_ArduinoH_
+#define _TFT_HostTest_ArduinoH_
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+
+typedef bool    boolean;
+typedef uint8_t byte;
+
+#define HIGH   1
+#define LOW    0
+#define INPUT  0
+#define OUTPUT 1
+
+#ifndef PI
+  #define PI 3.14159265358979323846
+#endif
+#define DEG_TO_RAD 0.017453292519943295
+
+inline void pinMode(int, int) {}
+inline void digitalWrite(int, int) {}
+inline void delay(unsigned long) {}
+inline void delayMicroseconds(unsigned int) {}
+inline void yield(void) {}
+
+inline unsigned long micros(void) { static unsigned long t = 0; return ++t; }
+inline unsigned long millis(void) { return micros() / 1000; }
+
+template <class T> inline T min(T a, T b) { return (b < a) ? b : a; }
+template <class T> inline T max(T a, T b) { return (a < b) ? b : a; }
+
+inline char *ltoa(long value, char *str, int base)
+{
+  if (base == 16) sprintf(str, "%lx", value);
+  else            sprintf(str, "%ld", value);
+  return str;
+}
+
+inline char *itoa(int value, char *str, int base) { return ltoa(value, str, base); }
+
+inline char *dtostrf(double value, signed char width, unsigned char prec, char *str)
+{
+  sprintf(str, "%*.*f", width, prec, value);
+  return str;
+}
+
+// The library only uses c_str(), length() and toCharArray()
+class String : public std::string {
+ public:
+  String() {}
+  String(const char *s) : std::string(s) {}
+  String(const std::string &s) : std::string(s) {}
+  String(long v) : std::string(std::to_string(v)) {}
+
+  void toCharArray(char *buf, unsigned int len) const
+  {
+    if (!len) return;
+    strncpy(buf, c_str(), len);
+    buf[len - 1] = 0;
+  }
+};
+
+#include "Print.h"
+
+// Serial writes to stdout, so a sketch's report can be captured
+class HardwareSerial : public Print {
+ public:
+  void   begin(unsigned long) {}
+  size_t write(uint8_t c) { return putchar(c) == EOF ? 0 : 1; }
+  using  Print::write;
+};
+
+static HardwareSerial Serial;
+
+#endif
@@ -0,0 +1,66 @@
+/***************************************************************************************
+// Minimal Arduino Print class for the host test build, see host_test.cpp
+***************************************************************************************/
+
+#ifndef _TFT_HostTest_PrintH_
+#define _TFT_HostTest_PrintH_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#define DEC 10
+#define HEX 16
+
+class Print {
+
+ public:
+
+  virtual ~Print() {}
+
+  virtual size_t write(uint8_t c) = 0;
+
+  virtual size_t write(const uint8_t *buf, size_t n)
+  {
+    size_t sent = 0;
+    while (n--) sent += write(*buf++);
+    return sent;
+  }
+
+  size_t write(const char *s) { return write((const uint8_t *)s, strlen(s)); }
+
+  size_t print(const char *s) { return write(s); }
+  size_t print(char c)        { return write((uint8_t)c); }
+
+  size_t print(long v, int base = DEC)
+  {
+    char buf[24];
+    snprintf(buf, sizeof(buf), base == HEX ? "%lx" : "%ld", v);
+    return write(buf);
+  }
+
+  size_t print(unsigned long v, int base = DEC)
+  {
+    char buf[24];
+    snprintf(buf, sizeof(buf), base == HEX ? "%lx" : "%lu", v);
+    return write(buf);
+  }
+
+  size_t print(int v, int base = DEC)          { return print((long)v, base); }
+  size_t print(unsigned int v, int base = DEC) { return print((unsigned long)v, base); }
+
+  size_t print(double v, int digits = 2)
+  {
+    char buf[40];
+    snprintf(buf, sizeof(buf), "%.*f", digits, v);
+    return write(buf);
+  }
+
+  size_t println(void) { return write("\n"); }
+
+  template <class T> size_t println(T v)           { size_t n = print(v);    return n + println(); }
+  template <class T> size_t println(T v, int base) { size_t n = print(v, base); return n + println(); }
+};
+
+#endif
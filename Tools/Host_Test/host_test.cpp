@@ -0,0 +1,1426 @@
+/***************************************************************************************
+// Host regression and pixel tests for the library
+//
+// This is a host (e.g. Linux PC) program, it is not part of the Arduino library build.
+// The library is compiled with TFT_HOST_BACKEND defined (see Extensions/Host.h) using
+// the minimal Arduino API in this folder. Build and run all the tests with:
+//
+//   sh Tools/Host_Test/run_tests.sh
+//
+// There are two kinds of test:
+//
+// Reference tests draw with the library and compare the panel with a plain reference
+// of the same drawing, e.g. the shape plotted with drawPixel(), the drawing made in a
+// sprite or a display list, or a point in shape test for every pixel. The results are
+// printed to stderr and the exit status is the number of tests that failed.
+//
+// Golden tests print a checksum of the panel and the bus counters of a set of scenes
+// to stdout, run_tests.sh compares these with golden.txt. A change to the pixels drawn
+// or to the bus traffic then shows up as a difference. If the change is intended check
+// the new output (savePPM() can help) and update golden.txt with:
+//
+//   sh Tools/Host_Test/run_tests.sh --update
+//
+// Most reference tests run in rotation 0 where the panel can be read back quickly with
+// pixel(), the golden scenes and the checksum compares cover the other rotations.
+***************************************************************************************/
+
+#include <TFT_eSPI.h>
+#include <new>
+
+TFT_eSPI    tft;
+TFT_eSprite spr(&tft);
+
+static int failed; // Reference tests that failed
+
+/***************************************************************************************
+** Function name:           result
+** Description:             Report a reference test, bad is the number of failed cases
+***************************************************************************************/
+static void result(const char *name, int bad)
+{
+  if (bad) fprintf(stderr, "%-16s FAIL (%d bad)\n", name, bad);
+  else     fprintf(stderr, "%-16s ok\n", name);
+  if (bad) failed++;
+}
+
+/***************************************************************************************
+** Function name:           golden
+** Description:             Print the panel checksum and bus counters for golden.txt
+***************************************************************************************/
+static void golden(const char *name)
+{
+  const TFT_HostStats &s = TFT_Host::stats;
+  printf("%-22s crc=%08x bytes=%u cmds=%u caset=%u paset=%u ramwr=%u cs=%u tr=%u px=%u\n",
+         name, TFT_Host::checksum(), s.bytes, s.commands, s.caset, s.paset, s.ramwr,
+         s.csToggles, s.transactions, s.pixels);
+}
+
+// Combine values, e.g. the panel checksums of many small drawings, into one (FNV-1a)
+static uint32_t fold(uint32_t hash, uint32_t value)
+{
+  for (int i = 0; i < 4; i++) { hash ^= (value >> (i * 8)) & 0xFF; hash *= 16777619u; }
+  return hash;
+}
+
+// A TFT pixel read straight from the panel model. Only for rotation 0, which mirrors
+// the columns (MADCTL MX), this is much faster than readPixel().
+static uint16_t pixel(int32_t x, int32_t y)
+{
+  return TFT_Host::readGRAM(TFT_HOST_GRAM_WIDTH - 1 - x, y);
+}
+
+// Count the pixels in an area that are not a colour, rotation 0 only
+static int32_t countColor(uint16_t color, int32_t x, int32_t y, int32_t w, int32_t h)
+{
+  int32_t n = 0;
+  for (int32_t j = y; j < y + h; j++)
+    for (int32_t i = x; i < x + w; i++) n += pixel(i, j) != color;
+  return n;
+}
+
+static uint16_t gram[TFT_HOST_GRAM_WIDTH * TFT_HOST_GRAM_HEIGHT]; // Reference pixels
+
+static const uint8_t bmp[] = { 0xFF, 0x81, 0xBD, 0xA5, 0xA5, 0xBD, 0x81, 0xFF,
+                               0x3C, 0x42, 0x81, 0x81, 0x81, 0x81, 0x42, 0x3C };
+
+/***************************************************************************************
+** Function name:           scene
+** Description:             One step of the reference scene, on the TFT or a sprite
+***************************************************************************************/
+#define SCENE_STEPS 17
+
+static const char *sceneName[SCENE_STEPS] = {
+  "fillScreen", "pixels", "lines", "hvlines", "rects", "circles", "ellipses",
+  "triangles", "roundrects", "bitmap", "glcd", "font2", "font4", "font6_7_8",
+  "freefonts", "readback", "pushColors"
+};
+
+template <class T> static void scene(T &t, int step)
+{
+  switch (step) {
+  case 0:
+    t.fillScreen(TFT_NAVY);
+    break;
+  case 1:
+    for (int i = 0; i < 200; i++) t.drawPixel((i * 37) % t.width(), (i * 91) % t.height(), i * 331);
+    break;
+  case 2:
+    for (int i = 0; i < 40; i++) t.drawLine(i * 3, 5, t.width() - 1 - i * 2, t.height() - 1 - i * 5, i * 0x0841);
+    break;
+  case 3:
+    for (int i = 0; i < 40; i++) { t.drawFastHLine(i, i * 4, 100, TFT_RED); t.drawFastVLine(i * 5, i, 90, TFT_GREEN); }
+    break;
+  case 4:
+    for (int i = 0; i < 20; i++) { t.fillRect(i * 7, i * 9, 30, 20, i * 1234); t.drawRect(i * 5, i * 11, 40, 25, TFT_WHITE); }
+    break;
+  case 5:
+    for (int i = 0; i < 10; i++) { t.fillCircle(60 + i * 10, 100 + i * 8, 5 + i * 3, i * 0x1111); t.drawCircle(120, 160, 10 + i * 9, TFT_YELLOW); }
+    break;
+  case 6:
+    t.fillEllipse(100, 100, 50, 30, TFT_CYAN); t.drawEllipse(100, 200, 60, 25, TFT_MAGENTA);
+    break;
+  case 7:
+    for (int i = 0; i < 10; i++) {
+      t.fillTriangle(10 + i * 5, 10, 200 - i * 7, 60 + i * 9, 30, 250 - i * 10, i * 0x2345);
+      t.drawTriangle(5, 300 - i * 9, 230 - i * 4, 200, 100, 10 + i * 3, TFT_ORANGE);
+    }
+    break;
+  case 8:
+    for (int i = 0; i < 8; i++) {
+      t.fillRoundRect(10 + i * 8, 20 + i * 12, 100, 60, 5 + i * 2, i * 0x0F0F);
+      t.drawRoundRect(5 + i * 9, 10 + i * 14, 120, 70, 3 + i * 3, TFT_WHITE);
+    }
+    break;
+  case 9:
+    for (int i = 0; i < 10; i++) t.drawBitmap(i * 13 - 3, 30 + i * 5, bmp, 8, 16, TFT_GREEN);
+    break;
+  case 10:
+    t.setTextColor(TFT_WHITE, TFT_BLACK); t.setCursor(0, 0, 1); t.setTextSize(1); t.print("Hello GLCD font 0123");
+    t.setTextSize(2); t.setTextColor(TFT_YELLOW); t.print("Big text"); t.setTextSize(1);
+    break;
+  case 11:
+    t.setTextColor(TFT_WHITE, TFT_BLUE); t.drawString("Font 2 opaque", 10, 40, 2);
+    t.setTextColor(TFT_RED); t.drawString("Font 2 transp", 10, 60, 2);
+    t.setTextSize(3); t.setTextColor(TFT_GREEN, TFT_BLACK); t.drawString("F2x3", 10, 80, 2);
+    t.setTextColor(TFT_GREEN); t.drawString("F2x2", 10, 130, 2); t.setTextSize(1);
+    break;
+  case 12:
+    t.setTextColor(TFT_WHITE, TFT_BLUE); t.drawString("Font4 Hello", 5, 100, 4);
+    t.setTextColor(TFT_RED); t.drawString("Transparent", 5, 130, 4);
+    t.setTextSize(2); t.setTextColor(TFT_YELLOW, TFT_RED); t.drawString("x2", 5, 160, 4);
+    t.setTextColor(TFT_CYAN); t.drawString("t2", 70, 160, 4); t.setTextSize(1);
+    break;
+  case 13:
+    t.setTextColor(TFT_WHITE, TFT_BLACK); t.drawString("12:34", 0, 200, 6); t.drawString("56.7", 0, 150, 7);
+    t.setTextColor(TFT_GREEN); t.drawString("89", 120, 200, 8);
+    t.setTextDatum(MC_DATUM); t.setTextPadding(100); t.setTextColor(TFT_WHITE, TFT_RED);
+    t.drawNumber(-1234, 120, 160, 4); t.drawFloat(3.14159, 3, 120, 200, 2);
+    t.setTextDatum(TL_DATUM); t.setTextPadding(0);
+    break;
+  case 14:
+    t.setFreeFont(&FreeSans12pt7b); t.setTextColor(TFT_WHITE); t.drawString("Free Sans Wy", 5, 20);
+    t.setTextColor(TFT_BLACK, TFT_WHITE); t.drawString("Opaque jg", 5, 60);
+    t.setFreeFont(&FreeSerifBold24pt7b); t.setTextColor(TFT_RED); t.setCursor(10, 150); t.print("AVWg");
+    t.setTextSize(2); t.setFreeFont(&FreeMono9pt7b); t.drawString("x2", 5, 200); t.setTextSize(1);
+    t.setTextDatum(BR_DATUM); t.drawString("BR", 200, 300); t.setTextDatum(TL_DATUM); t.setTextFont(1);
+    break;
+  case 15: {
+    uint16_t buf[40 * 30];
+    t.readRect(10, 10, 40, 30, buf); t.pushRect(100, 200, 40, 30, buf); t.drawPixel(3, 3, t.readPixel(50, 50));
+    } break;
+  case 16: {
+    t.setWindow(20, 20, 59, 39);
+    for (int i = 0; i < 800; i++) t.pushColor(i * 77);
+    uint16_t line[40];
+    for (int i = 0; i < 40; i++) line[i] = i * 1500;
+    t.setWindow(20, 50, 59, 50); t.pushColors(line, 40);
+    t.setWindow(20, 60, 39, 60); t.pushColors((uint8_t *)line, 40);
+    } break;
+  }
+}
+
+/***************************************************************************************
+** Function name:           testScene
+** Description:             Golden checksums and bus counters of the scene steps
+***************************************************************************************/
+static void testScene(void)
+{
+  char name[32];
+  for (int rot = 0; rot < 4; rot++) {
+    TFT_Host::clearStats();
+    tft.setRotation(rot);
+    sprintf(name, "scene%d rotation", rot);
+    golden(name);
+    for (int s = 0; s < SCENE_STEPS; s++) {
+      TFT_Host::clearStats();
+      scene(tft, s);
+      sprintf(name, "scene%d %s", rot, sceneName[s]);
+      golden(name);
+    }
+  }
+  tft.setRotation(0);
+}
+
+/***************************************************************************************
+** Function name:           testSprites
+** Description:             Scene steps drawn in sprites and pushed must match the TFT
+***************************************************************************************/
+// A 16 bit colour as stored in a sprite of the given colour depth
+static uint16_t spriteColor(uint8_t bpp, uint16_t c)
+{
+  if (bpp == 8) {
+    uint16_t r = (c >> 13) & 7, g = (c >> 8) & 7, b = (c >> 3) & 3;
+    return (((r << 2) | (r >> 1)) << 11) | (((g << 3) | g) << 5) | ((b << 3) | (b << 1) | (b >> 1));
+  }
+  if (bpp == 4) return spr.getPaletteColor(c & 15);
+  if (bpp == 1) return c ? TFT_WHITE : TFT_BLACK;
+  return c;
+}
+
+static void testSprites(void)
+{
+  int bad = 0;
+
+  // 16 bit sprites, whole screen, two rotations
+  for (int rot = 0; rot < 2; rot++) {
+    tft.setRotation(rot);
+    spr.setColorDepth(16);
+    spr.createSprite(tft.width(), tft.height());
+    for (int s = 0; s < SCENE_STEPS; s++) {
+      tft.fillScreen(TFT_BLACK);
+      scene(tft, s);
+      uint32_t ref = TFT_Host::checksum();
+      tft.fillScreen(TFT_BLACK);
+      spr.fillSprite(TFT_BLACK);
+      scene(spr, s);
+      spr.pushSprite(0, 0);
+      if (TFT_Host::checksum() != ref) bad++;
+    }
+    spr.deleteSprite();
+  }
+  tft.setRotation(0);
+  result("sprite16", bad);
+
+  // 8, 4 and 1 bit sprites store fewer colours, compare with the quantised TFT
+  bad = 0;
+  const uint8_t depth[3] = { 8, 4, 1 };
+  int32_t w = tft.width(), h = tft.height();
+  for (int d = 0; d < 3; d++) {
+    spr.setColorDepth(depth[d]);
+    spr.createSprite(w, h);
+    for (int s = 0; s < SCENE_STEPS; s++) {
+      if (depth[d] != 8 && s >= 15) continue; // Read back and raw colours
+      tft.fillScreen(TFT_BLACK);
+      scene(tft, s);
+      for (int32_t i = 0; i < w * h; i++) gram[i] = spriteColor(depth[d], pixel(i % w, i / w));
+      tft.fillScreen(TFT_BLACK);
+      spr.fillSprite(TFT_BLACK);
+      scene(spr, s);
+      spr.pushSprite(0, 0);
+      int32_t n = 0;
+      for (int32_t i = 0; i < w * h; i++) n += (pixel(i % w, i / w) != gram[i]) + (spr.readPixel(i % w, i / w) != gram[i]);
+      // Partial push from an odd offset
+      tft.fillScreen(TFT_BLACK);
+      spr.pushSprite(0, 0, 5, 3, 77, 50);
+      for (int32_t y = 0; y < 50; y++)
+        for (int32_t x = 0; x < 77; x++) n += pixel(x, y) != gram[(y + 3) * w + x + 5];
+      if (n) bad++;
+    }
+    spr.deleteSprite();
+  }
+  result("sprite_depth", bad);
+
+  // Odd sprite widths, packed pixels that do not fill the last byte of a line
+  bad = 0;
+  for (int d = 0; d < 3; d++) {
+    for (int32_t sw = 1; sw < 40; sw += 3) {
+      spr.setColorDepth(depth[2 - d]);
+      spr.createSprite(sw, 11);
+      spr.fillSprite(0);
+      for (int i = 0; i < 30; i++) spr.drawFastHLine(i % sw - 2, i % 11, (i * 7) % sw + 1, i * 5 + 1);
+      for (int i = 0; i < 30; i++) spr.drawPixel((i * 5) % sw, (i * 3) % 11, i & 1 ? 0 : 0xFFFF);
+      tft.fillScreen(TFT_PURPLE);
+      spr.pushSprite(3, 3);
+      for (int32_t y = 0; y < 11; y++)
+        for (int32_t x = 0; x < sw; x++) bad += pixel(x + 3, y + 3) != spr.readPixel(x, y);
+      bad += pixel(3 + sw, 3) != TFT_PURPLE;
+      for (int32_t sx = 0; sx < sw; sx++) {
+        tft.fillScreen(TFT_PURPLE);
+        spr.pushSprite(0, 0, sx, 1, sw - sx, 9);
+        for (int32_t y = 0; y < 9; y++)
+          for (int32_t x = 0; x < sw - sx; x++) bad += pixel(x, y) != spr.readPixel(x + sx, y + 1);
+      }
+      spr.deleteSprite();
+    }
+  }
+  result("sprite_odd", bad);
+
+  // A new sprite uses the GLCD font whatever was in its memory before
+  bad = 0;
+  static uint8_t mem[sizeof(TFT_eSprite)];
+  memset(mem, 0xA5, sizeof(mem));
+  TFT_eSprite *fresh = new (mem) TFT_eSprite(&tft);
+  fresh->createSprite(100, 10);
+  fresh->fillSprite(TFT_BLACK);
+  fresh->drawString("GLCD 1", 0, 0, 1);
+  tft.fillScreen(TFT_BLACK);
+  tft.setTextColor(TFT_WHITE, TFT_BLACK);
+  tft.setTextSize(1);
+  tft.setTextFont(1);
+  tft.drawString("GLCD 1", 0, 0, 1);
+  for (int32_t y = 0; y < 10; y++)
+    for (int32_t x = 0; x < 100; x++) bad += pixel(x, y) != fresh->readPixel(x, y);
+  fresh->deleteSprite();
+  fresh->~TFT_eSprite();
+  result("sprite_font", bad);
+
+  // Clipped pushes
+  bad = 0;
+  spr.setColorDepth(16);
+  spr.createSprite(50, 40);
+  spr.fillSprite(TFT_RED);
+  spr.fillRect(10, 10, 10, 10, TFT_BLUE);
+  tft.fillScreen(TFT_BLACK);
+  spr.pushSprite(-5, -5);
+  spr.pushSprite(w - 20, h - 10);
+  spr.pushSprite(100, 100, 5, 5, 20, 20);
+  bad += countColor(TFT_RED, 0, 0, 5, 5) + countColor(TFT_BLUE, 5, 5, 10, 10) + countColor(TFT_RED, 15, 15, 30, 20);
+  bad += countColor(TFT_RED, w - 20, h - 10, 20, 10) + countColor(TFT_BLACK, 45, 35, 50, 50);
+  bad += countColor(TFT_RED, 100, 100, 5, 5) + countColor(TFT_BLUE, 105, 105, 10, 10);
+  spr.deleteSprite();
+  result("sprite_clip", bad);
+}
+
+/***************************************************************************************
+** Function name:           testSpritePush
+** Description:             pushDirty() and pushDiff() must leave the TFT as pushSprite()
+***************************************************************************************/
+static void dirtyFrame(TFT_eSprite &s, int f)
+{
+  if (f == 0) {
+    s.fillSprite(TFT_NAVY);
+    for (int i = 0; i < 6; i++) {
+      s.drawRect(10, 10 + i * 50, 220, 44, TFT_WHITE);
+      s.setTextColor(TFT_YELLOW, TFT_NAVY);
+      s.drawString("Channel", 16, 14 + i * 50, 2);
+    }
+  }
+  s.setTextColor(TFT_WHITE, TFT_NAVY);
+  s.setTextPadding(60);
+  for (int i = 0; i < 6; i++) if ((f + i) % 3 == 0) s.drawNumber((f * 37 + i * 11) % 1000, 120, 20 + i * 50, 4);
+  s.setTextPadding(0);
+  s.drawLine(200, 30, 200 + (f % 20), 50, TFT_RED);
+  s.drawPixel(5, 300, f * 100);
+}
+
+static void meterFrame(TFT_eSprite &s, int p)
+{
+  s.fillSprite(TFT_WHITE);
+  s.drawRect(0, 0, s.width(), s.height(), TFT_DARKGREY);
+  int cx = s.width() / 2, cy = s.height() - 5, r = s.height() - 15;
+  for (int i = 0; i <= 100; i += 10) {
+    float a = (i * 1.8 + 180) * DEG_TO_RAD;
+    s.drawLine(cx + r * cos(a), cy + r * sin(a), cx + (r - 6) * cos(a), cy + (r - 6) * sin(a), TFT_BLACK);
+  }
+  float a = (p * 1.8 + 180) * DEG_TO_RAD;
+  s.drawLine(cx, cy, cx + (r - 2) * cos(a), cy + (r - 2) * sin(a), TFT_RED);
+  s.fillCircle(cx, cy, 3, TFT_RED);
+  s.setTextColor(TFT_BLACK);
+  s.setTextDatum(BC_DATUM);
+  s.drawNumber(p, cx, cy - 8, 2);
+  s.setTextDatum(TL_DATUM);
+}
+
+static void testSpritePush(void)
+{
+  int bad = 0;
+  spr.setColorDepth(16);
+  spr.createSprite(240, 320);
+  spr.setDirtyTracking(true);
+  for (int f = 0; f < 20; f++) {
+    dirtyFrame(spr, f);
+    if (f == 0) spr.pushSprite(0, 0);
+    else        spr.pushDirty(0, 0);
+    for (int32_t y = 0; y < 320; y++)
+      for (int32_t x = 0; x < 240; x++) bad += pixel(x, y) != spr.readPixel(x, y);
+  }
+  spr.setDirtyTracking(false);
+  spr.deleteSprite();
+  result("sprite_dirty", bad);
+
+  bad = 0;
+  const uint8_t depth[4] = { 16, 8, 4, 1 };
+  for (int d = 0; d < 4; d++) {
+    for (int32_t w = 119; w <= 121; w++) {
+      spr.setColorDepth(depth[d]);
+      spr.createSprite(w, 70);
+      spr.createShadow();
+      tft.fillScreen(TFT_BLACK);
+      for (int f = 0; f < 30; f++) {
+        meterFrame(spr, 50 + 40 * sin(f * 0.2));
+        spr.pushDiff(7, 9);
+        for (int32_t y = 0; y < 70; y++)
+          for (int32_t x = 0; x < w; x++) bad += pixel(x + 7, y + 9) != spr.readPixel(x, y);
+      }
+      spr.deleteSprite();
+    }
+  }
+  result("sprite_diff", bad);
+}
+
+/***************************************************************************************
+** Function name:           testDma
+** Description:             DMA transfers mixed with other calls draw as without DMA
+***************************************************************************************/
+static uint16_t dmaBuf[2][100];
+
+template <bool dma> static void dmaScene(void)
+{
+  tft.fillScreen(TFT_BLACK);
+  tft.startWrite();
+  tft.setAddrWindow(0, 0, 9, 9);
+  if (dma) tft.pushColorsDMA(dmaBuf[0], 100); else tft.pushColors((uint8_t*)dmaBuf[0], 200);
+  tft.writeFillRect(50, 50, 4, 4, TFT_RED);
+  if (dma) tft.pushRectDMA(20, 0, 10, 10, dmaBuf[1]); else tft.pushRect(20, 0, 10, 10, dmaBuf[1]);
+  tft.writePixel(5, 20, TFT_GREEN);
+  if (dma) tft.pushRectDMA(40, 0, 10, 10, dmaBuf[0]); else tft.pushRect(40, 0, 10, 10, dmaBuf[0]);
+  tft.writeFastHLine(0, 30, 60, TFT_YELLOW);
+  if (dma) tft.pushRectDMA(60, 0, 10, 10, dmaBuf[1]); else tft.pushRect(60, 0, 10, 10, dmaBuf[1]);
+  tft.writeFastVLine(100, 0, 60, TFT_CYAN);
+  tft.setWindow(120, 0, 129, 9);
+  if (dma) tft.pushColorsDMA(dmaBuf[0], 100); else tft.pushColors((uint8_t*)dmaBuf[0], 200);
+  tft.drawPixel(7, 40, TFT_WHITE);
+  tft.endWrite();
+}
+
+static void testDma(void)
+{
+  for (int i = 0; i < 100; i++) {
+    uint16_t c = tft.color565(i * 2, 255 - i, i % 10 * 25);
+    dmaBuf[0][i] = (c >> 8) | (c << 8); // Same byte order as pushRect()
+    dmaBuf[1][i] = ~dmaBuf[0][i];
+  }
+
+  tft.setRotation(0);
+  dmaScene<false>();
+  uint32_t ref = TFT_Host::checksum();
+  int bad = !tft.initDMA();
+  TFT_Host::clearStats();
+  dmaScene<true>();
+  if ((TFT_Host::stats.dmaTransfers != 5) || (TFT_Host::checksum() != ref)) bad++;
+  result("dma_mixed", bad);
+}
+
+/***************************************************************************************
+** Function name:           testDisplayList
+** Description:             A recorded display list rendered in strips must match the TFT
+***************************************************************************************/
+static uint16_t image[60 * 50];
+
+static void gradient(TFT_eSPI &t, int32_t x, int32_t y, int32_t w, int32_t h, uint16_t c1, uint16_t c2)
+{
+  int32_t n = h > 1 ? h - 1 : 1;
+  int32_t r1 = c1 >> 11, g1 = (c1 >> 5) & 63, b1 = c1 & 31;
+  int32_t dr = (c2 >> 11) - r1, dg = ((c2 >> 5) & 63) - g1, db = (c2 & 31) - b1;
+  for (int32_t i = 0; i < h; i++)
+    t.drawFastHLine(x, y + i, w, ((r1 + dr * i / n) << 11) | ((g1 + dg * i / n) << 5) | (b1 + db * i / n));
+}
+
+static void gradient(TFT_eDisplayList &t, int32_t x, int32_t y, int32_t w, int32_t h, uint16_t c1, uint16_t c2)
+{
+  t.fillRectVGradient(x, y, w, h, c1, c2);
+}
+
+template <class T> static void listScene(T &t)
+{
+  t.fillScreen(TFT_NAVY);
+  gradient(t, 0, 20, 240, 200, TFT_BLUE, TFT_RED);
+  t.pushRect(0, 100, 60, 50, image);
+  t.pushRect(200, 290, 60, 50, image);
+  t.fillCircle(120, 120, 50, TFT_GREEN); t.drawCircle(120, 120, 70, TFT_WHITE);
+  t.fillTriangle(10, 300, 200, 250, 100, 10, TFT_YELLOW); t.drawTriangle(5, 5, 230, 40, 50, 310, TFT_CYAN);
+  t.drawLine(0, 0, 239, 319, TFT_MAGENTA); t.drawFastVLine(230, 3, 300, TFT_ORANGE); t.drawFastHLine(3, 17, 200, TFT_ORANGE);
+  t.fillRoundRect(20, 200, 100, 60, 12, TFT_MAROON); t.drawRoundRect(15, 195, 110, 70, 14, TFT_WHITE);
+  t.fillEllipse(160, 250, 60, 20, TFT_PURPLE); t.drawEllipse(160, 250, 70, 30, TFT_WHITE);
+  t.drawRect(2, 2, 236, 316, TFT_WHITE); t.fillRect(180, 40, 50, 30, TFT_DARKGREEN); t.drawPixel(7, 7, TFT_RED);
+  t.drawBitmap(100, 12, bmp, 8, 16, TFT_WHITE); t.drawBitmap(100, 60, bmp, 8, 16, TFT_WHITE);
+  t.setTextColor(TFT_WHITE); t.drawString("Over gradient", 10, 30, 4);
+  t.setTextColor(TFT_BLACK, TFT_YELLOW); t.setTextDatum(MC_DATUM); t.setTextPadding(120);
+  t.drawNumber(-12345, 120, 160, 4); t.setTextPadding(0);
+  t.setTextDatum(BL_DATUM); t.setTextSize(2); t.setTextColor(TFT_CYAN); t.drawString("x2", 5, 318, 2); t.setTextSize(1);
+  t.setFreeFont(&FreeSans12pt7b); t.setTextColor(TFT_WHITE); t.setTextDatum(TL_DATUM); t.drawString("Free Wy", 60, 62);
+  t.setTextFont(2); t.drawString("GLCD?", 3, 90);
+  // Free font text at the bottom edge is moved up by drawString()
+  t.setFreeFont(&FreeSans9pt7b); t.setTextSize(2); t.setTextDatum(BL_DATUM); t.drawString("Edgy", 130, 319);
+  t.setTextDatum(ML_DATUM); t.drawString("Low", 20, 315); t.setTextSize(1); t.setTextFont(1);
+  t.setTextDatum(TL_DATUM); t.setTextColor(TFT_WHITE);
+}
+
+static void testDisplayList(void)
+{
+  TFT_eDisplayList list(&tft);
+  int bad = 0;
+
+  for (int i = 0; i < 60 * 50; i++) {
+    uint16_t c = tft.color565(i % 60 * 4, i / 60 * 5, 128);
+    image[i] = (c >> 8) | (c << 8);
+  }
+
+  for (int rot = 0; rot < 2; rot++) {
+    for (int strip = 1; strip <= 40; strip += 13) {
+      tft.setRotation(rot);
+      tft.setTextDatum(TL_DATUM); tft.setTextSize(1); tft.setTextFont(1); tft.setTextPadding(0);
+      listScene(tft);
+      uint32_t ref = TFT_Host::checksum();
+      list.begin(strip, 64, 256);
+      list.setTextDatum(TL_DATUM); list.setTextColor(TFT_WHITE); list.setTextFont(1);
+      tft.fillScreen(TFT_BLACK);
+      listScene(list);
+      list.render();
+      if (list.overflow() || TFT_Host::checksum() != ref) bad++;
+    }
+  }
+  tft.setRotation(0);
+  result("display_list", bad);
+}
+
+/***************************************************************************************
+** Function name:           testCircles
+** Description:             Circle and round rect outlines against the drawPixel() versions
+***************************************************************************************/
+// The original pixel by pixel drawCircleHelper()
+static void refCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t corner, uint32_t color)
+{
+  int32_t f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0;
+  while (x < r) {
+    if (f >= 0) { r--; ddF_y += 2; f += ddF_y; }
+    x++;
+    ddF_x += 2;
+    f     += ddF_x;
+    if (corner & 0x4) { tft.drawPixel(x0 + x, y0 + r, color); tft.drawPixel(x0 + r, y0 + x, color); }
+    if (corner & 0x2) { tft.drawPixel(x0 + x, y0 - r, color); tft.drawPixel(x0 + r, y0 - x, color); }
+    if (corner & 0x8) { tft.drawPixel(x0 - r, y0 + x, color); tft.drawPixel(x0 - x, y0 + r, color); }
+    if (corner & 0x1) { tft.drawPixel(x0 - r, y0 - x, color); tft.drawPixel(x0 - x, y0 - r, color); }
+  }
+}
+
+// The original pixel by pixel drawCircle()
+static void refCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color)
+{
+  int32_t x = 0, dx = 1, dy = r + r, p = -(r >> 1);
+  tft.drawPixel(x0 + r, y0, color); tft.drawPixel(x0 - r, y0, color);
+  tft.drawPixel(x0, y0 - r, color); tft.drawPixel(x0, y0 + r, color);
+  while (x < r) {
+    if (p >= 0) { dy -= 2; p -= dy; r--; }
+    dx += 2;
+    p  += dx;
+    x++;
+    tft.drawPixel(x0 + x, y0 + r, color); tft.drawPixel(x0 - x, y0 + r, color);
+    tft.drawPixel(x0 - x, y0 - r, color); tft.drawPixel(x0 + x, y0 - r, color);
+    tft.drawPixel(x0 + r, y0 + x, color); tft.drawPixel(x0 - r, y0 + x, color);
+    tft.drawPixel(x0 - r, y0 - x, color); tft.drawPixel(x0 + r, y0 - x, color);
+  }
+}
+
+// The original round rect outline, straight edges then the corners
+static void refRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color)
+{
+  for (int32_t i = x + r; i < x + w - r; i++) { tft.drawPixel(i, y, color); tft.drawPixel(i, y + h - 1, color); }
+  for (int32_t j = y + r; j < y + h - r; j++) { tft.drawPixel(x, j, color); tft.drawPixel(x + w - 1, j, color); }
+  refCircleHelper(x + r,         y + r,         r, 1, color);
+  refCircleHelper(x + w - r - 1, y + r,         r, 2, color);
+  refCircleHelper(x + w - r - 1, y + h - r - 1, r, 4, color);
+  refCircleHelper(x + r,         y + h - r - 1, r, 8, color);
+}
+
+static void testCircles(void)
+{
+  int bad = 0;
+  srand(7);
+  for (int rot = 0; rot < 2; rot++) {
+    tft.setRotation(rot);
+    for (int k = 0; k < 1500; k++) {
+      int32_t r = rand() % 60, x = rand() % (tft.width() + 100) - 50, y = rand() % (tft.height() + 100) - 50;
+      int32_t w = 1 + rand() % 120, h = 1 + rand() % 120;
+      uint8_t corner = rand() % 16;
+      int kind = k % 3;
+      if (kind == 2) r = rand() % (1 + (w < h ? w : h) / 2);
+
+      tft.fillScreen(TFT_BLACK);
+      if (kind == 0)      refCircle(x, y, r, TFT_YELLOW);
+      else if (kind == 1) refCircleHelper(x, y, r, corner, TFT_RED);
+      else                refRoundRect(x, y, w, h, r, TFT_GREEN);
+      uint32_t ref = TFT_Host::checksum();
+
+      tft.fillScreen(TFT_BLACK);
+      if (kind == 0)      tft.drawCircle(x, y, r, TFT_YELLOW);
+      else if (kind == 1) { tft.startWrite(); tft.drawCircleHelper(x, y, r, corner, TFT_RED); tft.endWrite(); }
+      else                tft.drawRoundRect(x, y, w, h, r, TFT_GREEN);
+      if (TFT_Host::checksum() != ref) bad++;
+    }
+  }
+  tft.setRotation(0);
+  result("circles", bad);
+}
+
+/***************************************************************************************
+** Function name:           testBitmaps
+** Description:             drawBitmap() against the drawPixel() version, TFT and sprites
+***************************************************************************************/
+static void testBitmaps(void)
+{
+  static uint8_t bits[40 * 6];
+  int bad = 0;
+  srand(5);
+  for (uint32_t i = 0; i < sizeof(bits); i++) { int r = rand() % 4; bits[i] = r == 0 ? 0 : r == 1 ? 0xFF : rand(); }
+
+  for (int k = 0; k < 2000; k++) {
+    tft.setRotation(k & 1);
+    int32_t w = 1 + rand() % 45, h = 1 + rand() % 40;
+    int32_t x = rand() % (tft.width() + 60) - 30, y = rand() % (tft.height() + 60) - 30;
+    bool opaque = k & 2;
+    tft.fillScreen(TFT_DARKGREY);
+    for (int32_t j = 0; j < h; j++)
+      for (int32_t i = 0; i < w; i++) {
+        if (bits[j * ((w + 7) / 8) + i / 8] & (128 >> (i & 7))) tft.drawPixel(x + i, y + j, TFT_YELLOW);
+        else if (opaque) tft.drawPixel(x + i, y + j, TFT_NAVY);
+      }
+    uint32_t ref = TFT_Host::checksum();
+    tft.fillScreen(TFT_DARKGREY);
+    if (opaque) tft.drawBitmap(x, y, bits, w, h, TFT_YELLOW, TFT_NAVY);
+    else        tft.drawBitmap(x, y, bits, w, h, TFT_YELLOW);
+    if (TFT_Host::checksum() != ref) bad++;
+  }
+  tft.setRotation(0);
+  result("bitmap", bad);
+
+  bad = 0;
+  const uint8_t depth[3] = { 16, 8, 1 };
+  static uint16_t ref[100 * 80];
+  for (int d = 0; d < 3; d++) {
+    spr.setColorDepth(depth[d]);
+    spr.createSprite(100, 80);
+    for (int k = 0; k < 300; k++) {
+      int32_t w = 1 + rand() % 45, h = 1 + rand() % 40, x = rand() % 140 - 20, y = rand() % 120 - 20;
+      spr.fillSprite(TFT_BLACK);
+      for (int32_t j = 0; j < h; j++)
+        for (int32_t i = 0; i < w; i++)
+          spr.drawPixel(x + i, y + j, (bits[j * ((w + 7) / 8) + i / 8] & (128 >> (i & 7))) ? TFT_WHITE : TFT_BLUE);
+      for (int32_t i = 0; i < 100 * 80; i++) ref[i] = spr.readPixel(i % 100, i / 100);
+      spr.fillSprite(TFT_BLACK);
+      spr.drawBitmap(x, y, bits, w, h, TFT_WHITE, TFT_BLUE);
+      for (int32_t i = 0; i < 100 * 80; i++) if (ref[i] != spr.readPixel(i % 100, i / 100)) { bad++; break; }
+    }
+    spr.deleteSprite();
+  }
+  result("sprite_bitmap", bad);
+}
+
+/***************************************************************************************
+** Function name:           testTriangles
+** Description:             fillTriangle() against the original Adafruit algorithm
+***************************************************************************************/
+static void refHLine(int32_t x, int32_t y, int32_t w, uint32_t color)
+{
+  while (w-- > 0) tft.drawPixel(x++, y, color);
+}
+
+static void refTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color)
+{
+  int32_t a, b, y, last;
+
+  if (y0 > y1) { swap(y0, y1); swap(x0, x1); }
+  if (y1 > y2) { swap(y2, y1); swap(x2, x1); }
+  if (y0 > y1) { swap(y0, y1); swap(x0, x1); }
+
+  if (y0 == y2) {
+    a = b = x0;
+    if (x1 < a) a = x1; else if (x1 > b) b = x1;
+    if (x2 < a) a = x2; else if (x2 > b) b = x2;
+    refHLine(a, y0, b - a + 1, color);
+    return;
+  }
+
+  int32_t dx01 = x1 - x0, dy01 = y1 - y0, dx02 = x2 - x0, dy02 = y2 - y0,
+          dx12 = x2 - x1, dy12 = y2 - y1, sa = 0, sb = 0;
+
+  last = (y1 == y2) ? y1 : y1 - 1;
+  for (y = y0; y <= last; y++) {
+    a = x0 + sa / dy01; b = x0 + sb / dy02;
+    sa += dx01; sb += dx02;
+    if (a > b) swap(a, b);
+    refHLine(a, y, b - a + 1, color);
+  }
+
+  sa = dx12 * (y - y1);
+  sb = dx02 * (y - y0);
+  for (; y <= y2; y++) {
+    a = x1 + sa / dy12; b = x0 + sb / dy02;
+    sa += dx12; sb += dx02;
+    if (a > b) swap(a, b);
+    refHLine(a, y, b - a + 1, color);
+  }
+}
+
+static void testTriangles(void)
+{
+  int bad = 0;
+  srand(21);
+  for (int k = 0; k < 4000; k++) {
+    int32_t m = (k % 3 == 0) ? 20 : 400, c[6];
+    for (int i = 0; i < 6; i++) c[i] = rand() % m - m / 4 + (m == 20 ? 100 : 0);
+    if (k % 7 == 0)  c[3] = c[1];
+    if (k % 11 == 0) c[5] = c[1];
+    tft.fillScreen(TFT_BLACK);
+    refTriangle(c[0], c[1], c[2], c[3], c[4], c[5], TFT_WHITE);
+    uint32_t ref = TFT_Host::checksum();
+    tft.fillScreen(TFT_BLACK);
+    tft.fillTriangle(c[0], c[1], c[2], c[3], c[4], c[5], TFT_WHITE);
+    if (TFT_Host::checksum() != ref) bad++;
+  }
+  result("fillTriangle", bad);
+}
+
+/***************************************************************************************
+** Function name:           testPolygons
+** Description:             fillPolygon() against a crossing number / winding test
+***************************************************************************************/
+// Distance from a point to a line segment
+static double segmentDistance(double px, double py, double ax, double ay, double bx, double by)
+{
+  double dx = bx - ax, dy = by - ay, l = dx * dx + dy * dy;
+  double t = l ? ((px - ax) * dx + (py - ay) * dy) / l : 0;
+  if (t < 0) t = 0;
+  if (t > 1) t = 1;
+  double x = ax + t * dx - px, y = ay + t * dy - py;
+  return sqrt(x * x + y * y);
+}
+
+static void testPolygons(void)
+{
+  int bad = 0;
+  int32_t w = tft.width(), h = tft.height();
+  srand(31);
+  for (int k = 0; k < 300; k++) {
+    TFT_Point p[20];
+    int n = 1 + rand() % 20;
+    int32_t cx = rand() % w, cy = rand() % h, R = 5 + rand() % 100;
+    for (int i = 0; i < n; i++) {
+      if (i && rand() % 4 == 0) { p[i].x = p[i - 1].x + rand() % 9 - 4; p[i].y = p[i - 1].y; } // Horizontal edge
+      else { p[i].x = cx + rand() % (2 * R) - R; p[i].y = cy + rand() % (2 * R) - R; }
+    }
+    uint8_t rule = rand() & 1;
+    tft.fillScreen(TFT_BLACK);
+    TFT_Host::clearStats();
+    tft.fillPolygon(p, n, TFT_WHITE, rule);
+
+    int32_t x0 = w, x1 = -1, y0 = h, y1 = -1;
+    for (int i = 0; i < n; i++) {
+      if (p[i].x < x0) x0 = p[i].x;
+      if (p[i].x > x1) x1 = p[i].x;
+      if (p[i].y < y0) y0 = p[i].y;
+      if (p[i].y > y1) y1 = p[i].y;
+    }
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 >= w) x1 = w - 1;
+    if (y1 >= h) y1 = h - 1;
+    uint32_t count = 0;
+    int wrong = 0;
+    for (int32_t y = y0; y <= y1; y++) {
+      for (int32_t x = x0; x <= x1; x++) {
+        bool filled = pixel(x, y) != TFT_BLACK;
+        count += filled;
+        double dmin = 1e9;
+        int wind = 0, cross = 0;
+        for (int i = 0; i < n; i++) {
+          TFT_Point a = p[i], b = p[(i + 1) % n];
+          double d = segmentDistance(x, y, a.x, a.y, b.x, b.y);
+          if (d < dmin) dmin = d;
+          if ((a.y <= y) != (b.y <= y)) {
+            double xi = a.x + (double)(y - a.y) * (b.x - a.x) / (b.y - a.y);
+            if (xi > x) { cross++; wind += (b.y > a.y) ? 1 : -1; }
+          }
+        }
+        bool inside = rule == FILL_NONZERO ? wind != 0 : (cross & 1);
+        if (dmin < 1e-9) wrong += !filled;               // On the outline
+        else if (dmin >= 1.0) wrong += inside != filled; // Clearly inside or outside
+      }
+    }
+    // Nothing outside the bounding box and no pixel drawn twice
+    if (wrong || TFT_Host::stats.pixels != count) bad++;
+  }
+  result("fillPolygon", bad);
+
+  // Too many corners, or a triangle corner outside 16 bits, draws nothing
+  bad = 0;
+  TFT_Point star[TFT_POLY_MAX_POINTS + 1];
+  for (int i = 0; i <= TFT_POLY_MAX_POINTS; i++) {
+    double a = i * 2 * M_PI / (TFT_POLY_MAX_POINTS + 1), r = (i & 1) ? 40 : 100;
+    star[i].x = 120 + lround(r * sin(a));
+    star[i].y = 160 - lround(r * cos(a));
+  }
+  tft.fillScreen(TFT_BLACK);
+  TFT_Host::clearStats();
+  tft.fillPolygon(star, TFT_POLY_MAX_POINTS + 1, TFT_WHITE);
+  if (TFT_Host::stats.pixels) bad++;
+  tft.fillPolygon(star, TFT_POLY_MAX_POINTS, TFT_WHITE);
+  if (!TFT_Host::stats.pixels) bad++;
+  TFT_Host::clearStats();
+  tft.fillTriangle(10, 10, 100, 20, 65536 + 50, 200, TFT_WHITE);
+  tft.fillTriangle(10, 10, 100, -40000, 50, 200, TFT_WHITE);
+  if (TFT_Host::stats.pixels) bad++;
+  result("fillPolygon_limits", bad);
+}
+
+/***************************************************************************************
+** Function name:           testArcs
+** Description:             fillArc() and drawWideLine() against point in shape tests
+***************************************************************************************/
+// Sine of whole degrees in Q14 as used by the library
+static int32_t sinQ14(int32_t d)
+{
+  d %= 360;
+  if (d < 0) d += 360;
+  return (int32_t)lround(sin(d * M_PI / 180) * 16384);
+}
+
+// A pixel offset x,y from the centre is in the arc, the end edge is not included
+static bool inArc(int32_t x, int32_t y, int32_t r0, int32_t r1, int32_t start, int32_t end)
+{
+  int64_t d2 = (int64_t)x * x + (int64_t)y * y;
+  if (d2 > r1 * r1 + r1) return false;
+  if (r0 > 0 && d2 <= r0 * r0 - r0) return false;
+  int32_t sweep = end - start;
+  if (sweep >= 360 || sweep <= -360) return true;
+  if (!x && !y) y = -1; // The centre is filled if the arc includes 0 degrees
+  sweep = ((sweep % 360) + 360) % 360;
+  if (!sweep) return false;
+  int64_t sx = sinQ14(start), sy = -sinQ14(start + 90), ex = sinQ14(end), ey = -sinQ14(end + 90);
+  int64_t a = sx * y - sy * x, b = x * ey - y * ex;
+  if (sweep == 180) return a > 0 || (a == 0 && sx * x + sy * y >= 0);
+  return sweep > 180 ? (a >= 0 || b > 0) : (a >= 0 && b > 0);
+}
+
+// A pixel is in a wide line, the sides are at width/2 and the ends are optionally round
+static bool inWideLine(int32_t px, int32_t py, int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t w, bool round)
+{
+  int64_t dx = x1 - x0, dy = y1 - y0, l2 = dx * dx + dy * dy;
+  int64_t len16 = (int64_t)floor(sqrt((double)(l2 << 8)));
+  int64_t qx = px - x0, qy = py - y0;
+  bool in = false;
+  if (l2) {
+    int64_t p = dx * qx + dy * qy, c = dx * qy - dy * qx;
+    in = p >= 0 && p <= l2 && 32 * c > -w * len16 && 32 * c <= w * len16;
+  }
+  if (round || !l2) {
+    if (4 * (qx * qx + qy * qy) <= w * w) in = true;
+    int64_t ax = px - x1, ay = py - y1;
+    if (4 * (ax * ax + ay * ay) <= w * w) in = true;
+  }
+  return in;
+}
+
+static void testArcs(void)
+{
+  int bad = 0;
+  int32_t w = tft.width(), h = tft.height();
+  srand(11);
+  for (int k = 0; k < 600; k++) {
+    int32_t x = rand() % (w + 80) - 40, y = rand() % (h + 80) - 40;
+    int32_t r0 = 0, r1 = 0, start = 0, end = 0, x1 = 0, y1 = 0, lw = 0;
+    bool round = rand() & 1, arc = rand() & 1;
+    tft.fillScreen(TFT_BLACK);
+    TFT_Host::clearStats();
+    if (arc) {
+      r1 = rand() % 90; r0 = rand() % (r1 + 2);
+      start = rand() % 720 - 360; end = start + rand() % 420 - 20;
+      if (rand() % 8 == 0) end = start + 360;
+      tft.fillArc(x, y, r0, r1, start, end, TFT_WHITE);
+    }
+    else {
+      x1 = rand() % (w + 80) - 40; y1 = rand() % (h + 80) - 40; lw = 1 + rand() % 25;
+      if (rand() % 10 == 0) { x1 = x; y1 = y; }
+      if (k % 5 == 0) { x = rand() % 6000 - 3000; y = rand() % 6000 - 3000; x1 = -x / 2; y1 = -y / 2; }
+      if (k == 1) { x = -1492; y = 1718; x1 = 1754; y1 = -980; lw = 16; }
+      tft.drawWideLine(x, y, x1, y1, lw, TFT_WHITE, round);
+    }
+    uint32_t count = 0;
+    int wrong = 0;
+    for (int32_t py = 0; py < h; py++) {
+      for (int32_t px = 0; px < w; px++) {
+        bool in = arc ? inArc(px - x, py - y, r0, r1, start, end) : inWideLine(px, py, x, y, x1, y1, lw, round);
+        count += in;
+        wrong += in != (pixel(px, py) != TFT_BLACK);
+      }
+    }
+    if (wrong || TFT_Host::stats.pixels != count) bad++;
+  }
+  result("fillArc_wideLine", bad);
+
+  // Arcs that meet must tile the ring without gaps or overlap, the first cases are half
+  // rings with a hole
+  bad = 0;
+  srand(2);
+  for (int k = 0; k < 400; k++) {
+    int32_t r1 = 5 + rand() % 100, r0 = 1 + rand() % r1;
+    int32_t a = rand() % 360, b = a + rand() % 200, c = b + rand() % 160;
+    if (k < 100) { a = (k % 8) * 45 - 90; b = a + 180; c = b + 180; }
+    else if (rand() % 4 == 0) r0 = 0;
+    tft.fillScreen(TFT_BLACK);
+    TFT_Host::clearStats();
+    tft.fillArc(120, 160, r0, r1, a, b, TFT_RED);
+    tft.fillArc(120, 160, r0, r1, b, c, TFT_RED);
+    uint32_t pixels = TFT_Host::stats.pixels, ref = TFT_Host::checksum();
+    tft.fillScreen(TFT_BLACK);
+    TFT_Host::clearStats();
+    tft.fillArc(120, 160, r0, r1, a, c, TFT_RED);
+    if (TFT_Host::checksum() != ref || TFT_Host::stats.pixels != pixels) bad++;
+  }
+  result("fillArc_tiling", bad);
+}
+
+/***************************************************************************************
+** Function name:           testSmooth
+** Description:             alphaBlend() and the anti-aliased drawing functions
+***************************************************************************************/
+static void testSmooth(void)
+{
+  // alphaBlend() uses 32 levels and must be within one step of the exact blend
+  int bad = 0;
+  srand(3);
+  for (int k = 0; k < 100000; k++) {
+    uint16_t fg = rand(), bg = rand(), c;
+    uint8_t alpha = rand();
+    c = tft.alphaBlend(alpha, fg, bg);
+    int32_t q = (alpha + 4) >> 3;
+    const uint8_t shift[3] = { 11, 5, 0 }, mask[3] = { 31, 63, 31 };
+    for (int ch = 0; ch < 3; ch++) {
+      int32_t f = (fg >> shift[ch]) & mask[ch], b = (bg >> shift[ch]) & mask[ch], v = (c >> shift[ch]) & mask[ch];
+      if (fabs(v - (b + (f - b) * q / 32.0)) > 1.0) { bad++; break; }
+    }
+  }
+  if (tft.alphaBlend(255, 0x1234, 0xABCD) != 0x1234 || tft.alphaBlend(0, 0x1234, 0xABCD) != 0xABCD) bad++;
+  result("alphaBlend", bad);
+
+  // Reading the background back must give the same pixels as a known background
+  bad = 0;
+  static uint16_t img1[120 * 100], img2[120 * 100];
+  spr.setColorDepth(16);
+  spr.createSprite(120, 100);
+  for (int k = 0; k < 300; k++) {
+    int32_t x0 = rand() % 160 - 20, y0 = rand() % 140 - 20, x1 = rand() % 160 - 20, y1 = rand() % 140 - 20;
+    int32_t r = rand() % 70, start = rand() % 400 - 20, end = rand() % 800 - 200;
+    spr.fillSprite(TFT_DARKGREEN);
+    if (k & 1) spr.drawSmoothLine(x0, y0, x1, y1, TFT_ORANGE, TFT_DARKGREEN);
+    else       spr.drawSmoothArc(x1, y0, r, start, end, TFT_CYAN, TFT_DARKGREEN);
+    spr.readRect(0, 0, 120, 100, img1);
+    spr.fillSprite(TFT_DARKGREEN);
+    if (k & 1) spr.drawSmoothLine(x0, y0, x1, y1, TFT_ORANGE);
+    else       spr.drawSmoothArc(x1, y0, r, start, end, TFT_CYAN);
+    spr.readRect(0, 0, 120, 100, img2);
+    if (memcmp(img1, img2, sizeof(img1))) bad++;
+  }
+  spr.deleteSprite();
+  result("smooth_readback", bad);
+
+  // Golden anti-aliased drawing
+  tft.setRotation(1);
+  tft.fillScreen(TFT_NAVY);
+  TFT_Host::clearStats();
+  for (int a = 0; a < 360; a += 15) {
+    float s = sin(a * DEG_TO_RAD), c = cos(a * DEG_TO_RAD);
+    tft.drawSmoothLine(80, 80, 80 + 70 * s, 80 - 70 * c, TFT_WHITE, TFT_NAVY);
+    tft.drawSmoothLine(240, 80, 240 + 70 * s, 80 - 70 * c, TFT_WHITE);
+  }
+  for (int r = 3; r < 60; r += 8) {
+    tft.drawSmoothCircle(80, 180, r, TFT_YELLOW, TFT_NAVY);
+    tft.drawSmoothCircle(240, 180, r, TFT_YELLOW);
+  }
+  tft.drawSmoothArc(80, 180, 66, 300, 60, TFT_RED, TFT_NAVY);
+  tft.drawSmoothArc(240, 180, 66, 45, 315, TFT_RED);
+  golden("smooth");
+  tft.setRotation(0);
+}
+
+/***************************************************************************************
+** Function name:           testFonts
+** Description:             Golden text drawing, and the glyph cache against no cache
+***************************************************************************************/
+static const char *fontText[] = { "Wj{|", "gjpq", "Hi", "(f)", "Ay", " " };
+
+template <class T> static void freeText(T &t, int k)
+{
+  const GFXfont *font[] = { &FreeSans12pt7b, &FreeSerifBold24pt7b, &FreeMono9pt7b, &FreeSerifItalic12pt7b };
+  for (int i = 0; i < 24; i++) {
+    t.setFreeFont(font[(i + k) % 4]);
+    t.setTextSize(1);
+    t.setTextColor(TFT_WHITE + i * 77, TFT_BLUE + i);
+    t.setTextDatum(i % 3 == 0 ? TL_DATUM : (i % 3 == 1 ? MC_DATUM : L_BASELINE));
+    t.setTextPadding(i % 4 == 1 ? 100 : 0);
+    t.drawString(fontText[(i + k) % 6], (i * 37 + k * 11) % 60 + 60, (i * 29 + k * 7) % 90 + 60);
+  }
+  t.setTextPadding(0);
+  t.setTextDatum(TL_DATUM);
+  t.setTextFont(1);
+}
+
+static void testFonts(void)
+{
+  char name[32];
+
+  // Single characters of the run length encoded fonts, clipped at all the edges
+  const uint8_t rle[4] = { 2, 4, 6, 7 };
+  srand(17);
+  for (int f = 0; f < 4; f++) {
+    for (int opaque = 0; opaque < 2; opaque++) {
+      uint32_t hash = 2166136261u;
+      TFT_Host::clearStats();
+      for (int k = 0; k < 200; k++) {
+        tft.setRotation(k & 3);
+        uint8_t size = 1 + rand() % 3;
+        int32_t x = rand() % (tft.width() + 160) - 100, y = rand() % (tft.height() + 160) - 100;
+        uint16_t c = (rle[f] >= 6) ? '0' + rand() % 10 : 32 + rand() % 95;
+        tft.fillScreen(TFT_BLUE);
+        tft.setTextSize(size);
+        if (opaque) tft.setTextColor(TFT_WHITE, TFT_BLACK);
+        else        tft.setTextColor(TFT_WHITE);
+        tft.drawChar(c, x, y, rle[f]);
+        hash = fold(hash, TFT_Host::checksum());
+      }
+      sprintf(name, "drawChar font%d %s", rle[f], opaque ? "opaque" : "transp");
+      printf("%-22s hash=%08x bytes=%u\n", name, hash, TFT_Host::stats.bytes);
+    }
+  }
+  tft.setRotation(0);
+  tft.setTextSize(1);
+
+  // Characters clipped by the left and top edges match the same character on screen.
+  // Opaque characters at size 1 are sent as one block and must be on screen.
+  int bad = 0;
+  for (int k = 0; k < 400; k++) {
+    uint8_t font = rle[k % 4], size = 1 + rand() % 3;
+    uint16_t c = (font >= 6) ? '0' + rand() % 10 : 33 + rand() % 94;
+    int32_t x = -rand() % 60, y = -rand() % 80;
+    tft.setTextSize(size);
+    if ((k & 4) && size > 1) tft.setTextColor(TFT_WHITE, TFT_BLACK);
+    else       tft.setTextColor(TFT_WHITE);
+    tft.fillScreen(TFT_BLUE);
+    tft.drawChar(c, x + 100, y + 100, font);
+    for (int32_t i = 0; i < 140 * 240; i++) gram[i] = pixel(i % 140, i / 140);
+    tft.fillScreen(TFT_BLUE);
+    tft.drawChar(c, x, y, font);
+    for (int32_t j = 0; j < 140; j++)
+      for (int32_t i = 0; i < 40; i++) bad += pixel(i, j) != gram[(j + 100) * 140 + i + 100];
+  }
+  tft.setTextSize(1);
+  result("drawChar_clip", bad);
+
+  // Free fonts with datums and padding
+  for (int rot = 0; rot < 2; rot++) {
+    tft.setRotation(rot);
+    for (int k = 0; k < 6; k++) {
+      tft.fillScreen(TFT_BLACK);
+      TFT_Host::clearStats();
+      freeText(tft, k);
+      sprintf(name, "freefont%d %d", rot, k);
+      golden(name);
+    }
+  }
+
+  // Smooth font
+  tft.setRotation(0);
+  tft.fillScreen(TFT_NAVY);
+  TFT_Host::clearStats();
+  tft.setSmoothFont(&FreeSansSmooth16pt7b);
+  tft.setTextColor(TFT_WHITE, TFT_NAVY);
+  tft.drawString("Smooth 12:34", 5, 5);
+  tft.setTextColor(TFT_YELLOW, TFT_DARKGREEN);
+  tft.drawString("jAWfy{|}", 5, 45);
+  tft.setTextColor(TFT_ORANGE);
+  tft.drawString("Transparent", 5, 85);
+  tft.setTextSize(2); tft.setTextColor(TFT_BLACK, TFT_WHITE); tft.drawString("x2 Ag", 5, 160); tft.setTextSize(1);
+  tft.setTextColor(TFT_CYAN, TFT_NAVY); tft.setCursor(5, 260); tft.print("print() Wj");
+  tft.setTextDatum(MC_DATUM); tft.setTextColor(TFT_GREEN, TFT_NAVY); tft.drawString("Edge", 235, 300);
+  tft.setTextDatum(TL_DATUM);
+  golden("smoothfont");
+  tft.setTextFont(1);
+
+  // Sprites with and without a glyph cache draw the same
+  bad = 0;
+  TFT_eSprite cached(&tft);
+  spr.setColorDepth(16);
+  spr.createSprite(240, 320);
+  cached.createSprite(240, 320);
+  static uint16_t img1[240 * 320], img2[240 * 320];
+  const uint32_t budget[] = { 0, 300, 2000, 16000 };
+  for (int b = 0; b < 4; b++) {
+    cached.setGlyphCache(budget[b]);
+    for (int k = 0; k < 6; k++) {
+      spr.fillSprite(TFT_BLACK);    freeText(spr, k);
+      cached.fillSprite(TFT_BLACK); freeText(cached, k);
+      spr.readRect(0, 0, 240, 320, img1);
+      cached.readRect(0, 0, 240, 320, img2);
+      if (memcmp(img1, img2, sizeof(img1))) bad++;
+    }
+  }
+  cached.setGlyphCache(0);
+  cached.deleteSprite();
+  spr.deleteSprite();
+  result("glyph_cache", bad);
+}
+
+/***************************************************************************************
+** Function name:           testKerning
+** Description:             Kerned free font text is measured and drawn the same way
+***************************************************************************************/
+// In character code order, left then right
+static const GFXkern kernPairs[] = {
+  { 'A', 'V', -3 }, { 'T', 'o', -2 }, { 'V', 'A', -3 }, { 'W', 'a', -1 }, { 'o', 'W', 2 },
+};
+
+// x advance of c in pixels, the width of cc less the width of c
+static int32_t advance(char c)
+{
+  char one[2] = { c, 0 }, two[3] = { c, c, 0 };
+  return tft.textWidth(two) - tft.textWidth(one);
+}
+
+static int8_t pairKern(char l, char r)
+{
+  for (unsigned i = 0; i < sizeof(kernPairs) / sizeof(kernPairs[0]); i++)
+    if ((kernPairs[i].left == (uint8_t)l) && (kernPairs[i].right == (uint8_t)r)) return kernPairs[i].xAdjust;
+  return 0;
+}
+
+static void testKerning(void)
+{
+  // More than TFT_LAYOUT_GLYPHS glyphs but narrow enough to fit on the screen
+  static char spaced[TFT_LAYOUT_GLYPHS + 10];
+  snprintf(spaced, sizeof(spaced), "AVATo%*sWaVA", TFT_LAYOUT_GLYPHS, "");
+  const char *text[] = { "AV", "AV", "AVAToWa oWAV", "AVAToWa", spaced };
+  const uint8_t size[] = { 1, 2, 1, 2, 1 };
+
+  int bad = 0;
+  tft.setRotation(1);
+  tft.setFreeFont(&FreeSans9pt7b);
+  tft.setTextDatum(L_BASELINE);
+  tft.setTextWrap(false);
+  tft.setTextColor(TFT_WHITE);
+
+  for (int t = 0; t < 5; t++) {
+    const char *str = text[t];
+    int32_t len = strlen(str), ts = size[t];
+    tft.setTextSize(ts);
+
+    // Plain widths and each character drawn alone at its kerned position
+    tft.setKerning(NULL, 0);
+    int32_t plain = tft.textWidth(str), kern = 0, x = 0;
+    tft.fillScreen(TFT_BLACK);
+    for (int i = 0; i < len; i++) {
+      if (i) kern += pairKern(str[i - 1], str[i]);
+      char one[2] = { str[i], 0 };
+      tft.drawString(one, x + kern * ts, 100);
+      x += advance(str[i]);
+    }
+    uint32_t ref = TFT_Host::checksum();
+
+    tft.setKerning(kernPairs, sizeof(kernPairs) / sizeof(kernPairs[0]));
+    if (!kern || (tft.textWidth(str) != plain + kern * ts)) bad++;
+
+    tft.fillScreen(TFT_BLACK);
+    tft.drawString(str, 0, 100);
+    if (TFT_Host::checksum() != ref) bad++;
+
+    tft.fillScreen(TFT_BLACK);
+    tft.setCursor(0, 100);
+    tft.print(str);
+    if (TFT_Host::checksum() != ref) bad++;
+  }
+
+  tft.setKerning(NULL, 0);
+  tft.setRotation(0);
+  tft.setTextSize(1);
+  tft.setTextWrap(true);
+  tft.setTextDatum(TL_DATUM);
+  tft.setTextFont(1);
+  result("kerning", bad);
+}
+
+/***************************************************************************************
+** Function name:           testUnicode
+** Description:             UTF-8 text in a font with several character code ranges
+***************************************************************************************/
+// Only built with LOAD_UNICODE defined, CI runs the tests again with it. The glyphs are
+// solid blocks: ' ' and '!', then U+00E9 (2 byte UTF-8) and U+20AC (3 byte UTF-8).
+#ifdef LOAD_UNICODE
+static const uint8_t unicodeBitmap[17] = {
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+static const GFXglyph unicodeGlyphs[] = {
+  { 0, 0,  0, 6, 0,   0 }, // ' '
+  { 0, 4,  8, 6, 1,  -8 }, // '!'
+  { 4, 5,  6, 7, 1,  -6 }, // U+00E9
+  { 8, 7, 10, 9, 1, -10 }, // U+20AC
+};
+
+static const GFXrange unicodeRanges[] = {
+  { 0x0020, 0x0021, 0 }, { 0x00E9, 0x00E9, 2 }, { 0x20AC, 0x20AC, 3 },
+};
+
+static const GFXfont unicodeFont = {
+  (uint8_t *)unicodeBitmap, (GFXglyph *)unicodeGlyphs, 0x20, 0x21, 12, (GFXrange *)unicodeRanges, 3
+};
+#endif
+
+static void testUnicode(void)
+{
+#ifdef LOAD_UNICODE
+  // U+0100 is between the ranges so it is drawn as the first glyph, the space
+  const char *text = "!\xC3\xA9\xE2\x82\xAC\xC4\x80!";
+  int bad = 0;
+
+  tft.setRotation(0);
+  tft.fillScreen(TFT_BLACK);
+  tft.fillRect(11, 92, 4, 8, TFT_WHITE);
+  tft.fillRect(17, 94, 5, 6, TFT_WHITE);
+  tft.fillRect(24, 90, 7, 10, TFT_WHITE);
+  tft.fillRect(39, 92, 4, 8, TFT_WHITE);
+  uint32_t ref = TFT_Host::checksum();
+
+  tft.setFreeFont(&unicodeFont);
+  tft.setTextColor(TFT_WHITE);
+  tft.setTextDatum(L_BASELINE);
+  if (tft.textWidth(text) != 33) bad++;
+
+  tft.fillScreen(TFT_BLACK);
+  tft.drawString(text, 10, 100);
+  if (TFT_Host::checksum() != ref) bad++;
+
+  tft.fillScreen(TFT_BLACK);
+  tft.setCursor(10, 100);
+  tft.print(text);
+  if (TFT_Host::checksum() != ref) bad++;
+
+  tft.setTextDatum(TL_DATUM);
+  tft.setTextFont(1);
+  result("unicode", bad);
+#endif
+}
+
+/***************************************************************************************
+** Function name:           testNumberField
+** Description:             Updating a number field must look the same as redrawing it
+***************************************************************************************/
+static void fieldSetup(TFT_eNumberField &f, int font, uint8_t size, uint8_t datum, bool fixed, int32_t y)
+{
+  int32_t x = (datum % 3 == 0) ? 5 : (datum % 3 == 1) ? 120 : 235;
+  f.setPosition(x, y, 230, datum);
+  if (font == 0)      f.setTextFont(1);
+  else if (font == 1) f.setTextFont(2);
+  else if (font == 2) f.setTextFont(4);
+  else if (font == 3) f.setTextFont(7);
+  else if (font == 4) f.setFreeFont(&FreeSans9pt7b);
+  else                f.setSmoothFont(&FreeSansSmooth16pt7b);
+  f.setTextSize(size);
+  f.setFixedPitch(fixed);
+  f.setTextColor(TFT_YELLOW, TFT_NAVY);
+}
+
+static void testNumberField(void)
+{
+  TFT_eNumberField a(&tft), b(&tft);
+  int bad = 0;
+  srand(3);
+  for (int font = 0; font < 6; font++)
+  for (uint8_t size = 1; size <= 2; size++)
+  for (uint8_t datum = 0; datum < 12; datum++)
+  for (int fixed = 0; fixed < 2; fixed++) {
+    if (font == 3 && size == 2) continue;
+    tft.fillScreen(TFT_BLACK);
+    fieldSetup(a, font, size, datum, fixed, 80);
+    fieldSetup(b, font, size, datum, fixed, 240);
+    long v = rand() % 2000 - 1000;
+    for (int it = 0; it < 12; it++) {
+      char s[20];
+      int mode = (font == 3) ? 0 : it % 3;
+      v += rand() % 21 - 10;
+      if (font == 3) { if (v < 0) v = -v; sprintf(s, "%ld", v); }
+      else if (mode == 0) sprintf(s, "%ld", v);
+      else if (mode == 2) sprintf(s, "%ld:%02d", labs(v) % 60, (int)(labs(v) / 3 % 60));
+
+      // a is updated, b is redrawn in full, the two must match
+      if (mode == 1) a.drawFloat(v / 7.0f, 2); else a.drawString(s);
+      b.redraw();
+      if (mode == 1) b.drawFloat(v / 7.0f, 2); else b.drawString(s);
+      for (int32_t y = 0; y < 150; y++)
+        for (int32_t x = 0; x < 240; x++) bad += pixel(x, 10 + y) != pixel(x, 170 + y);
+
+      // The same value again sends nothing
+      TFT_Host::clearStats();
+      if (mode == 1) a.drawFloat(v / 7.0f, 2); else a.drawString(s);
+      bad += TFT_Host::stats.bytes > 0;
+    }
+  }
+  result("number_field", bad);
+}
+
+/***************************************************************************************
+** Function name:           testTextBox
+** Description:             A text box must only draw inside the box
+***************************************************************************************/
+// Draw text in a box, true if part of the box is not drawn or a pixel outside it is
+static bool textBoxWrong(TFT_eTextBox &box, const char *text, int32_t bx, int32_t by, int32_t bw, int32_t bh, uint8_t datum)
+{
+  tft.fillScreen(TFT_DARKGREY);
+  tft.setTextColor(TFT_WHITE, TFT_NAVY);
+  box.setText(text);
+  box.setBox(bx, by, bw, bh);
+  box.setTextDatum(datum);
+  box.draw();
+  // The whole box is drawn with a background colour and nothing outside it
+  int32_t inside = 0;
+  for (int32_t y = by; y < by + bh; y++)
+    for (int32_t x = bx; x < bx + bw; x++) inside += pixel(x, y) == TFT_DARKGREY;
+  int32_t outside = countColor(TFT_DARKGREY, 0, 0, tft.width(), tft.height()) - (bw * bh - inside);
+  return inside || outside;
+}
+
+static void testTextBox(void)
+{
+  static const char *text[] = {
+    "The quick brown fox jumps over the lazy dog. Supercalifragilisticexpialidocious\nwords break  between   characters.\n\nEnd",
+    "  Leading spaces\n   and more\n\n    ",
+    "Short",
+    "Averyveryverylongwordthatcannotfitononeline at all",
+  };
+  TFT_eTextBox box(&tft);
+  int bad = 0;
+  for (int t = 0; t < 4; t++)
+  for (int font = 0; font < 4; font++)
+  for (uint8_t datum = 0; datum < 9; datum++) {
+    int32_t bx = 20 + datum * 3, by = 30, bw = 60 + t * 30 + font * 11, bh = 200;
+    tft.setTextSize(1 + (font == 3));
+    if (font == 0)      tft.setTextFont(2);
+    else if (font == 1) tft.setTextFont(4);
+    else if (font == 2) tft.setFreeFont(&FreeSans9pt7b);
+    else                tft.setFreeFont(&FreeMono12pt7b);
+    if (textBoxWrong(box, text[t], bx, by, bw, bh, datum)) bad++;
+  }
+
+  // Leading spaces that would push the first word out of the box are dropped
+  tft.setFreeFont(&FreeMono12pt7b);
+  tft.setTextSize(2);
+  for (int32_t bw = 60; bw <= 100; bw++)
+    for (uint8_t datum = 0; datum < 9; datum++)
+      if (textBoxWrong(box, "\n  fox\n   jumps", 20, 30, bw, 200, datum)) bad++;
+  // The word is kept whole when it fits without the spaces
+  textBoxWrong(box, "\n  fox", 20, 30, 100, 200, TR_DATUM);
+  if (box.lines() != 2) bad++;
+
+  // Lines longer than TFT_LAYOUT_GLYPHS are drawn a character at a time, all lines
+  // must match drawString() over the box background, opaque and transparent
+  static const char *line[] = { "AV To il", "il il il il AV il To il Wa il oW il VA il il il" };
+  static uint16_t img[300 * 40];
+  tft.setRotation(1);
+  tft.setTextDatum(TL_DATUM);
+  for (int k = 0; k < 2; k++)
+  for (int opaque = 0; opaque < 2; opaque++) {
+    tft.setFreeFont(&FreeSans9pt7b);
+    tft.setTextSize(1);
+    tft.setKerning(kernPairs, sizeof(kernPairs) / sizeof(kernPairs[0]));
+    tft.fillScreen(TFT_DARKGREY);
+    tft.fillRect(10, 20, 300, 40, TFT_NAVY);
+    tft.setTextColor(TFT_WHITE);
+    tft.drawString(line[k], 10, 20);
+    for (int32_t i = 0; i < 300 * 40; i++) img[i] = tft.readPixel(10 + i % 300, 20 + i / 300);
+    tft.fillScreen(TFT_DARKGREY);
+    if (opaque) tft.setTextColor(TFT_WHITE, TFT_NAVY);
+    else        tft.fillRect(10, 20, 300, 40, TFT_NAVY);
+    box.setText(line[k]);
+    box.setBox(10, 20, 300, 40);
+    box.setTextDatum(TL_DATUM);
+    box.draw();
+    if (box.lines() != 1) bad++;
+    for (int32_t i = 0; i < 300 * 40; i++)
+      if (tft.readPixel(10 + i % 300, 20 + i / 300) != img[i]) { bad++; break; }
+  }
+  tft.setKerning(NULL, 0);
+  tft.setRotation(0);
+  tft.setTextFont(1);
+  tft.setTextSize(1);
+  result("text_box", bad);
+}
+
+/***************************************************************************************
+** Function name:           main
+***************************************************************************************/
+int main(int argc, char **argv)
+{
+  TFT_Host::reset();
+  tft.init();
+
+  testScene();
+  testSprites();
+  testSpritePush();
+  testDma();
+  testDisplayList();
+  testCircles();
+  testBitmaps();
+  testTriangles();
+  testPolygons();
+  testArcs();
+  testSmooth();
+  testFonts();
+  testKerning();
+  testUnicode();
+  testNumberField();
+  testTextBox();
+
+  if (argc > 1) TFT_Host::savePPM(argv[1]);
+
+  fprintf(stderr, "%d reference test(s) failed\n", failed);
+  return failed;
+}
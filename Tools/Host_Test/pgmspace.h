@@ -0,0 +1,21 @@
+/***************************************************************************************
+// Program memory access for the host test build, see host_test.cpp
+//
+// The fonts include this, there is no separate program memory on the host so PROGMEM
+// data is read directly. pgm_read_dword() is defined by TFT_eSPI.h to read pointers.
+***************************************************************************************/
+
+#ifndef _TFT_HostTest_pgmspaceH_
+#define _TFT_HostTest_pgmspaceH_
+
+#include <stdint.h>
+
+#ifndef PROGMEM
+  #define PROGMEM
+#endif
+#ifndef pgm_read_byte
+  #define pgm_read_byte(addr) (*(const uint8_t *)(const void *)(addr))
+  #define pgm_read_word(addr) (*(const uint16_t *)(const void *)(addr))
+#endif
+
+#endif
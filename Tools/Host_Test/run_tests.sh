@@ -0,0 +1,64 @@
+#!/bin/sh
+# Build the library for the host and run the tests in host_test.cpp
+#
+#   sh Tools/Host_Test/run_tests.sh            run the tests
+#   sh Tools/Host_Test/run_tests.sh --update   run them and accept the golden output
+#
+# The bus benchmark sketch (examples/Generic/TFT_Bus_Benchmark) is also built and run,
+# its JSON report is compared with bench_baseline.json so a change in bus traffic is
+# seen. --update accepts it too.
+#
+# The exit status is non-zero if a build fails, a reference test fails or the output
+# differs from golden.txt or bench_baseline.json. CXX and CXXFLAGS can be set as usual.
+
+DIR=$(cd "$(dirname "$0")" && pwd)
+ROOT=$(cd "$DIR/../.." && pwd)
+BUILD=${BUILD:-$DIR/build}
+CXX=${CXX:-g++}
+CXXFLAGS=${CXXFLAGS:--O2 -Wall -fno-strict-aliasing}
+
+mkdir -p "$BUILD" || exit 1
+
+echo "Building host_test"
+$CXX -std=gnu++11 $CXXFLAGS -DTFT_HOST_BACKEND -I"$DIR" -I"$ROOT" \
+  -o "$BUILD/host_test" "$DIR/host_test.cpp" "$ROOT/TFT_eSPI.cpp" || exit 1
+
+echo "Running host_test"
+"$BUILD/host_test" "$BUILD/last.ppm" > "$BUILD/golden.txt"
+status=$?
+
+if [ "$1" = "--update" ]; then
+  cp "$BUILD/golden.txt" "$DIR/golden.txt"
+  echo "golden.txt updated"
+elif ! diff -u "$DIR/golden.txt" "$BUILD/golden.txt"; then
+  echo "Golden output differs from golden.txt"
+  status=1
+fi
+
+# A sketch is made into C++ as the Arduino IDE does, with a prototype for each function
+SKETCH="$ROOT/examples/Generic/TFT_Bus_Benchmark/TFT_Bus_Benchmark.ino"
+{
+  echo "#include <Arduino.h>"
+  echo "#include <TFT_eSPI.h>"
+  sed -n 's/^\([A-Za-z_][A-Za-z0-9_ ]*[ *]\)\([A-Za-z_][A-Za-z0-9_]*([^)]*)\) {$/\1\2;/p' "$SKETCH"
+  echo "#line 1 \"$SKETCH\""
+  cat "$SKETCH"
+} > "$BUILD/TFT_Bus_Benchmark.cpp"
+
+echo "Building TFT_Bus_Benchmark"
+$CXX -std=gnu++11 $CXXFLAGS -DTFT_HOST_BACKEND -I"$DIR" -I"$ROOT" -o "$BUILD/bus_benchmark" \
+  "$BUILD/TFT_Bus_Benchmark.cpp" "$DIR/sketch_main.cpp" "$ROOT/TFT_eSPI.cpp" || exit 1
+
+echo "Running TFT_Bus_Benchmark"
+"$BUILD/bus_benchmark" > "$BUILD/bench.json" || status=1
+
+if [ "$1" = "--update" ]; then
+  cp "$BUILD/bench.json" "$DIR/bench_baseline.json"
+  echo "bench_baseline.json updated"
+elif ! diff -u "$DIR/bench_baseline.json" "$BUILD/bench.json"; then
+  echo "Bus benchmark differs from bench_baseline.json"
+  status=1
+fi
+
+[ $status -eq 0 ] && echo "All tests passed"
+exit $status
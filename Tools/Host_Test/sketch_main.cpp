@@ -0,0 +1,18 @@
+/***************************************************************************************
+// Runs an Arduino sketch on the host, e.g. examples/Generic/TFT_Bus_Benchmark
+//
+// run_tests.sh turns the .ino into a C++ file as the Arduino IDE does, Arduino.h and
+// TFT_eSPI.h first then a prototype for each function, and links it with this file.
+// setup() is called once then loop() for ever, a sketch ends the run with exit().
+***************************************************************************************/
+
+#include <Arduino.h>
+
+void setup(void);
+void loop(void);
+
+int main(void)
+{
+  setup();
+  for (;;) loop();
+}
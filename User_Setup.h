@@ -111,6 +111,7 @@
 #define LOAD_FONT7  // Font 7. 7 segment 48 pixel font, needs ~2438 bytes in FLASH, only characters 1234567890:.
 #define LOAD_FONT8  // Font 8. Large 75 pixel font needs ~3256 bytes in FLASH, only characters 1234567890:-.
 #define LOAD_GFXFF  // FreeFonts. Include access to the 48 Adafruit_GFX free fonts FF1 to FF48 and custom fonts
+//#define LOAD_UNICODE // Decode free font text as UTF-8, allows fonts with several Unicode character code ranges
 
 // ##################################################################################
 //
@@ -148,3 +149,11 @@
 // Transaction support is needed to work with SD library but not needed with TFT_SdFat
 
 // #define SUPPORT_TRANSACTIONS
+
+
+// ESP32 only, uncomment the following #define to let pushColorsDMA() and pushRectDMA()
+// send pixels in the background using the SPI DMA controller on VSPI. The processor
+// can then render the next block while the last one is sent. When commented out
+// those functions send the pixels before returning, like pushColors() and pushRect()
+
+// #define ESP32_DMA
@@ -0,0 +1,67 @@
+//                            USER DEFINED SETTINGS
+//   Setup file for a host (e.g. Linux PC) build of the library, this is selected
+//   automatically by User_Setup_Select.h when TFT_HOST_BACKEND is defined.
+//
+//   No hardware is used, the bus traffic is decoded by the panel model in
+//   Extensions/Host.h so rendering can be benchmarked and checked pixel by pixel.
+
+// ##################################################################################
+//
+// Section 0. Call up the right driver file and any options for it
+//
+// ##################################################################################
+
+// Only define one driver, the other ones must be commented out
+#define ILI9341_DRIVER
+//#define ST7735_DRIVER
+
+//#define ST7735_INITB
+//#define ST7735_GREENTAB
+//#define ST7735_GREENTAB2
+//#define ST7735_REDTAB
+//#define ST7735_BLACKTAB
+
+// ##################################################################################
+//
+// Section 1. Define the pins that are used to interface with the display here
+//
+// ##################################################################################
+
+// The pin numbers are not used by the host backend but must be defined
+#define TFT_CS   15  // Chip select control pin
+#define TFT_DC    0  // Data Command control pin
+#define TFT_RST  -1  // Reset pin
+
+// ##################################################################################
+//
+// Section 3. Define the fonts that are to be used here
+//
+// ##################################################################################
+
+#define LOAD_GLCD   // Font 1. Original Adafruit 8 pixel font needs ~1820 bytes in FLASH
+#define LOAD_FONT2  // Font 2. Small 16 pixel high font, needs ~3534 bytes in FLASH, 96 characters
+#define LOAD_FONT4  // Font 4. Medium 26 pixel high font, needs ~5848 bytes in FLASH, 96 characters
+#define LOAD_FONT6  // Font 6. Large 48 pixel font, needs ~2666 bytes in FLASH, only characters 1234567890:-.apm
+#define LOAD_FONT7  // Font 7. 7 segment 48 pixel font, needs ~2438 bytes in FLASH, only characters 1234567890:.
+#define LOAD_FONT8  // Font 8. Large 75 pixel font needs ~3256 bytes in FLASH, only characters 1234567890:-.
+#define LOAD_GFXFF  // FreeFonts. Include access to the 48 Adafruit_GFX free fonts FF1 to FF48 and custom fonts
+//#define LOAD_UNICODE // Decode free font text as UTF-8, allows fonts with several Unicode character code ranges
+
+// ##################################################################################
+//
+// Section 4. Define the character to be used to detemine the text bounding box for datum changes
+//
+// ##################################################################################
+
+#define FF_HEIGHT '/'  // '/' character used to set free font height above the baseline
+#define FF_BOTTOM 'y'  // 'y' character used to set free font height below baseline
+
+
+// ##################################################################################
+//
+// Section 5. Other options
+//
+// ##################################################################################
+
+// The SPI clock frequency is only used to model transfer times on the host
+#define SPI_FREQUENCY  40000000
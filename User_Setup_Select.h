@@ -14,7 +14,15 @@
 
 // Only ONE line should be uncommented
 
+// A host (e.g. Linux PC) build defines TFT_HOST_BACKEND on the compiler command line
+// and always uses its own setup file, see Extensions/Host.h
+#ifdef TFT_HOST_BACKEND
+  #include <User_Setup4_Host.h>     // Setup file for the host emulator build
+#else
+
 #include <User_Setup.h>           // Default setup
 //#include <User_Setup1_ILI9341.h>  // Setup file configured for my ILI9341
 //#include <User_Setup2_ST7735.h>   // Setup file configured for my ST7735
-//#include <User_Setup3_Template.h> // Setup file template for copying/editting
\ No newline at end of file
+//#include <User_Setup3_Template.h> // Setup file template for copying/editting
+
+#endif
\ No newline at end of file
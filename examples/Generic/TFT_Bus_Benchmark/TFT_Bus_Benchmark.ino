@@ -0,0 +1,410 @@
+/*
+ Bus cost benchmark, runs the same scenes as TFT_graphicstest_PDQ plus drawString
+ in every font and reports the display bus traffic for each one as JSON.
+
+ This sketch must be compiled for a host PC with TFT_HOST_BACKEND defined (see
+ Extensions/Host.h in the library folder), no TFT hardware is needed. For each
+ test the following are reported:
+
+   bytes        - bytes clocked on the SPI bus
+   commands     - command bytes (DC low)
+   caset, paset - address window column and row commands
+   ramwr        - memory write commands
+   cs_toggles   - chip select assertions
+   transactions - SPI bus lock handshakes (spi_begin calls)
+   pixels       - pixels written to the display memory
+   bus_us       - modelled transfer time in microseconds
+
+ The modelled time is the bus time for the bytes at BENCH_SPI_FREQUENCY plus
+ BENCH_TRANSACTION_NS for each transaction. Both can be set on the compiler
+ command line, e.g. -DBENCH_SPI_FREQUENCY=27000000
+
+ The output is a single JSON object so results can be compared between releases.
+ Tools/Host_Test/run_tests.sh builds and runs this sketch with the host Arduino API
+ in that folder and compares the report with Tools/Host_Test/bench_baseline.json.
+ */
+
+#include <TFT_eSPI.h>
+
+#ifndef TFT_HOST_BACKEND
+  #error "TFT_Bus_Benchmark must be compiled for the host with TFT_HOST_BACKEND defined"
+#endif
+
+// SPI clock used for the modelled transfer time
+#ifndef BENCH_SPI_FREQUENCY
+  #define BENCH_SPI_FREQUENCY SPI_FREQUENCY
+#endif
+
+// Modelled fixed cost of each transaction (bus lock, CS and DC setup) in nanoseconds
+#ifndef BENCH_TRANSACTION_NS
+  #define BENCH_TRANSACTION_NS 0
+#endif
+
+TFT_eSPI tft = TFT_eSPI();
+
+TFT_HostStats total;   // Traffic accumulated for the current test
+bool firstResult = true;
+
+void setup() {
+  Serial.begin(115200);
+
+  TFT_Host::reset();
+  tft.init();
+
+  Serial.println("{");
+  Serial.println("  \"benchmark\": \"TFT_Bus_Benchmark\",");
+#if defined (ST7735_DRIVER)
+  Serial.println("  \"driver\": \"ST7735\",");
+#else
+  Serial.println("  \"driver\": \"ILI9341\",");
+#endif
+  Serial.print("  \"spi_frequency\": "); Serial.print((unsigned long)BENCH_SPI_FREQUENCY); Serial.println(",");
+  Serial.print("  \"transaction_ns\": "); Serial.print((unsigned long)BENCH_TRANSACTION_NS); Serial.println(",");
+  Serial.println("  \"results\": [");
+
+  testFillScreen();
+  testText();
+  testPixels();
+  testLines(TFT_BLUE);
+  testFastLines(TFT_RED, TFT_BLUE);
+  testRects(TFT_GREEN);
+  testFilledRects(TFT_YELLOW, TFT_MAGENTA);
+  testFilledCircles(10, TFT_MAGENTA);
+  testCircles(10, TFT_WHITE);
+  testTriangles();
+  testFilledTriangles();
+  testRoundRects();
+  testFilledRoundRects();
+  testStrings();
+
+  Serial.println();
+  Serial.println("  ]");
+  Serial.println("}");
+
+  exit(0);
+}
+
+void loop() {
+}
+
+// Start a new test, only traffic between benchStart() and benchStop() is counted
+void benchBegin() {
+  memset(&total, 0, sizeof(total));
+}
+
+void benchStart() {
+  TFT_Host::clearStats();
+}
+
+void benchStop() {
+  TFT_HostStats &s = TFT_Host::stats;
+  total.bytes        += s.bytes;
+  total.commands     += s.commands;
+  total.caset        += s.caset;
+  total.paset        += s.paset;
+  total.ramwr        += s.ramwr;
+  total.ramrd        += s.ramrd;
+  total.pixels       += s.pixels;
+  total.csToggles    += s.csToggles;
+  total.transactions += s.transactions;
+}
+
+void printField(const char *name, unsigned long value) {
+  Serial.print(", \""); Serial.print(name); Serial.print("\": "); Serial.print(value);
+}
+
+void benchReport(const char *name) {
+  double bus_us = (double)total.bytes * 8.0 * 1000000.0 / BENCH_SPI_FREQUENCY
+                + (double)total.transactions * BENCH_TRANSACTION_NS / 1000.0;
+
+  if (!firstResult) Serial.println(",");
+  firstResult = false;
+
+  Serial.print("    { \"name\": \""); Serial.print(name); Serial.print("\"");
+  printField("bytes",        total.bytes);
+  printField("commands",     total.commands);
+  printField("caset",        total.caset);
+  printField("paset",        total.paset);
+  printField("ramwr",        total.ramwr);
+  printField("cs_toggles",   total.csToggles);
+  printField("transactions", total.transactions);
+  printField("pixels",       total.pixels);
+  Serial.print(", \"bus_us\": "); Serial.print(bus_us, 1);
+  Serial.print(" }");
+}
+
+void testFillScreen() {
+  benchBegin();
+  benchStart();
+  tft.fillScreen(TFT_WHITE);
+  tft.fillScreen(TFT_RED);
+  tft.fillScreen(TFT_GREEN);
+  tft.fillScreen(TFT_BLUE);
+  tft.fillScreen(TFT_BLACK);
+  benchStop();
+  benchReport("fillScreen");
+}
+
+void testText() {
+  tft.fillScreen(TFT_BLACK);
+  benchBegin();
+  benchStart();
+  tft.setCursor(0, 0);
+  tft.setTextColor(TFT_WHITE, TFT_BLACK); tft.setTextSize(1);
+  tft.println("Hello World!");
+  tft.setTextSize(2);
+  tft.setTextColor(tft.color565(0xff, 0x00, 0x00));
+  tft.print("RED ");
+  tft.setTextColor(tft.color565(0x00, 0xff, 0x00));
+  tft.print("GREEN ");
+  tft.setTextColor(tft.color565(0x00, 0x00, 0xff));
+  tft.println("BLUE");
+  tft.setTextColor(TFT_YELLOW); tft.setTextSize(2);
+  tft.println(1234.56);
+  tft.setTextColor(TFT_RED); tft.setTextSize(3);
+  tft.println(0xDEADBEEF, HEX);
+  tft.println();
+  tft.setTextColor(TFT_GREEN);
+  tft.setTextSize(5);
+  tft.println("Groop");
+  tft.setTextSize(2);
+  tft.println("I implore thee,");
+  tft.setTextSize(1);
+  tft.println("my foonting turlingdromes.");
+  tft.println("And hooptiously drangle me");
+  tft.println("with crinkly bindlewurdles,");
+  tft.println("Or I will rend thee");
+  tft.println("in the gobberwarts");
+  tft.println("with my blurglecruncheon,");
+  tft.println("see if I don't!");
+  tft.println("");
+  tft.println("");
+  tft.setTextColor(TFT_MAGENTA);
+  tft.setTextSize(6);
+  tft.println("Woot!");
+  tft.setTextSize(1);
+  benchStop();
+  benchReport("text");
+}
+
+void testPixels() {
+  int32_t w = tft.width();
+  int32_t h = tft.height();
+
+  benchBegin();
+  benchStart();
+  for (int32_t y = 0; y < h; y++) {
+    for (int32_t x = 0; x < w; x++) {
+      tft.drawPixel(x, y, tft.color565(x << 3, y << 3, x * y));
+    }
+  }
+  benchStop();
+  benchReport("pixels");
+}
+
+void testLines(uint16_t color) {
+  int32_t x1, y1, x2, y2;
+  int32_t w = tft.width();
+  int32_t h = tft.height();
+
+  benchBegin();
+
+  // Lines are fanned out from each corner in turn
+  for (uint8_t corner = 0; corner < 4; corner++) {
+    tft.fillScreen(TFT_BLACK);
+
+    x1 = (corner & 1) ? w - 1 : 0;
+    y1 = (corner & 2) ? h - 1 : 0;
+    y2 = h - 1 - y1;
+
+    benchStart();
+    for (x2 = 0; x2 < w; x2 += 6) tft.drawLine(x1, y1, x2, y2, color);
+    x2 = w - 1 - x1;
+    for (y2 = 0; y2 < h; y2 += 6) tft.drawLine(x1, y1, x2, y2, color);
+    benchStop();
+  }
+
+  benchReport("lines");
+}
+
+void testFastLines(uint16_t color1, uint16_t color2) {
+  int32_t x, y;
+  int32_t w = tft.width();
+  int32_t h = tft.height();
+
+  tft.fillScreen(TFT_BLACK);
+
+  benchBegin();
+  benchStart();
+  for (y = 0; y < h; y += 5) tft.drawFastHLine(0, y, w, color1);
+  for (x = 0; x < w; x += 5) tft.drawFastVLine(x, 0, h, color2);
+  benchStop();
+  benchReport("fastLines");
+}
+
+void testRects(uint16_t color) {
+  int32_t n, i, i2;
+  int32_t cx = tft.width() / 2;
+  int32_t cy = tft.height() / 2;
+
+  tft.fillScreen(TFT_BLACK);
+  n = min(tft.width(), tft.height());
+
+  benchBegin();
+  benchStart();
+  for (i = 2; i < n; i += 6) {
+    i2 = i / 2;
+    tft.drawRect(cx - i2, cy - i2, i, i, color);
+  }
+  benchStop();
+  benchReport("rects");
+}
+
+void testFilledRects(uint16_t color1, uint16_t color2) {
+  int32_t n, i, i2;
+  int32_t cx = tft.width() / 2 - 1;
+  int32_t cy = tft.height() / 2 - 1;
+
+  tft.fillScreen(TFT_BLACK);
+  n = min(tft.width(), tft.height());
+
+  benchBegin();
+  for (i = n; i > 0; i -= 6) {
+    i2 = i / 2;
+    benchStart();
+    tft.fillRect(cx - i2, cy - i2, i, i, color1);
+    benchStop();
+    // Outlines are not included in the results
+    tft.drawRect(cx - i2, cy - i2, i, i, color2);
+  }
+  benchReport("filledRects");
+}
+
+void testFilledCircles(uint8_t radius, uint16_t color) {
+  int32_t x, y, w = tft.width(), h = tft.height(), r2 = radius * 2;
+
+  tft.fillScreen(TFT_BLACK);
+
+  benchBegin();
+  benchStart();
+  for (x = radius; x < w; x += r2) {
+    for (y = radius; y < h; y += r2) {
+      tft.fillCircle(x, y, radius, color);
+    }
+  }
+  benchStop();
+  benchReport("filledCircles");
+}
+
+void testCircles(uint8_t radius, uint16_t color) {
+  int32_t x, y, r2 = radius * 2;
+  int32_t w = tft.width() + radius;
+  int32_t h = tft.height() + radius;
+
+  benchBegin();
+  benchStart();
+  for (x = 0; x < w; x += r2) {
+    for (y = 0; y < h; y += r2) {
+      tft.drawCircle(x, y, radius, color);
+    }
+  }
+  benchStop();
+  benchReport("circles");
+}
+
+void testTriangles() {
+  int32_t n, i;
+  int32_t cx = tft.width() / 2 - 1;
+  int32_t cy = tft.height() / 2 - 1;
+
+  tft.fillScreen(TFT_BLACK);
+  n = min(cx, cy);
+
+  benchBegin();
+  benchStart();
+  for (i = 0; i < n; i += 5) {
+    tft.drawTriangle(cx, cy - i, cx - i, cy + i, cx + i, cy + i, tft.color565(0, 0, i));
+  }
+  benchStop();
+  benchReport("triangles");
+}
+
+void testFilledTriangles() {
+  int32_t i;
+  int32_t cx = tft.width() / 2 - 1;
+  int32_t cy = tft.height() / 2 - 1;
+
+  tft.fillScreen(TFT_BLACK);
+
+  benchBegin();
+  for (i = min(cx, cy); i > 10; i -= 5) {
+    benchStart();
+    tft.fillTriangle(cx, cy - i, cx - i, cy + i, cx + i, cy + i, tft.color565(0, i, i));
+    benchStop();
+    tft.drawTriangle(cx, cy - i, cx - i, cy + i, cx + i, cy + i, tft.color565(i, i, 0));
+  }
+  benchReport("filledTriangles");
+}
+
+void testRoundRects() {
+  int32_t w, i, i2;
+  int32_t cx = tft.width() / 2 - 1;
+  int32_t cy = tft.height() / 2 - 1;
+
+  tft.fillScreen(TFT_BLACK);
+  w = min(tft.width(), tft.height());
+
+  benchBegin();
+  benchStart();
+  for (i = 0; i < w; i += 6) {
+    i2 = i / 2;
+    tft.drawRoundRect(cx - i2, cy - i2, i, i, i / 8, tft.color565(i, 0, 0));
+  }
+  benchStop();
+  benchReport("roundRects");
+}
+
+void testFilledRoundRects() {
+  int32_t i, i2;
+  int32_t cx = tft.width() / 2 - 1;
+  int32_t cy = tft.height() / 2 - 1;
+
+  tft.fillScreen(TFT_BLACK);
+
+  benchBegin();
+  benchStart();
+  for (i = min(tft.width(), tft.height()); i > 20; i -= 6) {
+    i2 = i / 2;
+    tft.fillRoundRect(cx - i2, cy - i2, i, i, i / 8, tft.color565(0, i, 0));
+  }
+  benchStop();
+  benchReport("filledRoundRects");
+}
+
+// drawString in each font, with transparent and solid backgrounds
+void testString(const char *name, const char *text, uint8_t font, const GFXfont *freeFont) {
+  tft.fillScreen(TFT_BLACK);
+
+  benchBegin();
+  benchStart();
+  if (freeFont) tft.setFreeFont(freeFont);
+  else tft.setTextFont(font);
+  tft.setTextColor(TFT_WHITE);
+  tft.drawString(text, 4, 4);
+  tft.setTextColor(TFT_YELLOW, TFT_BLUE);
+  tft.drawString(text, 4, tft.height() / 2);
+  tft.setTextFont(1);
+  benchStop();
+  benchReport(name);
+}
+
+void testStrings() {
+  testString("drawString_font1", "Font 1 test 123", 1, NULL);
+  testString("drawString_font2", "Font 2 test 123", 2, NULL);
+  testString("drawString_font4", "Font 4 test", 4, NULL);
+  testString("drawString_font6", "12:34pm", 6, NULL);
+  testString("drawString_font7", "12:34", 7, NULL);
+  testString("drawString_font8", "1234", 8, NULL);
+  testString("drawString_FreeSans12pt", "FreeSans 123", 0, &FreeSans12pt7b);
+  testString("drawString_FreeSerifBold24pt", "Serif 24", 0, &FreeSerifBold24pt7b);
+}
@@ -0,0 +1,135 @@
+/*
+ Renders a Mandelbrot set in horizontal strips, first sending each strip with
+ pushRect() and then with pushRectDMA() so the time saved by overlapping the
+ rendering of one strip with the transfer of the previous one can be seen.
+
+ Two strip buffers are used in turn (ping-pong). pushRectDMA() returns as soon as
+ the previous transfer has finished, so the buffer used two calls ago is free to
+ be rendered into while the last strip is being sent.
+
+ On the ESP32 DMA must be enabled by uncommenting #define ESP32_DMA in the
+ User_Setup.h file, otherwise pushRectDMA() behaves like pushRect() and the two
+ times will be about the same.
+
+ When compiled for the host with TFT_HOST_BACKEND defined the DMA transfers are
+ simulated (see Extensions/Host.h in the library folder). The times printed are
+ then the real rendering time plus the modelled bus time at SPI_FREQUENCY, the
+ DMA stall time is printed and both renders are checked to give the same image.
+ */
+
+#include <TFT_eSPI.h>
+
+#define STRIP_LINES 16  // Lines rendered into each buffer
+#define MAX_ITER    48  // Maximum iterations per pixel
+
+TFT_eSPI tft = TFT_eSPI();
+
+uint16_t *strip[2];     // Ping-pong strip buffers
+
+void setup() {
+  Serial.begin(115200);
+
+#ifdef TFT_HOST_BACKEND
+  TFT_Host::reset();
+#endif
+  tft.init();
+  tft.setRotation(1);
+
+  strip[0] = (uint16_t*)malloc(tft.width() * STRIP_LINES * 2);
+  strip[1] = (uint16_t*)malloc(tft.width() * STRIP_LINES * 2);
+
+  if (!tft.initDMA()) Serial.println("DMA not available, pushRectDMA() will not overlap");
+}
+
+void loop() {
+  uint32_t syncTime, dmaTime;
+
+  tft.fillScreen(TFT_BLACK);
+  syncTime = render(false);
+#ifdef TFT_HOST_BACKEND
+  uint32_t syncCrc = TFT_Host::checksum();
+#endif
+
+  tft.fillScreen(TFT_BLACK);
+#ifdef TFT_HOST_BACKEND
+  TFT_Host::clearStats();
+#endif
+  dmaTime = render(true);
+
+  Serial.print("pushRect    "); Serial.print(syncTime); Serial.println(" us");
+  Serial.print("pushRectDMA "); Serial.print(dmaTime);  Serial.println(" us");
+
+#ifdef TFT_HOST_BACKEND
+  // The modelled time includes the time the processor was stalled by the DMA
+  uint32_t busUs   = TFT_Host::stats.dmaBusUs;
+  uint32_t stallUs = TFT_Host::stats.dmaStallUs;
+  Serial.print("DMA bus     "); Serial.print(busUs);   Serial.println(" us");
+  Serial.print("DMA stall   "); Serial.print(stallUs); Serial.println(" us");
+  Serial.print("Overlapped  "); Serial.print(busUs ? 100 * (busUs - stallUs) / busUs : 0); Serial.println(" %");
+  Serial.println(syncCrc == TFT_Host::checksum() ? "Images match" : "Images differ!");
+  exit(0);
+#endif
+
+  delay(5000);
+}
+
+// Render the set, return the time taken in microseconds
+uint32_t render(bool dma)
+{
+  int32_t w = tft.width(), h = tft.height();
+  uint8_t  b = 0;
+
+  uint32_t start = micros();
+#ifdef TFT_HOST_BACKEND
+  TFT_HostStats before = TFT_Host::stats;
+#endif
+
+  tft.startWrite(); // Hold the bus so DMA transfers can be queued
+
+  for (int32_t y = 0; y < h; y += STRIP_LINES) {
+    int32_t lines = (h - y < STRIP_LINES) ? h - y : STRIP_LINES;
+
+    renderStrip(strip[b], y, w, lines, h);
+
+    if (dma) tft.pushRectDMA(0, y, w, lines, strip[b]);
+    else     tft.pushRect(0, y, w, lines, strip[b]);
+
+    b ^= 1;
+  }
+
+  tft.endWrite();   // Waits for the last transfer to finish
+
+  uint32_t t = micros() - start;
+#ifdef TFT_HOST_BACKEND
+  // Add the modelled time of bytes not sent by DMA and the time stalled by DMA
+  uint32_t bytes = (TFT_Host::stats.bytes - before.bytes) - (TFT_Host::stats.dmaBytes - before.dmaBytes);
+  t += (uint32_t)(((uint64_t)bytes * 8 * 1000000) / SPI_FREQUENCY);
+  t += TFT_Host::stats.dmaStallUs - before.dmaStallUs;
+#endif
+  return t;
+}
+
+// Render lines y to y + lines - 1 into buf, colours are stored with the bytes
+// swapped as pushRect() sends the buffer bytes in memory order
+void renderStrip(uint16_t *buf, int32_t y, int32_t w, int32_t lines, int32_t h)
+{
+  for (int32_t j = 0; j < lines; j++) {
+    float ci = ((y + j) - h / 2) * 2.4 / h;
+
+    for (int32_t i = 0; i < w; i++) {
+      float cr = (i - w * 2 / 3) * 2.4 / h;
+      float zr = 0, zi = 0;
+      uint8_t n = 0;
+
+      while ((n < MAX_ITER) && (zr * zr + zi * zi < 4.0)) {
+        float t = zr * zr - zi * zi + cr;
+        zi = 2 * zr * zi + ci;
+        zr = t;
+        n++;
+      }
+
+      uint16_t color = (n == MAX_ITER) ? TFT_BLACK : tft.color565(n * 16, n * 5, 255 - n * 5);
+      *buf++ = (color >> 8) | (color << 8);
+    }
+  }
+}
@@ -0,0 +1,64 @@
+/*
+ Flicker free overlapping graphics without a full screen buffer
+
+ The scene, a gradient sky, a sun, hills, a small image and text on top, is
+ recorded in a display list and rendered in 16 line strips. Each strip is drawn
+ in a 240 x 16 Sprite (7680 bytes of RAM for a 240 wide screen) by replaying the
+ recorded calls and then pushed to the screen, so every pixel is sent once and
+ nothing is seen being drawn over.
+ */
+
+#include <TFT_eSPI.h>
+
+#define ICON_W 16
+#define ICON_H 16
+
+TFT_eSPI         tft = TFT_eSPI();
+TFT_eDisplayList dl  = TFT_eDisplayList(&tft);
+
+uint16_t icon[ICON_W * ICON_H]; // Image with bytes in pushRect() order
+uint32_t frame = 0;
+
+void setup() {
+  Serial.begin(115200);
+
+  tft.init();
+  tft.setRotation(0);
+
+  if (!dl.begin(16, 48, 64)) Serial.println("Not enough RAM for display list");
+
+  // A small chequered icon
+  for (int i = 0; i < ICON_W * ICON_H; i++) {
+    uint16_t color = (((i % ICON_W) / 4 + (i / ICON_W) / 4) & 1) ? TFT_WHITE : TFT_RED;
+    icon[i] = (color >> 8) | (color << 8);
+  }
+}
+
+void loop() {
+  int32_t w = tft.width(), h = tft.height();
+  int32_t sunY = h / 2 - 60 * sin(frame * 0.03);
+
+  dl.clear();
+
+  dl.fillRectVGradient(0, 0, w, h, TFT_NAVY, TFT_ORANGE);
+  dl.fillCircle(w / 2, sunY, 30, TFT_YELLOW);
+  dl.fillTriangle(-40, h, w / 3, h / 2, w, h, TFT_DARKGREEN);
+  dl.fillTriangle(0, h, w * 2 / 3, h * 3 / 5, w + 40, h, TFT_GREEN);
+  dl.pushRect((frame * 2) % (w - ICON_W), h - 40, ICON_W, ICON_H, icon);
+
+  dl.setTextColor(TFT_WHITE);
+  dl.setTextDatum(TC_DATUM);
+  dl.drawString("Display list", w / 2, 10, 4);
+  dl.drawNumber(frame, w / 2, 40, 4);
+
+  uint32_t start = millis();
+  dl.render();
+  uint32_t t = millis() - start;
+
+  if (frame % 50 == 0) {
+    Serial.print(dl.opCount()); Serial.print(" calls rendered in ");
+    Serial.print(t); Serial.println(" ms");
+  }
+
+  frame++;
+}
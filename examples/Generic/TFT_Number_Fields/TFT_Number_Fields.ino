@@ -0,0 +1,70 @@
+/*
+ Many readings updated quickly by sending only the digits that change
+
+ 20 channels are shown in two columns and each is updated 10 times a second. A
+ TFT_eNumberField remembers what it drew, so when a reading goes from 12.34 to
+ 12.35 only the last digit and its background are sent. The digits have cells of
+ equal width, so the numbers do not shift about in the proportional font.
+
+ Each field has its own font and colours, the text settings of tft are not changed.
+ */
+
+#include <TFT_eSPI.h>
+
+#define CHANNELS 20
+
+TFT_eSPI         tft = TFT_eSPI();
+TFT_eNumberField field[CHANNELS] = {
+  &tft, &tft, &tft, &tft, &tft, &tft, &tft, &tft, &tft, &tft,
+  &tft, &tft, &tft, &tft, &tft, &tft, &tft, &tft, &tft, &tft
+};
+
+float    reading[CHANNELS];
+uint32_t frame = 0;
+
+void setup() {
+  Serial.begin(115200);
+
+  tft.init();
+  tft.setRotation(1);
+  tft.fillScreen(TFT_BLACK);
+
+  tft.setTextFont(2);
+  tft.setTextColor(TFT_LIGHTGREY, TFT_BLACK);
+
+  for (int i = 0; i < CHANNELS; i++) {
+    int x = (i / 10) * 160, y = (i % 10) * 24;
+
+    // The labels are drawn once
+    tft.drawString("Ch", x + 4, y + 4);
+    tft.drawNumber(i + 1, x + 26, y + 4);
+
+    // The fields right align their text in a box 100 pixels wide
+    field[i].setPosition(x + 150, y + 2, 100, TR_DATUM);
+    field[i].setFreeFont(&FreeSans9pt7b);
+    field[i].setTextColor(TFT_GREEN, TFT_BLACK);
+
+    reading[i] = random(10000) / 10.0;
+  }
+}
+
+void loop() {
+  uint32_t start = millis();
+
+  for (int i = 0; i < CHANNELS; i++) {
+    reading[i] += random(-50, 51) / 100.0;
+    field[i].drawFloat(reading[i], 2);
+  }
+
+  uint32_t t = millis() - start;
+
+  if (frame % 50 == 0) {
+    Serial.print(CHANNELS); Serial.print(" fields updated in ");
+    Serial.print(t); Serial.println(" ms");
+  }
+
+  frame++;
+
+  // 10 updates per second
+  while (millis() - start < 100) yield();
+}
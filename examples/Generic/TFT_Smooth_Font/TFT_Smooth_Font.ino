@@ -0,0 +1,57 @@
+/*
+ Anti-aliased text with a smooth font
+
+ Smooth fonts hold 4 bits of coverage per pixel, the edges of the characters are
+ blended with the background colour set by setTextColor(). The colours at each of
+ the 16 coverage levels are worked out once when the colours change, so drawing
+ a pixel is a table lookup.
+
+ drawString() sends the text and its background in one go, so a value can be
+ redrawn in place many times a second without flicker.
+ */
+
+#include <TFT_eSPI.h>
+
+TFT_eSPI tft = TFT_eSPI();
+
+uint32_t frame = 0;
+
+void setup() {
+  Serial.begin(115200);
+
+  tft.init();
+  tft.setRotation(1);
+  tft.fillScreen(TFT_NAVY);
+
+  tft.setSmoothFont(&FreeSansSmooth16pt7b);
+
+  tft.setTextColor(TFT_WHITE, TFT_NAVY);
+  tft.drawString("Smooth font", 10, 10);
+
+  // The same font scaled up
+  tft.setTextSize(2);
+  tft.setTextColor(TFT_BLACK, TFT_WHITE);
+  tft.drawString("Hello", 10, 60);
+  tft.setTextSize(1);
+}
+
+void loop() {
+  // Right aligned counter, padded to clear wider old values
+  tft.setTextColor(TFT_YELLOW, TFT_DARKGREEN);
+  tft.setTextDatum(TR_DATUM);
+  tft.setTextPadding(tft.textWidth("00000"));
+
+  uint32_t start = micros();
+  tft.drawNumber(frame, 300, 160);
+  uint32_t t = micros() - start;
+
+  tft.setTextPadding(0);
+  tft.setTextDatum(TL_DATUM);
+
+  if (frame % 100 == 0) {
+    Serial.print("Number drawn in "); Serial.print(t); Serial.println(" us");
+  }
+
+  frame++;
+  delay(33); // About 30 frames per second
+}
@@ -0,0 +1,78 @@
+/*
+ Bouncing balls drawn in a full screen 4 bit per pixel Sprite
+
+ A 16 bit full screen Sprite needs 320 x 240 x 2 = 153600 bytes, more RAM than
+ an ESP8266 has free. At 4 bits per pixel it needs 38400 bytes. Colours are then
+ palette indexes 0 to 15, set here with createPalette(), and are expanded to
+ RGB565 through a lookup table as the Sprite is pushed.
+
+ A 1 bit Sprite is used for a text banner, it is pushed in the two colours set
+ by setBitmapColor().
+ */
+
+#include <TFT_eSPI.h>
+
+#define BALLS 12
+
+TFT_eSPI    tft    = TFT_eSPI();
+TFT_eSprite screen = TFT_eSprite(&tft);
+TFT_eSprite banner = TFT_eSprite(&tft);
+
+// Palette, index 0 is the background
+const uint16_t palette[16] = {
+  TFT_BLACK, TFT_NAVY, TFT_DARKGREY, TFT_WHITE, TFT_RED, TFT_ORANGE, TFT_YELLOW, TFT_GREENYELLOW,
+  TFT_GREEN, TFT_DARKCYAN, TFT_CYAN, TFT_BLUE, TFT_PURPLE, TFT_MAGENTA, TFT_PINK, TFT_MAROON };
+
+int16_t x[BALLS], y[BALLS], dx[BALLS], dy[BALLS];
+uint32_t frame = 0;
+
+void setup() {
+  Serial.begin(115200);
+
+  tft.init();
+  tft.setRotation(1);
+
+  screen.setColorDepth(4);
+  if (!screen.createSprite(tft.width(), tft.height() - 20)) Serial.println("Not enough RAM for screen");
+  screen.createPalette(palette, 16);
+
+  banner.setColorDepth(1);
+  if (!banner.createSprite(tft.width(), 20)) Serial.println("Not enough RAM for banner");
+  banner.setBitmapColor(TFT_YELLOW, TFT_NAVY);
+
+  for (int i = 0; i < BALLS; i++) {
+    x[i]  = random(10, screen.width() - 10);
+    y[i]  = random(10, screen.height() - 10);
+    dx[i] = random(1, 4);
+    dy[i] = random(1, 4);
+  }
+}
+
+void loop() {
+  uint32_t start = millis();
+
+  screen.fillSprite(1);
+  for (int gx = 0; gx < screen.width(); gx += 32) screen.drawFastVLine(gx, 0, screen.height(), 2);
+  for (int gy = 0; gy < screen.height(); gy += 32) screen.drawFastHLine(0, gy, screen.width(), 2);
+
+  for (int i = 0; i < BALLS; i++) {
+    x[i] += dx[i];
+    y[i] += dy[i];
+    if ((x[i] < 10) || (x[i] >= screen.width()  - 10)) dx[i] = -dx[i];
+    if ((y[i] < 10) || (y[i] >= screen.height() - 10)) dy[i] = -dy[i];
+
+    screen.fillCircle(x[i], y[i], 10, 4 + i % 12);
+    screen.drawCircle(x[i], y[i], 10, 3);
+  }
+
+  screen.pushSprite(0, 20);
+
+  // 1 bit Sprites are drawn with colour 0 or 1
+  banner.fillSprite(0);
+  banner.setTextColor(1, 0);
+  banner.drawString("Frame", 4, 2, 2);
+  banner.drawNumber(frame++, 50, 2, 2);
+  banner.drawNumber(millis() - start, 120, 2, 2);
+  banner.drawString("ms", 150, 2, 2);
+  banner.pushSprite(0, 0);
+}
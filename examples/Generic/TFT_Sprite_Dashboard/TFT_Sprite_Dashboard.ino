@@ -0,0 +1,65 @@
+/*
+ Telemetry dashboard that only sends the changed areas of a full screen Sprite
+
+ The panels are drawn once, after that each update only redraws a few numbers
+ and a bar. With dirty rectangle tracking enabled the Sprite records the area
+ of each graphics call and pushDirty() sends just those areas, typically a few
+ percent of the screen, instead of the whole Sprite.
+
+ A 16 bit 240 x 320 Sprite needs 153600 bytes of RAM, use setColorDepth(8) on
+ an ESP8266.
+ */
+
+#include <TFT_eSPI.h>
+
+#define CHANNELS 6
+
+TFT_eSPI    tft = TFT_eSPI();
+TFT_eSprite spr = TFT_eSprite(&tft);
+
+uint32_t frame = 0;
+
+void setup() {
+  Serial.begin(115200);
+
+  tft.init();
+  tft.setRotation(0);
+
+  if (!spr.createSprite(tft.width(), tft.height())) Serial.println("Not enough RAM for sprite");
+
+  // Static layout, pushed once in full
+  spr.fillSprite(TFT_NAVY);
+  spr.setTextColor(TFT_YELLOW, TFT_NAVY);
+  for (int i = 0; i < CHANNELS; i++) {
+    spr.drawRoundRect(8, 8 + i * 52, 224, 46, 6, TFT_WHITE);
+    spr.drawString("Channel", 16, 12 + i * 52, 2);
+    spr.drawNumber(i + 1, 70, 12 + i * 52, 2);
+  }
+  spr.pushSprite(0, 0);
+
+  spr.setDirtyTracking(true);
+}
+
+void loop() {
+  // Update one channel per frame
+  int i = frame % CHANNELS;
+  int value = 500 + 450 * sin(frame * 0.07 + i);
+
+  spr.setTextColor(TFT_WHITE, TFT_NAVY);
+  spr.setTextDatum(TR_DATUM);
+  spr.setTextPadding(70);
+  spr.drawNumber(value, 220, 14 + i * 52, 4);
+  spr.setTextPadding(0);
+  spr.setTextDatum(TL_DATUM);
+
+  spr.fillRect(16, 34 + i * 52, value / 10, 12, TFT_GREEN);
+  spr.fillRect(16 + value / 10, 34 + i * 52, 100 - value / 10, 12, TFT_DARKGREY);
+
+  Serial.print(spr.dirtyCount());  Serial.print(" rectangles, ");
+  Serial.print(spr.dirtyPixels()); Serial.println(" pixels");
+
+  spr.pushDirty(0, 0);
+
+  frame++;
+  delay(50);
+}
@@ -0,0 +1,108 @@
+/*
+ Flicker free scrolling graph and meter needle drawn in Sprites
+
+ Each frame the graph and the needle are redrawn completely in a Sprite in RAM
+ and then pushed to the screen in one go. Nothing is erased on the screen so
+ there is no flicker, and only the area of each Sprite is sent over the SPI bus.
+
+ Only a few pixels of the meter change each frame, so it keeps a shadow copy of
+ what was last pushed and pushDiff() sends just the changed pixels.
+
+ The graph Sprite needs 200 x 100 x 2 = 40000 bytes of RAM and the meter Sprite
+ 120 x 70 x 2 = 16800 bytes, plus the same again for its shadow.
+ */
+
+#include <TFT_eSPI.h>
+
+#define GRAPH_W 200
+#define GRAPH_H 100
+
+#define METER_W 120
+#define METER_H  70
+
+TFT_eSPI    tft   = TFT_eSPI();
+TFT_eSprite graph = TFT_eSprite(&tft);
+TFT_eSprite meter = TFT_eSprite(&tft);
+
+int16_t  samples[GRAPH_W]; // Circular buffer of graph values
+uint16_t head = 0;         // Index of the oldest sample
+uint32_t frame = 0;
+
+void setup() {
+  Serial.begin(115200);
+
+  tft.init();
+  tft.setRotation(1);
+  tft.fillScreen(TFT_NAVY);
+
+  if (!graph.createSprite(GRAPH_W, GRAPH_H)) Serial.println("Not enough RAM for graph");
+  if (!meter.createSprite(METER_W, METER_H)) Serial.println("Not enough RAM for meter");
+  if (!meter.createShadow()) Serial.println("No shadow, the meter is pushed in full");
+
+  for (int i = 0; i < GRAPH_W; i++) samples[i] = GRAPH_H / 2;
+}
+
+void loop() {
+  // New sample, a wobbly sine wave
+  int16_t value = GRAPH_H / 2 + (GRAPH_H / 3) * sin(frame * 0.05) + random(-5, 6);
+  samples[head] = value;
+  head = (head + 1) % GRAPH_W;
+
+  drawGraph();
+  graph.pushSprite(10, 10);
+
+  drawMeter(value * 100 / GRAPH_H);
+  meter.pushDiff(10, 130);
+
+  if (frame % 100 == 99) {
+    Serial.print("Meter pixels compared "); Serial.print(meter.diffStats.compared);
+    Serial.print(", sent ");                Serial.println(meter.diffStats.sent);
+    meter.clearDiffStats();
+  }
+
+  frame++;
+  delay(20);
+}
+
+// Draw the whole graph, oldest sample on the left
+void drawGraph(void)
+{
+  graph.fillSprite(TFT_BLACK);
+
+  // Grid lines that scroll with the samples
+  for (int x = GRAPH_W - 1 - (frame % 20); x >= 0; x -= 20) graph.drawFastVLine(x, 0, GRAPH_H, TFT_DARKGREY);
+  for (int y = 0; y < GRAPH_H; y += 20) graph.drawFastHLine(0, y, GRAPH_W, TFT_DARKGREY);
+
+  int16_t last = samples[head];
+  for (int x = 1; x < GRAPH_W; x++) {
+    int16_t v = samples[(head + x) % GRAPH_W];
+    graph.drawLine(x - 1, GRAPH_H - 1 - last, x, GRAPH_H - 1 - v, TFT_GREEN);
+    last = v;
+  }
+
+  graph.setTextColor(TFT_WHITE, TFT_BLACK);
+  graph.drawNumber(frame, 2, 2, 2);
+}
+
+// Draw a meter with the needle at percent (0 to 100)
+void drawMeter(int percent)
+{
+  meter.fillSprite(TFT_WHITE);
+  meter.drawRect(0, 0, METER_W, METER_H, TFT_DARKGREY);
+
+  int cx = METER_W / 2, cy = METER_H - 5, r = METER_H - 15;
+
+  // Scale ticks every 10%
+  for (int i = 0; i <= 100; i += 10) {
+    float a = (i * 1.8 + 180) * 0.0174532925;
+    meter.drawLine(cx + r * cos(a), cy + r * sin(a), cx + (r - 6) * cos(a), cy + (r - 6) * sin(a), TFT_BLACK);
+  }
+
+  float a = (percent * 1.8 + 180) * 0.0174532925;
+  meter.drawLine(cx, cy, cx + (r - 2) * cos(a), cy + (r - 2) * sin(a), TFT_RED);
+  meter.fillCircle(cx, cy, 3, TFT_RED);
+
+  meter.setTextColor(TFT_BLACK);
+  meter.setTextDatum(BC_DATUM);
+  meter.drawNumber(percent, cx, cy - 8, 2);
+}
@@ -0,0 +1,58 @@
+/*
+ Word wrapped text in boxes
+
+ A TFT_eTextBox breaks its text into lines that fit the box width and aligns them
+ in the box with a datum. The line breaks are worked out once and kept, so the
+ boxes can be redrawn, e.g. when the colours change, without measuring the text
+ again. Each box is drawn with its background in one go so it does not flicker.
+ */
+
+#include <TFT_eSPI.h>
+
+TFT_eSPI     tft  = TFT_eSPI();
+TFT_eTextBox note = TFT_eTextBox(&tft);
+TFT_eTextBox help = TFT_eTextBox(&tft);
+
+const char noteText[] = "The quick brown fox jumps over the lazy dog.\n\nLines are broken at spaces, "
+                        "a word that is too long for the box is broken between characters.";
+const char helpText[] = "Centred text in a free font, only the lines that fit are drawn";
+
+uint32_t frame = 0;
+
+void setup() {
+  Serial.begin(115200);
+
+  tft.init();
+  tft.setRotation(1);
+  tft.fillScreen(TFT_BLACK);
+
+  note.setBox(10, 10, 140, 220);
+  note.setText(noteText);
+
+  help.setBox(170, 10, 140, 220);
+  help.setTextDatum(MC_DATUM);
+  help.setLineSpacing(4);
+  help.setText(helpText);
+
+  tft.setFreeFont(&FreeSans9pt7b);
+  Serial.print(help.lines()); Serial.println(" lines in the centred box");
+}
+
+void loop() {
+  uint16_t bg = (frame & 1) ? TFT_NAVY : TFT_DARKGREEN;
+
+  uint32_t start = millis();
+
+  tft.setTextFont(2);
+  tft.setTextColor(TFT_WHITE, bg);
+  note.draw();
+
+  tft.setFreeFont(&FreeSans9pt7b);
+  tft.setTextColor(TFT_YELLOW, bg);
+  help.draw();
+
+  Serial.print("Boxes drawn in "); Serial.print(millis() - start); Serial.println(" ms");
+
+  frame++;
+  delay(1000);
+}
@@ -113,25 +113,27 @@ void loop() {
     sx = cos((sdeg-90)*0.0174532925);    
     sy = sin((sdeg-90)*0.0174532925);
 
+    // The hands are anti-aliased against the black face, they are erased by drawing
+    // them again in black which covers the same pixels
     if (ss==0 || initial) {
       initial = 0;
       // Erase hour and minute hand positions every minute
-      tft.drawLine(ohx, ohy, 120, 121, TFT_BLACK);
+      tft.drawSmoothLine(ohx, ohy, 120, 121, TFT_BLACK, TFT_BLACK);
       ohx = hx*62+121;    
       ohy = hy*62+121;
-      tft.drawLine(omx, omy, 120, 121, TFT_BLACK);
+      tft.drawSmoothLine(omx, omy, 120, 121, TFT_BLACK, TFT_BLACK);
       omx = mx*84+120;    
       omy = my*84+121;
     }
 
       // Redraw new hand positions, hour and minute hands not erased here to avoid flicker
-      tft.drawLine(osx, osy, 120, 121, TFT_BLACK);
+      tft.drawSmoothLine(osx, osy, 120, 121, TFT_BLACK, TFT_BLACK);
       osx = sx*90+121;    
       osy = sy*90+121;
-      tft.drawLine(osx, osy, 120, 121, TFT_RED);
-      tft.drawLine(ohx, ohy, 120, 121, TFT_WHITE);
-      tft.drawLine(omx, omy, 120, 121, TFT_WHITE);
-      tft.drawLine(osx, osy, 120, 121, TFT_RED);
+      tft.drawSmoothLine(osx, osy, 120, 121, TFT_RED, TFT_BLACK);
+      tft.drawSmoothLine(ohx, ohy, 120, 121, TFT_WHITE, TFT_BLACK);
+      tft.drawSmoothLine(omx, omy, 120, 121, TFT_WHITE, TFT_BLACK);
+      tft.drawSmoothLine(osx, osy, 120, 121, TFT_RED, TFT_BLACK);
 
     tft.fillCircle(120, 121, 3, TFT_RED);
   }
@@ -1,4 +1,5 @@
-// This sketch tests a fillArc function that has been adapted to permit the drawing of spirals
+// This sketch draws a spiral with the library fillArc() function, each segment is a
+// short arc of a ring that shrinks as the spiral turns
 
 // Sketch also includes (but does not use) a function to change the brightness of a colour
 
@@ -7,8 +8,6 @@
 
 TFT_eSPI tft = TFT_eSPI();       // Invoke custom library
 
-#define DEG2RAD 0.0174532925
-
 int segment = 0;
 unsigned int col = 0;
 int delta = -1;
@@ -28,7 +27,9 @@ void setup(void) {
 
 
 void loop() {
-  fillArc(160, 120, segment*6, 1, 120-segment/4, 120-segment/4, 6, rainbow(col));
+  // Segments are 7 degrees every 6 degrees to prevent gaps as the radius changes
+  int r = 120 - segment/4;
+  tft.fillArc(160, 120, r - 5, r, segment*6, segment*6 + 7, rainbow(col));
 
   segment+=delta;
   col+=1;
@@ -38,49 +39,6 @@ void loop() {
   //delay(5); // Slow drawing down
 }
 
-// #########################################################################
-// Draw an arc with a defined thickness (modified to aid drawing spirals)
-// #########################################################################
-
-// x,y == coords of centre of arc
-// start_angle = 0 - 359
-// seg_count = number of 3 degree segments to draw (120 => 360 degree arc)
-// rx = x axis radius
-// yx = y axis radius
-// w  = width (thickness) of arc in pixels
-// colour = 16 bit colour value
-// Note if rx and ry are the same an arc of a circle is drawn
-
-int fillArc(int x, int y, int start_angle, int seg_count, int rx, int ry, int w, unsigned int colour)
-{
-
-  // Make the segment size 7 degrees to prevent gaps when drawing spirals
-  byte seg = 7; // Angle a single segment subtends (made more than 6 deg. for spiral drawing)
-  byte inc = 6; // Draw segments every 6 degrees
-
-  // Draw colour blocks every inc degrees
-  for (int i = start_angle; i < start_angle + seg * seg_count; i += inc) {
-    // Calculate pair of coordinates for segment start
-    float sx = cos((i - 90) * DEG2RAD);
-    float sy = sin((i - 90) * DEG2RAD);
-    uint16_t x0 = sx * (rx - w) + x;
-    uint16_t y0 = sy * (ry - w) + y;
-    uint16_t x1 = sx * rx + x;
-    uint16_t y1 = sy * ry + y;
-
-    // Calculate pair of coordinates for segment end
-    float sx2 = cos((i + seg - 90) * DEG2RAD);
-    float sy2 = sin((i + seg - 90) * DEG2RAD);
-    int x2 = sx2 * (rx - w) + x;
-    int y2 = sy2 * (ry - w) + y;
-    int x3 = sx2 * rx + x;
-    int y3 = sy2 * ry + y;
-
-    tft.fillTriangle(x0, y0, x1, y1, x2, y2, colour);
-    tft.fillTriangle(x1, y1, x2, y2, x3, y3, colour);
-  }
-}
-
 // #########################################################################
 // Return a 16 bit colour with brightness 0 - 100%
 // #########################################################################